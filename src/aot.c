@@ -0,0 +1,141 @@
+/* aot.c
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the program to C compiler module.  The code of a program is
+ * translated to a C function of the instructions in kernel.h, which is
+ * compiled together with the bytecode in place of bootstrap.h.  The
+ * kernel then runs the function instead of interpreting the code.
+ */
+
+#define MODULE_DEBUG 0
+#define MODULE_NAME  "aot"
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include "types.h"
+
+#include "aot.h"
+#include "args.h"
+#include "bif.h"
+#include "err.h"
+#include "mem.h"
+#include "process.h"
+#include "program.h"
+#include "str.h"
+
+#include "instructions.h"
+
+/* Kinds of code offsets. */
+#define AOT_JUMP  1
+#define AOT_LABEL 2
+
+static struct str *emit(struct str *out, char *fmt, ...)
+{
+  char buffer[200];
+  va_list ap;
+
+  va_start(ap, fmt);
+  vsprintf(buffer, fmt, ap);
+  va_end(ap);
+
+  return str_append_raw(out, buffer, strlen(buffer));
+}
+
+/* Marks the kinds of each word of the verified code up to end. */
+static void aot_scan(UBYTE *code, INT end, UBYTE *kinds)
+{
+  struct program_instruction *instruction;
+  INT offset, i;
+
+  kinds[BYTECODE_HEADER_SIZE/BYTECODE_WORD] |= AOT_LABEL;
+  
+  for(offset = BYTECODE_HEADER_SIZE; offset < end; )
+  {
+    instruction = &program_instructions[code[offset]];
+
+    for(i = 1; i <= instruction->operands; i++)
+      if(instruction->labels & PROGRAM_OPERAND(i))
+	kinds[((INT *)(code + offset))[i]/BYTECODE_WORD] |= AOT_LABEL;
+      else if(instruction->jumps & PROGRAM_OPERAND(i))
+	kinds[((INT *)(code + offset))[i]/BYTECODE_WORD] |= AOT_JUMP;
+    
+    offset += (1 + instruction->operands)*BYTECODE_WORD;
+  }
+}
+
+static struct str *aot_instruction(struct str *out, UBYTE *pc)
+{
+  struct program_instruction *instruction;
+  char *separator = "";
+  INT i;
+
+  instruction = &program_instructions[pc[0]];
+
+  out = emit(out, "  INSTR_%s(", instruction->name);
+  for(i = 1; i <= instruction->registers; i++, separator = ", ")
+    out = emit(out, "%s%d", separator, (int)pc[i]);
+  for(i = 1; i <= instruction->operands; i++, separator = ", ")
+    out = emit(out, "%s%ld", separator, (long)((INT *)pc)[i]);
+  
+  return emit(out, ");\n");
+}
+
+/* Translates the code of a program to the C function of the bootstrap.
+   Each instruction is written as its macro, preceded by a C label if
+   it is jumped to.  Labels may also be jumped to from other programs,
+   so the function dispatches on its offset to them. */
+BIF_DECLARE(bif_compiler_program_to_native_c)
+{
+  struct svalue constants;
+  struct str *code, *out;
+  UBYTE *kinds, *pc;
+  INT end, offset;
+  char *msg;
+  
+  ARGS_GET((process, "compiler-program->native-c", args, "%s", &code));
+
+  if((msg = program_check(code)) ||
+     (msg = program_constants(process, code, &constants)) ||
+     (msg = program_verify(code, &constants)))
+    ARGS_ERROR((process, "compiler-program->native-c", "%s", msg));
+  
+  end = ((INT *)code->s)[2];
+  kinds = mem_allocate_zeroed(end/BYTECODE_WORD + 1);
+  aot_scan((UBYTE *)code->s, end, kinds);
+  
+  out = str_allocate_raw(0);
+  out = emit(out, "#define BOOTSTRAP_NATIVE\n"
+	     "#define KERNEL_NATIVE\n"
+	     "#define KERNEL_CHECKED 0\n\n"
+	     "#include \"kernel.h\"\n\n"
+	     "static UBYTE *bootstrap_native(struct process *process, "
+	     "INT offset)\n{\n dispatch:\n  switch(offset)\n  {\n");
+  
+  for(offset = BYTECODE_HEADER_SIZE; offset < end; offset += BYTECODE_WORD)
+    if(kinds[offset/BYTECODE_WORD] & AOT_LABEL)
+      out = emit(out, "  case %ld: goto L%ld;\n", (long)offset, (long)offset);
+  
+  out = emit(out, "  }\n  return PROGRAM_PC(offset);\n\n"
+	     " trap:\n  NATIVE_TRAP;\n\n");
+
+  for(offset = BYTECODE_HEADER_SIZE; offset < end; )
+  {
+    if(kinds[offset/BYTECODE_WORD] & (AOT_JUMP | AOT_LABEL))
+      out = emit(out, " L%ld:\n", (long)offset);
+    
+    pc = (UBYTE *)code->s + offset;
+    if(pc[0] == I_lambda)
+      out = emit(out, "  NATIVE_ENTER(%ld);\n", (long)offset);
+    out = aot_instruction(out, pc);
+    offset += (1 + program_instructions[pc[0]].operands)*BYTECODE_WORD;
+  }
+  
+  out = emit(out, "  return 0;\n}\n");
+  mem_free(kinds);
+  
+  code = str_commit_raw(&process->str_heap, out);
+  BIF_RESULT_STRING(code);
+}
@@ -0,0 +1,17 @@
+/* aot.h
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the program to C compiler module.
+ */
+
+#ifndef __AOT_H__
+#define __AOT_H__
+
+#include "types.h"
+
+#include "bif.h"
+
+BIF_DECLARE(bif_compiler_program_to_native_c);
+
+#endif /* __AOT_H__ */
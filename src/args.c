@@ -82,7 +82,7 @@ static INT va_args_get(struct process *process, char *name,
   if(IS_NOT_PAIR(*args) && !opt)
     return args_error(process, name, "Too few arguments.");
   
-  for(p = (opt ? 0 : args->u.pair); *fmt; n++)
+  for(p = (IS_PAIR(*args) ? args->u.pair : 0); *fmt; n++)
   {
     switch(*fmt++)
     {
@@ -160,6 +160,16 @@ static INT va_args_get(struct process *process, char *name,
       *va_arg(ap, struct map **) = ASSIGN(arg->u.map);
       break;
       
+    case 'C':   /* Channel. */
+      CHECK_TYPE(arg, T_CHANNEL);
+      *va_arg(ap, struct channel **) = ASSIGN(arg->u.channel);
+      break;
+      
+    case 'F':   /* Future. */
+      CHECK_TYPE(arg, T_FUTURE);
+      *va_arg(ap, struct future **) = ASSIGN(arg->u.future);
+      break;
+      
     default:
       err_fatal("Unknown character '%c' int args_get format string.", *--fmt);
     }
@@ -26,6 +26,7 @@
 #include <fcntl.h>
 #endif /* HAVE_FCNTL_H */
 
+#include "aot.h"
 #include "args.h"
 #include "bif.h"
 #include "deb.h"
@@ -36,8 +37,12 @@
 #include "garb.h"
 #include "lexer.h"
 #include "process.h"
+#include "program.h"
 #include "version.h"
 #include "svalue.h"
+#include "thread.h"
+#include "channel.h"
+#include "future.h"
 #include "invocation.h"
 
 #define CONS(r, a, b)                                                      \
@@ -133,6 +138,8 @@ BIF_PREDICATE(bif_stringp,        "string?",        IS_STRING)
 BIF_PREDICATE(bif_symbolp,        "symbol?",        IS_SYMBOL)
 BIF_PREDICATE(bif_mappingp,       "mapping?",       IS_MAPPING)
 BIF_PREDICATE(bif_vectorp,        "vector?",        IS_VECTOR)
+BIF_PREDICATE(bif_channelp,       "channel?",       IS_CHANNEL)
+BIF_PREDICATE(bif_not,            "not",            IS_FALSE)
 
 /*
  * Equivalence predicates.
@@ -1525,6 +1532,62 @@ BIF_DECLARE(bif_vector_copy)
     vec2->v[i] = vec1->v[i];
 }
 
+/* Returns a list of n vectors, or as many as there are elements if
+   fewer, which have the elements of the given vector in turn. */
+BIF_DECLARE(bif_vector_split)
+{
+  struct svalue chunk;
+  struct vec *vec;
+  INT n, i, j, start, end;
+
+  ARGS_GET((process, "vector-split", args, "%v%i", &vec, &n));
+
+  if(n < 1)
+    ARGS_ERROR((process, "vector-split", "Number of vectors out of range."));
+  n = MAX(1, MIN(n, vec->length));
+
+  /* The list is made from the last vector.  Each vector is only held
+     here until it is consed, so room is made for the pairs first. */
+  pair_reserve(process, n);
+  result->type = T_NIL;
+  for(i = n; 0 < i; i--)
+  {
+    start = (INT)((double)vec->length * (i - 1) / n);
+    end = (INT)((double)vec->length * i / n);
+
+    chunk.u.vec = vec_allocate(&process->vec_heap, end - start);
+    chunk.type = T_VECTOR;
+    for(j = start; j < end; j++)
+      chunk.u.vec->v[j - start] = vec->v[j];
+
+    CONS(result, &chunk, result);
+  }
+}
+
+BIF_DECLARE(bif_vector_append)
+{
+  struct svalue *p;
+  struct vec *vec;
+  INT i, n;
+
+  n = 0;
+  for(p = args; IS_PAIR(*p); p = &CDR(p->u.pair))
+  {
+    if(IS_NOT_VECTOR(CAR(p->u.pair)))
+      ARGS_ERROR((process, "vector-append", "Vector expected."));
+    n += CAR(p->u.pair).u.vec->length;
+  }
+
+  vec = vec_allocate(&process->vec_heap, n);
+
+  n = 0;
+  for(p = args; IS_PAIR(*p); p = &CDR(p->u.pair))
+    for(i = 0; i < CAR(p->u.pair).u.vec->length; i++)
+      vec->v[n++] = CAR(p->u.pair).u.vec->v[i];
+
+  BIF_RESULT_VECTOR(vec);
+}
+
 BIF_DECLARE(bif_vector_fill)
 {
   struct svalue *value;
@@ -1886,15 +1949,34 @@ BIF_DECLARE(bif_trap_set)
   BIF_RESULT_UNDEFINED();
 }
 
+/* The program is loaded from a copy of the vector given, which the
+   caller cannot reach, so that the verified code stays with the
+   constants it was verified with. */
 BIF_DECLARE(bif_load_program)
 {
   struct svalue env;
-  struct vec *vec;
+  struct vec *vec, *given;
+  char *msg;
   
-  ARGS_GET((process, "load-program", args, "%v", &vec));
+  ARGS_GET((process, "load-program", args, "%v", &given));
 
+  if(given->length != PROGRAM_SIZE || IS_NOT_STRING(given->v[PROGRAM_CODE]))
+    ARGS_ERROR((process, "load-program", "Malformed program."));
+
+  vec = vec_allocate(&process->vec_heap, PROGRAM_SIZE);
+  mem_copy(vec->v, given->v, PROGRAM_SIZE*sizeof(struct svalue));
+  vec->v[PROGRAM_CODE].aux = 0;
+  
+  if((msg = program_check(vec->v[PROGRAM_CODE].u.str)) ||
+     (msg = program_constants(process, vec->v[PROGRAM_CODE].u.str,
+			      &vec->v[PROGRAM_CONSTANTS])) ||
+     (msg = program_verify(vec->v[PROGRAM_CODE].u.str,
+			   &vec->v[PROGRAM_CONSTANTS])))
+    ARGS_ERROR((process, "load-program", "%s", msg));
+  vec->v[PROGRAM_CODE].aux = PROGRAM_VERIFIED;
+  
   result->u.vec = vec;
-  result->aux = 0;
+  result->aux = BYTECODE_HEADER_SIZE;
   result->type = T_LABEL;
 
   env.type = T_NIL;
@@ -1920,15 +2002,21 @@ BIF_DECLARE(bif_float_size)
 BIF_DECLARE(bif_small_integer_to_bytes)
 {
   struct svalue b;
-  INT i, j;
+  union
+  {
+    INT i;
+    UBYTE b[sizeof(INT)];
+  } u;
+  INT i;
 
-  ARGS_GET((process, "integer->bytes", args, "%i", &j));
+  ARGS_GET((process, "small-integer->bytes", args, "%i", &u.i));
 
+  /* The kernel reads integer operands in native byte order. */
   BIF_RESULT_NIL();
   b.type = T_SMALL_INTEGER;
-  for(i = (INT)sizeof(INT)-1; 0 <= i; i--, j >>= 8)
+  for(i = (INT)sizeof(INT)-1; 0 <= i; i--)
   {
-    b.u.integer = j & 0xff;
+    b.u.integer = u.b[i];
     CONS(result, &b, result);
   }
 }
@@ -2246,4 +2334,30 @@ struct bif bifs[] =
   {            "list-first", bif_list_first                    },
   {             "list-rest", bif_list_rest                     },
   {           "debug-pairs", bif_debug_pairs                   },
+  {                     "=", bif_eq                            },
+  {                   "not", bif_not                           },
+  {                   "jit", bif_jit                           },
+  {"compiler-program->native-c", bif_compiler_program_to_native_c  },
+  {           "debug-trace", bif_debug_trace                   },
+  {       "profile-opcodes", bif_profile_opcodes               },
+  {        "opcode-profile", bif_opcode_profile                },
+  {       "profile-samples", bif_profile_samples               },
+  {        "sample-profile", bif_sample_profile                },
+  {          "thread-spawn", bif_thread_spawn                  },
+  {          "thread-yield", bif_thread_yield                  },
+  {           "thread-join", bif_thread_join                   },
+  {          "thread-sleep", bif_thread_sleep                  },
+  {         "thread-budget", bif_thread_budget                 },
+  {         "process-spawn", bif_process_spawn                 },
+  {          "process-join", bif_process_join                  },
+  {              "channel?", bif_channelp                      },
+  {          "make-channel", bif_make_channel                  },
+  {          "channel-send", bif_channel_send                  },
+  {       "channel-receive", bif_channel_receive               },
+  {   "channel-try-receive", bif_channel_try_receive           },
+  {          "future-spawn", bif_future_spawn                  },
+  {          "future-touch", bif_future_touch                  },
+  {        "future-workers", bif_future_workers                },
+  {          "vector-split", bif_vector_split                  },
+  {         "vector-append", bif_vector_append                 },
  {    	                  0, 0                                 } };
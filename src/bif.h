@@ -23,6 +23,8 @@
 #define BIF_RESULT_SYMBOL(x)        SPECIFY_RESULT(T_SYMBOL, u.str, (x))
 #define BIF_RESULT_MAPPING(x)       SPECIFY_RESULT(T_MAPPING, u.map, (x))
 #define BIF_RESULT_VECTOR(x)        SPECIFY_RESULT(T_VECTOR, u.vec, (x))
+#define BIF_RESULT_CHANNEL(x)       SPECIFY_RESULT(T_CHANNEL, u.channel, (x))
+#define BIF_RESULT_FUTURE(x)        SPECIFY_RESULT(T_FUTURE, u.future, (x))
 #define BIF_RESULT_UNDEFINED()      (result->type = T_UNDEFINED)
 #define BIF_RESULT_NIL()            (result->type = T_NIL)
 #define BIF_RESULT_TRUE()           (result->type = T_TRUE)
@@ -92,6 +94,7 @@ BIF_DECLARE(bif_symbolp);
 BIF_DECLARE(bif_vector);
 
 BIF_DECLARE(bif_eq);
+BIF_DECLARE(bif_not);
 
 BIF_DECLARE(bif_cons);
 BIF_DECLARE(bif_car);
@@ -1,4 +1,4 @@
 unsigned char bootstrap_code[] =
-{ 0x1e,0x1a,0x00,0x00,0x00,0x86,0x01,0x02,0x01,0x01,0x0b,0x04,0x00,0x00,0x00,0x00,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0b,0x04,0x00,0x00,0x00,0x01,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x00,0x45,0x04,0x13,0x00,0x00,0x01,0x9e,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0f,0x00,0x00,0x00,0x5d,0x03,0x13,0x00,0x00,0x00,0xf3,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x78,0x12,0x00,0x00,0x00,0x8c,0x10,0x00,0x00,0x00,0x8e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x00,0xb2,0x10,0x00,0x00,0x00,0xb4,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x79,0x12,0x00,0x00,0x00,0xd8,0x10,0x00,0x00,0x00,0xda,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x06,0x05,0x04,0x14,0x11,0x00,0x00,0x01,0x05,0x12,0x00,0x00,0x01,0x03,0x10,0x00,0x00,0x01,0x05,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x01,0x17,0x03,0x13,0x00,0x00,0x01,0x95,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x78,0x12,0x00,0x00,0x01,0x46,0x10,0x00,0x00,0x01,0x48,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x01,0x5e,0x10,0x00,0x00,0x01,0x60,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x79,0x12,0x00,0x00,0x01,0x84,0x10,0x00,0x00,0x01,0x86,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x12,0x00,0x00,0x01,0x9b,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x01,0xbb,0x04,0x13,0x00,0x00,0x02,0xa8,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x78,0x12,0x00,0x00,0x01,0xe6,0x10,0x00,0x00,0x01,0xe8,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x02,0x55,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x01,0x00,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x78,0x12,0x00,0x00,0x02,0x24,0x10,0x00,0x00,0x02,0x26,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x02,0x44,0x10,0x00,0x00,0x02,0x3c,0x06,0x07,0x03,0x04,0x13,0x00,0x00,0x02,0x46,0x05,0x03,0x02,0x02,0x02,0x01,0x02,0x00,0x12,0x00,0x00,0x02,0x52,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x2d,0x4e,0x6f,0x20,0x63,0x61,0x74,0x63,0x68,0x2c,0x20,0x70,0x6c,0x65,0x61,0x73,0x65,0x20,0x69,0x6e,0x73,0x65,0x72,0x74,0x20,0x63,0x6f,0x69,0x6e,0x20,0x61,0x6e,0x64,0x20,0x70,0x6c,0x61,0x79,0x20,0x61,0x67,0x61,0x69,0x6e,0x2e,0x0a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x60,0x12,0x00,0x00,0x02,0xa5,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x01,0x02,0x0f,0x00,0x00,0x02,0xc7,0x03,0x13,0x00,0x00,0x02,0xdb,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x11,0x00,0x00,0x02,0xed,0x12,0x00,0x00,0x02,0xeb,0x10,0x00,0x00,0x02,0xed,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0x02,0xfd,0x03,0x13,0x00,0x00,0x03,0xaa,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x78,0x12,0x00,0x00,0x03,0x28,0x10,0x00,0x00,0x03,0x2a,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x03,0x80,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x45,0x52,0x52,0x4f,0x52,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x03,0x64,0x10,0x00,0x00,0x03,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x03,0x7d,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x79,0x12,0x00,0x00,0x03,0xa7,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x03,0xb5,0x10,0x00,0x00,0x03,0xb7,0x06,0x05,0x04,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x03,0xca,0x04,0x13,0x00,0x00,0x04,0x1d,0x16,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x01,0x00,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x78,0x12,0x00,0x00,0x04,0x0c,0x10,0x00,0x00,0x04,0x04,0x06,0x07,0x03,0x04,0x13,0x00,0x00,0x04,0x0e,0x05,0x03,0x02,0x02,0x02,0x01,0x02,0x00,0x12,0x00,0x00,0x04,0x1a,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x04,0x3a,0x04,0x13,0x00,0x00,0x06,0xb2,0x16,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x04,0x67,0x10,0x00,0x00,0x04,0x69,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x04,0x7f,0x10,0x00,0x00,0x04,0x81,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x05,0x38,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x04,0xae,0x10,0x00,0x00,0x04,0xb0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x04,0xc6,0x10,0x00,0x00,0x04,0xc8,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x05,0x35,0x01,0x01,0x01,0x02,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x05,0x45,0x52,0x52,0x4f,0x52,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x12,0x00,0x00,0x05,0x09,0x10,0x00,0x00,0x05,0x0b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x05,0x24,0x10,0x00,0x00,0x05,0x26,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x05,0x32,0x09,0x04,0x14,0x0a,0x04,0x14,0x0a,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x05,0x5c,0x10,0x00,0x00,0x05,0x5e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x05,0x74,0x10,0x00,0x00,0x05,0x76,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x06,0xaf,0x01,0x01,0x01,0x02,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x05,0x45,0x52,0x52,0x4f,0x52,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x12,0x00,0x00,0x05,0xb7,0x10,0x00,0x00,0x05,0xb9,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x05,0xd2,0x10,0x00,0x00,0x05,0xd4,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x06,0xac,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0x06,0x07,0x10,0x00,0x00,0x06,0x09,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x06,0x32,0x10,0x00,0x00,0x06,0x34,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x06,0x4d,0x10,0x00,0x00,0x06,0x4f,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x06,0xa9,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x12,0x00,0x00,0x06,0x80,0x10,0x00,0x00,0x06,0x82,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x06,0x98,0x10,0x00,0x00,0x06,0x9a,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x06,0xa6,0x09,0x04,0x14,0x0a,0x04,0x14,0x0a,0x04,0x14,0x0a,0x04,0x14,0x0a,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x06,0xcf,0x04,0x13,0x00,0x00,0x07,0xd8,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x06,0xfc,0x10,0x00,0x00,0x06,0xfe,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x00,0x07,0x14,0x10,0x00,0x00,0x07,0x16,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x03,0x20,0x2d,0x2d,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x00,0x07,0x3b,0x10,0x00,0x00,0x07,0x3d,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x07,0x63,0x10,0x00,0x00,0x07,0x65,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0x07,0x75,0x04,0x13,0x00,0x00,0x07,0xbf,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x01,0x20,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x00,0x07,0x9d,0x10,0x00,0x00,0x07,0x9f,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x00,0x07,0xbc,0x06,0x05,0x04,0x14,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x19,0x12,0x00,0x00,0x07,0xd5,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x07,0xf5,0x04,0x13,0x00,0x00,0x08,0x45,0x16,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x04,0x00,0x00,0x00,0x54,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x19,0x12,0x00,0x00,0x08,0x2e,0x10,0x00,0x00,0x08,0x30,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x55,0x12,0x00,0x00,0x08,0x42,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x08,0x62,0x04,0x13,0x00,0x00,0x08,0x80,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x08,0x7d,0x0a,0x04,0x14,0x09,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x0d,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x08,0xb5,0x04,0x13,0x00,0x00,0x08,0xf8,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x08,0xe0,0x10,0x00,0x00,0x08,0xe2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x08,0xf5,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x09,0x15,0x04,0x13,0x00,0x00,0x09,0x58,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x09,0x40,0x10,0x00,0x00,0x09,0x42,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x09,0x55,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x09,0x75,0x04,0x13,0x00,0x00,0x09,0xb8,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x09,0xa0,0x10,0x00,0x00,0x09,0xa2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x09,0xb5,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x09,0xd5,0x04,0x13,0x00,0x00,0x0a,0x18,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0a,0x00,0x10,0x00,0x00,0x0a,0x02,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0a,0x15,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0a,0x35,0x04,0x13,0x00,0x00,0x0a,0x92,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0a,0x62,0x10,0x00,0x00,0x0a,0x64,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0a,0x7a,0x10,0x00,0x00,0x0a,0x7c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0a,0x8f,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0a,0xaf,0x04,0x13,0x00,0x00,0x0b,0x0c,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0a,0xdc,0x10,0x00,0x00,0x0a,0xde,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0a,0xf4,0x10,0x00,0x00,0x0a,0xf6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0b,0x09,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0b,0x29,0x04,0x13,0x00,0x00,0x0b,0x86,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0b,0x56,0x10,0x00,0x00,0x0b,0x58,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0b,0x6e,0x10,0x00,0x00,0x0b,0x70,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0b,0x83,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0b,0xa3,0x04,0x13,0x00,0x00,0x0c,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0b,0xd0,0x10,0x00,0x00,0x0b,0xd2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0b,0xe8,0x10,0x00,0x00,0x0b,0xea,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0b,0xfd,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0c,0x1d,0x04,0x13,0x00,0x00,0x0c,0x7a,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0c,0x4a,0x10,0x00,0x00,0x0c,0x4c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0c,0x62,0x10,0x00,0x00,0x0c,0x64,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0c,0x77,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0c,0x97,0x04,0x13,0x00,0x00,0x0c,0xf4,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0c,0xc4,0x10,0x00,0x00,0x0c,0xc6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0c,0xdc,0x10,0x00,0x00,0x0c,0xde,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0c,0xf1,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0d,0x11,0x04,0x13,0x00,0x00,0x0d,0x6e,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0d,0x3e,0x10,0x00,0x00,0x0d,0x40,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0d,0x56,0x10,0x00,0x00,0x0d,0x58,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0d,0x6b,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0d,0x8b,0x04,0x13,0x00,0x00,0x0d,0xe8,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0d,0xb8,0x10,0x00,0x00,0x0d,0xba,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0d,0xd0,0x10,0x00,0x00,0x0d,0xd2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0d,0xe5,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0e,0x05,0x04,0x13,0x00,0x00,0x0e,0x7c,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0e,0x34,0x10,0x00,0x00,0x0e,0x36,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0e,0x4c,0x10,0x00,0x00,0x0e,0x4e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0e,0x64,0x10,0x00,0x00,0x0e,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0e,0x79,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0e,0x99,0x04,0x13,0x00,0x00,0x0f,0x10,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0e,0xc8,0x10,0x00,0x00,0x0e,0xca,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0e,0xe0,0x10,0x00,0x00,0x0e,0xe2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x0e,0xf8,0x10,0x00,0x00,0x0e,0xfa,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0f,0x0d,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x0f,0x2d,0x04,0x13,0x00,0x00,0x10,0xd7,0x16,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x0f,0x5a,0x10,0x00,0x00,0x0f,0x5c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x0f,0x72,0x10,0x00,0x00,0x0f,0x74,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x0f,0x80,0x08,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x9a,0x12,0x00,0x00,0x0f,0xac,0x10,0x00,0x00,0x0f,0xae,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x74,0x12,0x00,0x00,0x0f,0xc4,0x10,0x00,0x00,0x0f,0xc6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x0f,0xeb,0x10,0x00,0x00,0x0f,0xed,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x10,0x06,0x10,0x00,0x00,0x10,0x08,0x06,0x05,0x04,0x07,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x12,0x00,0x00,0x10,0x22,0x10,0x00,0x00,0x10,0x24,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x99,0x12,0x00,0x00,0x10,0x51,0x10,0x00,0x00,0x10,0x53,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x74,0x12,0x00,0x00,0x10,0x69,0x10,0x00,0x00,0x10,0x6b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x10,0x85,0x10,0x00,0x00,0x10,0x87,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x10,0xa0,0x10,0x00,0x00,0x10,0xa2,0x06,0x05,0x04,0x07,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x10,0xbc,0x10,0x00,0x00,0x10,0xbe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x10,0xd4,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x10,0xf4,0x04,0x13,0x00,0x00,0x12,0x80,0x16,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x11,0x21,0x10,0x00,0x00,0x11,0x23,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x11,0x39,0x10,0x00,0x00,0x11,0x3b,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x11,0x47,0x0a,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x99,0x12,0x00,0x00,0x11,0x71,0x10,0x00,0x00,0x11,0x73,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x74,0x12,0x00,0x00,0x11,0x89,0x10,0x00,0x00,0x11,0x8b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x11,0xa5,0x10,0x00,0x00,0x11,0xa7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x11,0xc0,0x10,0x00,0x00,0x11,0xc2,0x06,0x05,0x04,0x07,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x11,0xdc,0x10,0x00,0x00,0x11,0xde,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x9a,0x12,0x00,0x00,0x12,0x0a,0x10,0x00,0x00,0x12,0x0c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x74,0x12,0x00,0x00,0x12,0x22,0x10,0x00,0x00,0x12,0x24,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x12,0x49,0x10,0x00,0x00,0x12,0x4b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x12,0x64,0x10,0x00,0x00,0x12,0x66,0x06,0x05,0x04,0x07,0x00,0x04,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x19,0x12,0x00,0x00,0x12,0x7d,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x12,0x9d,0x04,0x13,0x00,0x00,0x13,0x46,0x16,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x0f,0x00,0x00,0x12,0xb1,0x03,0x13,0x00,0x00,0x13,0x33,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x74,0x12,0x00,0x00,0x12,0xe0,0x10,0x00,0x00,0x12,0xe2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x12,0xfc,0x10,0x00,0x00,0x12,0xfe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x13,0x17,0x10,0x00,0x00,0x13,0x19,0x06,0x05,0x04,0x07,0x00,0x04,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x13,0x30,0x06,0x05,0x04,0x14,0x11,0x00,0x00,0x13,0x45,0x12,0x00,0x00,0x13,0x43,0x10,0x00,0x00,0x13,0x45,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0b,0x04,0x00,0x00,0x00,0x00,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0c,0x04,0x00,0x00,0x00,0x00,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x13,0x93,0x04,0x13,0x00,0x00,0x14,0x2b,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x13,0xbe,0x10,0x00,0x00,0x13,0xc0,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x14,0x28,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x13,0xfc,0x10,0x00,0x00,0x13,0xfe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x14,0x17,0x10,0x00,0x00,0x14,0x19,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x14,0x25,0x09,0x04,0x14,0x0a,0x04,0x14,0x0a,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x14,0x48,0x04,0x13,0x00,0x00,0x15,0xc8,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x14,0x73,0x10,0x00,0x00,0x14,0x75,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x14,0x89,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x14,0xbc,0x10,0x00,0x00,0x14,0xbe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x67,0x12,0x00,0x00,0x14,0xd7,0x10,0x00,0x00,0x14,0xd9,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x15,0x32,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x15,0x13,0x10,0x00,0x00,0x15,0x15,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1e,0x12,0x00,0x00,0x15,0x2f,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x15,0x67,0x10,0x00,0x00,0x15,0x69,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1e,0x12,0x00,0x00,0x15,0x86,0x10,0x00,0x00,0x15,0x88,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x15,0xad,0x10,0x00,0x00,0x15,0xaf,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x15,0xc5,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x15,0xe5,0x04,0x13,0x00,0x00,0x17,0x5d,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x16,0x10,0x10,0x00,0x00,0x16,0x12,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x16,0x1e,0x08,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x16,0x51,0x10,0x00,0x00,0x16,0x53,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x67,0x12,0x00,0x00,0x16,0x6c,0x10,0x00,0x00,0x16,0x6e,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x16,0xc7,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x16,0xa8,0x10,0x00,0x00,0x16,0xaa,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1f,0x12,0x00,0x00,0x16,0xc4,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x16,0xfc,0x10,0x00,0x00,0x16,0xfe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1f,0x12,0x00,0x00,0x17,0x1b,0x10,0x00,0x00,0x17,0x1d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x17,0x42,0x10,0x00,0x00,0x17,0x44,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x17,0x5a,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x17,0x7a,0x04,0x13,0x00,0x00,0x19,0x0e,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0x17,0xa5,0x10,0x00,0x00,0x17,0xa7,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x17,0xb9,0x03,0x13,0x00,0x00,0x19,0x05,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x17,0xdc,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x02,0x12,0x00,0x00,0x17,0xfe,0x10,0x00,0x00,0x18,0x00,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x18,0x12,0x03,0x13,0x00,0x00,0x18,0xfc,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x18,0x35,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x18,0x57,0x10,0x00,0x00,0x18,0x59,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x18,0x6b,0x03,0x13,0x00,0x00,0x18,0xf3,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x18,0x8e,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x08,0x12,0x00,0x00,0x18,0xb0,0x10,0x00,0x00,0x18,0xb2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x18,0xc4,0x03,0x13,0x00,0x00,0x18,0xea,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x18,0xe7,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x00,0x18,0xf0,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x18,0xf9,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x19,0x02,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x19,0x0b,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x6f,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x0a,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x09,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x19,0x8f,0x04,0x13,0x00,0x00,0x1a,0x23,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0x19,0xc0,0x10,0x00,0x00,0x19,0xc2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0x19,0xd8,0x10,0x00,0x00,0x19,0xda,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x1a,0x03,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0x1a,0x00,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x1a,0x20,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x1a,0x40,0x04,0x13,0x00,0x00,0x1b,0x26,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0x1a,0x71,0x10,0x00,0x00,0x1a,0x73,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0x1a,0x89,0x10,0x00,0x00,0x1a,0x8b,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x1a,0xb4,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x12,0x00,0x00,0x1a,0xb1,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x1a,0xdc,0x10,0x00,0x00,0x1a,0xde,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x12,0x00,0x00,0x1b,0x07,0x10,0x00,0x00,0x1b,0x09,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x12,0x00,0x00,0x1b,0x23,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x1b,0x43,0x04,0x13,0x00,0x00,0x1b,0xa4,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x1b,0x7c,0x10,0x00,0x00,0x1b,0x7e,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x1b,0xa1,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x1b,0xc1,0x04,0x13,0x00,0x00,0x1b,0xfa,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x0d,0x04,0x00,0x00,0x00,0x06,0x64,0x65,0x66,0x69,0x6e,0x65,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1d,0x12,0x00,0x00,0x1b,0xf7,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x1c,0x17,0x04,0x13,0x00,0x00,0x1c,0xab,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0x1c,0x48,0x10,0x00,0x00,0x1c,0x4a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0x1c,0x60,0x10,0x00,0x00,0x1c,0x62,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x1c,0x8b,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0x1c,0x88,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x1c,0xa8,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x1c,0xc8,0x04,0x13,0x00,0x00,0x1d,0xae,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0x1c,0xf9,0x10,0x00,0x00,0x1c,0xfb,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0x1d,0x11,0x10,0x00,0x00,0x1d,0x13,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x1d,0x3c,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x12,0x00,0x00,0x1d,0x39,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x1d,0x64,0x10,0x00,0x00,0x1d,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x12,0x00,0x00,0x1d,0x8f,0x10,0x00,0x00,0x1d,0x91,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x12,0x00,0x00,0x1d,0xab,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2a,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x1d,0xcb,0x04,0x13,0x00,0x00,0x1e,0x03,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x0d,0x04,0x00,0x00,0x00,0x05,0x62,0x65,0x67,0x69,0x6e,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1d,0x12,0x00,0x00,0x1e,0x00,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x10,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x1e,0x70,0x04,0x13,0x00,0x00,0x1f,0x05,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x15,0x12,0x00,0x00,0x1e,0xa3,0x10,0x00,0x00,0x1e,0xa5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x1e,0xbb,0x10,0x00,0x00,0x1e,0xbd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x12,0x00,0x00,0x1e,0xd7,0x10,0x00,0x00,0x1e,0xd9,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x1f,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x16,0x12,0x00,0x00,0x1e,0xff,0x06,0x05,0x04,0x14,0x09,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x05,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x0f,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x10,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x0f,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x10,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x20,0x0a,0x04,0x13,0x00,0x00,0x20,0x4d,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x20,0x35,0x10,0x00,0x00,0x20,0x37,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x20,0x4a,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x20,0x6a,0x04,0x13,0x00,0x00,0x22,0x91,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x20,0x95,0x10,0x00,0x00,0x20,0x97,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x20,0xa9,0x03,0x13,0x00,0x00,0x22,0x88,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x20,0xd4,0x10,0x00,0x00,0x20,0xd6,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x21,0x21,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x09,0x04,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x21,0x1e,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0a,0x04,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x21,0x76,0x10,0x00,0x00,0x21,0x78,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x21,0xa8,0x10,0x00,0x00,0x21,0xaa,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x21,0xc3,0x10,0x00,0x00,0x21,0xc5,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x61,0x6e,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x21,0xe8,0x10,0x00,0x00,0x21,0xea,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x22,0x03,0x10,0x00,0x00,0x22,0x05,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x22,0x2a,0x10,0x00,0x00,0x22,0x2c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x22,0x45,0x10,0x00,0x00,0x22,0x47,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x22,0x69,0x10,0x00,0x00,0x22,0x6b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x22,0x85,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x22,0x8e,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x22,0xae,0x04,0x13,0x00,0x00,0x25,0xb6,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x22,0xd9,0x10,0x00,0x00,0x22,0xdb,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x22,0xed,0x03,0x13,0x00,0x00,0x25,0xad,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x23,0x18,0x10,0x00,0x00,0x23,0x1a,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x23,0x65,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0a,0x04,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x23,0x62,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x23,0xdb,0x10,0x00,0x00,0x23,0xdd,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x23,0xf6,0x10,0x00,0x00,0x23,0xf8,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x24,0x1a,0x10,0x00,0x00,0x24,0x1c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x24,0x35,0x10,0x00,0x00,0x24,0x37,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x78,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x24,0x58,0x10,0x00,0x00,0x24,0x5a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x78,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x24,0x7b,0x10,0x00,0x00,0x24,0x7d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x24,0x9f,0x10,0x00,0x00,0x24,0xa1,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x24,0xba,0x10,0x00,0x00,0x24,0xbc,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x24,0xf5,0x10,0x00,0x00,0x24,0xf7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x25,0x10,0x10,0x00,0x00,0x25,0x12,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x78,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x25,0x33,0x10,0x00,0x00,0x25,0x35,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x25,0x4e,0x10,0x00,0x00,0x25,0x50,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x25,0x69,0x10,0x00,0x00,0x25,0x6b,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x6c,0x65,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x25,0x8e,0x10,0x00,0x00,0x25,0x90,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x25,0xaa,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x25,0xb3,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x25,0xd3,0x04,0x13,0x00,0x00,0x28,0x68,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x07,0x0f,0x00,0x00,0x25,0xe7,0x04,0x13,0x00,0x00,0x26,0x3c,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0x26,0x16,0x10,0x00,0x00,0x26,0x18,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x04,0x00,0x00,0x00,0x0f,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x18,0x12,0x00,0x00,0x26,0x39,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0f,0x00,0x00,0x26,0x51,0x04,0x13,0x00,0x00,0x26,0xaa,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0x26,0x80,0x10,0x00,0x00,0x26,0x82,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0b,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x18,0x12,0x00,0x00,0x26,0xa7,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x0f,0x00,0x00,0x26,0xbf,0x04,0x13,0x00,0x00,0x26,0xe8,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x26,0xe5,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x27,0x50,0x10,0x00,0x00,0x27,0x52,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x27,0x6b,0x10,0x00,0x00,0x27,0x6d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x12,0x00,0x00,0x27,0xa5,0x10,0x00,0x00,0x27,0xa7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x27,0xc0,0x10,0x00,0x00,0x27,0xc2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x27,0xeb,0x10,0x00,0x00,0x27,0xed,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x28,0x06,0x10,0x00,0x00,0x28,0x08,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x28,0x2e,0x10,0x00,0x00,0x28,0x30,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x28,0x49,0x10,0x00,0x00,0x28,0x4b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x28,0x65,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x28,0x85,0x04,0x13,0x00,0x00,0x2e,0x78,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x08,0x0f,0x00,0x00,0x28,0x99,0x04,0x13,0x00,0x00,0x28,0xc2,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0a,0x12,0x00,0x00,0x28,0xbf,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0f,0x00,0x00,0x28,0xd7,0x04,0x13,0x00,0x00,0x29,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0c,0x12,0x00,0x00,0x28,0xfd,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x0f,0x00,0x00,0x29,0x15,0x04,0x13,0x00,0x00,0x29,0x48,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x0d,0x04,0x00,0x00,0x00,0x04,0x65,0x6c,0x73,0x65,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x29,0x45,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x0f,0x00,0x00,0x29,0x5d,0x04,0x13,0x00,0x00,0x2d,0xe4,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x29,0x88,0x10,0x00,0x00,0x29,0x8a,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x29,0x96,0x0a,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x29,0xbe,0x10,0x00,0x00,0x29,0xc0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x12,0x00,0x00,0x29,0xda,0x10,0x00,0x00,0x29,0xdc,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x2a,0x56,0x01,0x01,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x2a,0x14,0x10,0x00,0x00,0x2a,0x16,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x2a,0x2f,0x10,0x00,0x00,0x2a,0x31,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x62,0x65,0x67,0x69,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2a,0x53,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x2a,0x7e,0x10,0x00,0x00,0x2a,0x80,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x2a,0x96,0x10,0x00,0x00,0x2a,0x98,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x2c,0x7b,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x2a,0xe1,0x10,0x00,0x00,0x2a,0xe3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x12,0x00,0x00,0x2a,0xfd,0x10,0x00,0x00,0x2a,0xff,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2b,0x18,0x10,0x00,0x00,0x2b,0x1a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x74,0x6d,0x70,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2b,0x3d,0x10,0x00,0x00,0x2b,0x3f,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x74,0x6d,0x70,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2b,0x62,0x10,0x00,0x00,0x2b,0x64,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2b,0x86,0x10,0x00,0x00,0x2b,0x88,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2b,0xa1,0x10,0x00,0x00,0x2b,0xa3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x2b,0xe0,0x10,0x00,0x00,0x2b,0xe2,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2b,0xfb,0x10,0x00,0x00,0x2b,0xfd,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x74,0x6d,0x70,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2c,0x20,0x10,0x00,0x00,0x2c,0x22,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2c,0x3b,0x10,0x00,0x00,0x2c,0x3d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2c,0x56,0x10,0x00,0x00,0x2c,0x58,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x6c,0x65,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2c,0x78,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x2c,0xb0,0x10,0x00,0x00,0x2c,0xb2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x12,0x00,0x00,0x2c,0xcc,0x10,0x00,0x00,0x2c,0xce,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2c,0xe7,0x10,0x00,0x00,0x2c,0xe9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x2d,0x1d,0x10,0x00,0x00,0x2d,0x1f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x2d,0x38,0x10,0x00,0x00,0x2d,0x3a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x62,0x65,0x67,0x69,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2d,0x5f,0x10,0x00,0x00,0x2d,0x61,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2d,0x7a,0x10,0x00,0x00,0x2d,0x7c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x2d,0xa5,0x10,0x00,0x00,0x2d,0xa7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2d,0xc0,0x10,0x00,0x00,0x2d,0xc2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x2d,0xe1,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x2e,0x3d,0x10,0x00,0x00,0x2e,0x3f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x12,0x00,0x00,0x2e,0x59,0x10,0x00,0x00,0x2e,0x5b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x2e,0x75,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x2e,0x95,0x04,0x13,0x00,0x00,0x2e,0xd2,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x0d,0x04,0x00,0x00,0x00,0x0a,0x71,0x75,0x61,0x73,0x69,0x71,0x75,0x6f,0x74,0x65,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1d,0x12,0x00,0x00,0x2e,0xcf,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x2e,0xef,0x04,0x13,0x00,0x00,0x36,0x52,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x07,0x0f,0x00,0x00,0x2f,0x03,0x04,0x13,0x00,0x00,0x2f,0x3d,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x0d,0x04,0x00,0x00,0x00,0x07,0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1d,0x12,0x00,0x00,0x2f,0x3a,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0f,0x00,0x00,0x2f,0x52,0x04,0x13,0x00,0x00,0x2f,0x95,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x0d,0x04,0x00,0x00,0x00,0x10,0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x2d,0x73,0x70,0x6c,0x69,0x63,0x69,0x6e,0x67,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1d,0x12,0x00,0x00,0x2f,0x92,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x0f,0x00,0x00,0x2f,0xaa,0x04,0x13,0x00,0x00,0x35,0xac,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3e,0x12,0x00,0x00,0x2f,0xd9,0x10,0x00,0x00,0x2f,0xdb,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x30,0x5c,0x01,0x01,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0x30,0x12,0x10,0x00,0x00,0x30,0x14,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x23,0x12,0x00,0x00,0x30,0x3d,0x10,0x00,0x00,0x30,0x3f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x12,0x00,0x00,0x30,0x59,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x30,0x82,0x10,0x00,0x00,0x30,0x84,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x31,0x60,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0x30,0xbd,0x10,0x00,0x00,0x30,0xbf,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x30,0xe8,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x23,0x12,0x00,0x00,0x30,0xe5,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5e,0x12,0x00,0x00,0x31,0x16,0x10,0x00,0x00,0x31,0x18,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x23,0x12,0x00,0x00,0x31,0x41,0x10,0x00,0x00,0x31,0x43,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x12,0x00,0x00,0x31,0x5d,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x31,0x82,0x10,0x00,0x00,0x31,0x84,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x35,0x5d,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x31,0xb1,0x10,0x00,0x00,0x31,0xb3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x31,0xcd,0x10,0x00,0x00,0x31,0xcf,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x34,0x4b,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0x32,0x08,0x10,0x00,0x00,0x32,0x0a,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x33,0x15,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x32,0x53,0x10,0x00,0x00,0x32,0x55,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x12,0x00,0x00,0x32,0x72,0x10,0x00,0x00,0x32,0x74,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x32,0x8d,0x10,0x00,0x00,0x32,0x8f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x32,0xb6,0x10,0x00,0x00,0x32,0xb8,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x23,0x12,0x00,0x00,0x32,0xd2,0x10,0x00,0x00,0x32,0xd4,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x32,0xed,0x10,0x00,0x00,0x32,0xef,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x33,0x12,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x33,0x55,0x10,0x00,0x00,0x33,0x57,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x12,0x00,0x00,0x33,0x74,0x10,0x00,0x00,0x33,0x76,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x33,0x8f,0x10,0x00,0x00,0x33,0x91,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5e,0x12,0x00,0x00,0x33,0xc4,0x10,0x00,0x00,0x33,0xc6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x33,0xeb,0x10,0x00,0x00,0x33,0xed,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x12,0x00,0x00,0x34,0x0a,0x10,0x00,0x00,0x34,0x0c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x34,0x25,0x10,0x00,0x00,0x34,0x27,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x34,0x48,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x34,0x8b,0x10,0x00,0x00,0x34,0x8d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x12,0x00,0x00,0x34,0xaa,0x10,0x00,0x00,0x34,0xac,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x34,0xc5,0x10,0x00,0x00,0x34,0xc7,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x34,0xfd,0x10,0x00,0x00,0x34,0xff,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x12,0x00,0x00,0x35,0x1c,0x10,0x00,0x00,0x35,0x1e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x35,0x37,0x10,0x00,0x00,0x35,0x39,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x35,0x5a,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x35,0x85,0x10,0x00,0x00,0x35,0x87,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x35,0xa9,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x12,0x00,0x00,0x36,0x14,0x10,0x00,0x00,0x36,0x16,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x12,0x00,0x00,0x36,0x33,0x10,0x00,0x00,0x36,0x35,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x36,0x4f,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x36,0x8b,0x04,0x13,0x00,0x00,0x3b,0x45,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x0e,0x63,0x61,0x6c,0x6c,0x5f,0x63,0x63,0x5f,0x72,0x65,0x73,0x75,0x6d,0x65,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x46,0x12,0x00,0x00,0x36,0xc4,0x10,0x00,0x00,0x36,0xc6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x36,0xd8,0x03,0x13,0x00,0x00,0x3b,0x3c,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x37,0x16,0x10,0x00,0x00,0x37,0x18,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x37,0x74,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x37,0x45,0x10,0x00,0x00,0x37,0x47,0x06,0x05,0x04,0x03,0x00,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x37,0x6d,0x10,0x00,0x00,0x39,0x09,0x06,0x05,0x04,0x13,0x00,0x00,0x39,0x09,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x37,0xaa,0x10,0x00,0x00,0x37,0xac,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x37,0xd0,0x10,0x00,0x00,0x37,0xd2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x61,0x73,0x73,0x69,0x67,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x37,0xf8,0x10,0x00,0x00,0x37,0xfa,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x38,0x13,0x10,0x00,0x00,0x38,0x15,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x38,0x39,0x10,0x00,0x00,0x38,0x3b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x74,0x61,0x72,0x67,0x65,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x38,0x75,0x10,0x00,0x00,0x38,0x77,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x07,0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x38,0x9e,0x10,0x00,0x00,0x38,0xa0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x38,0xb9,0x10,0x00,0x00,0x38,0xbb,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x38,0xe8,0x10,0x00,0x00,0x38,0xea,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x39,0x07,0x10,0x00,0x00,0x39,0x09,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x71,0x12,0x00,0x00,0x39,0x31,0x10,0x00,0x00,0x39,0x33,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x04,0x00,0x04,0x00,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x60,0x12,0x00,0x00,0x39,0x79,0x10,0x00,0x00,0x39,0x7b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x39,0xba,0x10,0x00,0x00,0x39,0xbc,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x07,0x63,0x61,0x6c,0x6c,0x5f,0x63,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x39,0xe3,0x10,0x00,0x00,0x39,0xe5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x39,0xfe,0x10,0x00,0x00,0x3a,0x00,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x3a,0x2e,0x10,0x00,0x00,0x3a,0x30,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x3a,0x54,0x10,0x00,0x00,0x3a,0x56,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x70,0x72,0x6f,0x63,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x3a,0x84,0x10,0x00,0x00,0x3a,0x86,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x3a,0xa3,0x10,0x00,0x00,0x3a,0xa5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x04,0x00,0x04,0x00,0x0d,0x04,0x00,0x00,0x00,0x04,0x70,0x72,0x6f,0x63,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x40,0x12,0x00,0x00,0x3a,0xfe,0x10,0x00,0x00,0x3b,0x00,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x3b,0x1d,0x10,0x00,0x00,0x3b,0x1f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x3b,0x39,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x3b,0x42,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x3b,0x62,0x04,0x13,0x00,0x00,0x3c,0x06,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x3b,0xc0,0x10,0x00,0x00,0x3b,0xc2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x3b,0xe7,0x10,0x00,0x00,0x3b,0xe9,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x3c,0x03,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x3c,0x23,0x04,0x13,0x00,0x00,0x3d,0x49,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x3c,0x64,0x10,0x00,0x00,0x3c,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x3c,0x8a,0x10,0x00,0x00,0x3c,0x8c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x61,0x73,0x73,0x69,0x67,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x3c,0xb2,0x10,0x00,0x00,0x3c,0xb4,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x3c,0xcd,0x10,0x00,0x00,0x3c,0xcf,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x3c,0xfa,0x10,0x00,0x00,0x3c,0xfc,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x3d,0x1f,0x10,0x00,0x00,0x3d,0x21,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x71,0x12,0x00,0x00,0x3d,0x46,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0b,0x04,0xff,0xff,0xff,0xff,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x3d,0x7e,0x04,0x13,0x00,0x00,0x3d,0x98,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x04,0xff,0xff,0xff,0xff,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x44,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x3d,0xb5,0x04,0x13,0x00,0x00,0x3e,0x05,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x44,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0x3d,0xea,0x10,0x00,0x00,0x3d,0xec,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x44,0x02,0x01,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x44,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x3e,0x22,0x04,0x13,0x00,0x00,0x3e,0x65,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x3e,0x4d,0x10,0x00,0x00,0x3e,0x4f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x40,0x12,0x00,0x00,0x3e,0x62,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x3e,0x82,0x04,0x13,0x00,0x00,0x3e,0xd7,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x3e,0xbc,0x10,0x00,0x00,0x3e,0xbe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x41,0x12,0x00,0x00,0x3e,0xd4,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x3e,0xf4,0x04,0x13,0x00,0x00,0x3f,0xb7,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x48,0x12,0x00,0x00,0x3f,0x31,0x10,0x00,0x00,0x3f,0x33,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x3f,0x3f,0x0a,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x12,0x00,0x00,0x3f,0x67,0x10,0x00,0x00,0x3f,0x69,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x3f,0x9c,0x10,0x00,0x00,0x3f,0x9e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x42,0x12,0x00,0x00,0x3f,0xb4,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x3f,0xd4,0x04,0x13,0x00,0x00,0x42,0x98,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x0f,0x00,0x00,0x3f,0xe8,0x04,0x13,0x00,0x00,0x42,0x07,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x40,0x13,0x10,0x00,0x00,0x40,0x15,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x40,0xe6,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x40,0x12,0x00,0x00,0x40,0x42,0x10,0x00,0x00,0x40,0x44,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x40,0x6b,0x10,0x00,0x00,0x40,0x6d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x42,0x12,0x00,0x00,0x40,0x94,0x10,0x00,0x00,0x40,0x96,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x40,0xbc,0x10,0x00,0x00,0x40,0xbe,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x12,0x00,0x00,0x40,0xe3,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x41,0x08,0x10,0x00,0x00,0x41,0x0a,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x41,0x1e,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0x41,0x40,0x10,0x00,0x00,0x41,0x42,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x41,0xb4,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x40,0x12,0x00,0x00,0x41,0x6f,0x10,0x00,0x00,0x41,0x71,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x42,0x12,0x00,0x00,0x41,0xa3,0x10,0x00,0x00,0x41,0xa5,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x29,0x43,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x74,0x79,0x70,0x65,0x20,0x6f,0x66,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x3a,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x42,0x04,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x42,0x3b,0x10,0x00,0x00,0x42,0x3d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x42,0x53,0x10,0x00,0x00,0x42,0x55,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x12,0x00,0x00,0x42,0x72,0x10,0x00,0x00,0x42,0x74,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x42,0x95,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x42,0xb5,0x04,0x13,0x00,0x00,0x44,0x1a,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0f,0x00,0x00,0x42,0xda,0x04,0x13,0x00,0x00,0x43,0xf0,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x28,0x12,0x00,0x00,0x43,0x09,0x10,0x00,0x00,0x43,0x0b,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x43,0x68,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x29,0x12,0x00,0x00,0x43,0x49,0x10,0x00,0x00,0x43,0x4b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x49,0x12,0x00,0x00,0x43,0x65,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2b,0x12,0x00,0x00,0x43,0x8e,0x10,0x00,0x00,0x43,0x90,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x43,0xed,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2c,0x12,0x00,0x00,0x43,0xce,0x10,0x00,0x00,0x43,0xd0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4b,0x12,0x00,0x00,0x43,0xea,0x06,0x05,0x04,0x14,0x0a,0x04,0x14,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x19,0x12,0x00,0x00,0x44,0x09,0x10,0x00,0x00,0x44,0x0b,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x57,0x12,0x00,0x00,0x44,0x43,0x10,0x00,0x00,0x44,0x45,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0x44,0x55,0x03,0x13,0x00,0x00,0x47,0x32,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x0f,0x00,0x00,0x44,0x69,0x04,0x13,0x00,0x00,0x46,0xe0,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x44,0x94,0x10,0x00,0x00,0x44,0x96,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x45,0x91,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x41,0x12,0x00,0x00,0x44,0xcf,0x10,0x00,0x00,0x44,0xd1,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x44,0xe3,0x03,0x13,0x00,0x00,0x45,0x88,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x45,0x06,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x0f,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3a,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x45,0x45,0x10,0x00,0x00,0x45,0x47,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x45,0x59,0x03,0x13,0x00,0x00,0x45,0x7f,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x45,0x7c,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x00,0x45,0x85,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x45,0x8e,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x45,0xc4,0x10,0x00,0x00,0x45,0xc6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x41,0x12,0x00,0x00,0x45,0xdf,0x10,0x00,0x00,0x45,0xe1,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x46,0x5e,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x46,0x1d,0x10,0x00,0x00,0x46,0x1f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x41,0x12,0x00,0x00,0x46,0x38,0x10,0x00,0x00,0x46,0x3a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x46,0x5b,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x46,0x80,0x10,0x00,0x00,0x46,0x82,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0x46,0xb3,0x10,0x00,0x00,0x46,0xb5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0x46,0xdd,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0f,0x00,0x00,0x46,0xf1,0x04,0x14,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0x47,0x2f,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x47,0x3d,0x10,0x00,0x00,0x47,0x3f,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x0f,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x47,0x76,0x04,0x13,0x00,0x00,0x4a,0x02,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x34,0x12,0x00,0x00,0x47,0xe0,0x10,0x00,0x00,0x47,0xe2,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x48,0xa6,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4d,0x12,0x00,0x00,0x48,0x0f,0x10,0x00,0x00,0x48,0x11,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x61,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x41,0x12,0x00,0x00,0x48,0x35,0x10,0x00,0x00,0x48,0x37,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x48,0x97,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4d,0x12,0x00,0x00,0x48,0x62,0x10,0x00,0x00,0x48,0x64,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x61,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x41,0x12,0x00,0x00,0x48,0x90,0x10,0x00,0x00,0x48,0x88,0x06,0x07,0x03,0x04,0x13,0x00,0x00,0x49,0xf3,0x05,0x03,0x13,0x00,0x00,0x49,0xf3,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5d,0x13,0x00,0x00,0x49,0xf3,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x12,0x00,0x00,0x48,0xca,0x10,0x00,0x00,0x48,0xcc,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x48,0xe2,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x55,0x13,0x00,0x00,0x49,0xf3,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x12,0x00,0x00,0x49,0x06,0x10,0x00,0x00,0x49,0x08,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x49,0x1e,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x13,0x00,0x00,0x49,0xf3,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x21,0x12,0x00,0x00,0x49,0x42,0x10,0x00,0x00,0x49,0x44,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x49,0x5a,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x52,0x13,0x00,0x00,0x49,0xf3,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x12,0x00,0x00,0x49,0x7e,0x10,0x00,0x00,0x49,0x80,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x49,0x96,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x53,0x13,0x00,0x00,0x49,0xf3,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x27,0x43,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x74,0x79,0x70,0x65,0x3a,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x49,0xf1,0x10,0x00,0x00,0x49,0xe9,0x06,0x07,0x03,0x04,0x13,0x00,0x00,0x49,0xf3,0x05,0x03,0x02,0x02,0x02,0x01,0x02,0x00,0x12,0x00,0x00,0x49,0xff,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x4a,0x1f,0x04,0x13,0x00,0x00,0x4a,0x98,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2c,0x12,0x00,0x00,0x4a,0x79,0x10,0x00,0x00,0x4a,0x7b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x50,0x12,0x00,0x00,0x4a,0x95,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x4a,0xb5,0x04,0x13,0x00,0x00,0x4c,0xec,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x39,0x12,0x00,0x00,0x4a,0xe4,0x10,0x00,0x00,0x4a,0xe6,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x4b,0x5f,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x37,0x12,0x00,0x00,0x4b,0x40,0x10,0x00,0x00,0x4b,0x42,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x4b,0x5c,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x37,0x12,0x00,0x00,0x4b,0xb2,0x10,0x00,0x00,0x4b,0xb4,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x4b,0xd1,0x10,0x00,0x00,0x4b,0xd3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x4b,0xe5,0x03,0x13,0x00,0x00,0x4c,0xe3,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x38,0x12,0x00,0x00,0x4c,0x43,0x10,0x00,0x00,0x4c,0x45,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x12,0x00,0x00,0x4c,0x62,0x10,0x00,0x00,0x4c,0x64,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4c,0x9f,0x10,0x00,0x00,0x4c,0xa1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4c,0xc4,0x10,0x00,0x00,0x4c,0xc6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x4c,0xe0,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x4c,0xe9,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x4d,0x09,0x04,0x13,0x00,0x00,0x52,0xf4,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0x4d,0x3a,0x10,0x00,0x00,0x4d,0x3c,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x4d,0xe7,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4d,0x72,0x10,0x00,0x00,0x4d,0x74,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x4d,0x9e,0x0d,0x04,0x00,0x00,0x00,0x0b,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x74,0x72,0x75,0x65,0x13,0x00,0x00,0x4d,0xb0,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x66,0x61,0x6c,0x73,0x65,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4d,0xc5,0x10,0x00,0x00,0x4d,0xc7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4d,0xe0,0x10,0x00,0x00,0x52,0x7a,0x06,0x05,0x04,0x13,0x00,0x00,0x52,0x7a,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x02,0x12,0x00,0x00,0x4e,0x07,0x10,0x00,0x00,0x4e,0x09,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x4e,0xd9,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x15,0x12,0x00,0x00,0x4e,0x44,0x10,0x00,0x00,0x4e,0x46,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4e,0x5f,0x10,0x00,0x00,0x4e,0x61,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4e,0x85,0x10,0x00,0x00,0x4e,0x87,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4e,0xb7,0x10,0x00,0x00,0x4e,0xb9,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4e,0xd2,0x10,0x00,0x00,0x52,0x7a,0x06,0x05,0x04,0x13,0x00,0x00,0x52,0x7a,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x80,0x12,0x00,0x00,0x4e,0xf9,0x10,0x00,0x00,0x4e,0xfb,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x4f,0xb1,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4f,0x33,0x10,0x00,0x00,0x4f,0x35,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4f,0x59,0x10,0x00,0x00,0x4f,0x5b,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x14,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x73,0x6d,0x61,0x6c,0x6c,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4f,0x8f,0x10,0x00,0x00,0x4f,0x91,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x4f,0xaa,0x10,0x00,0x00,0x52,0x7a,0x06,0x05,0x04,0x13,0x00,0x00,0x52,0x7a,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x81,0x12,0x00,0x00,0x4f,0xd1,0x10,0x00,0x00,0x4f,0xd3,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x50,0x87,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x50,0x0b,0x10,0x00,0x00,0x50,0x0d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x50,0x31,0x10,0x00,0x00,0x50,0x33,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x12,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x62,0x69,0x67,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x50,0x65,0x10,0x00,0x00,0x50,0x67,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x50,0x80,0x10,0x00,0x00,0x52,0x7a,0x06,0x05,0x04,0x13,0x00,0x00,0x52,0x7a,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x84,0x12,0x00,0x00,0x50,0xa7,0x10,0x00,0x00,0x50,0xa9,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x51,0x57,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x50,0xe1,0x10,0x00,0x00,0x50,0xe3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x51,0x07,0x10,0x00,0x00,0x51,0x09,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x51,0x35,0x10,0x00,0x00,0x51,0x37,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x51,0x50,0x10,0x00,0x00,0x52,0x7a,0x06,0x05,0x04,0x13,0x00,0x00,0x52,0x7a,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x08,0x12,0x00,0x00,0x51,0x77,0x10,0x00,0x00,0x51,0x79,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x52,0x28,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x51,0xb1,0x10,0x00,0x00,0x51,0xb3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x51,0xd7,0x10,0x00,0x00,0x51,0xd9,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x52,0x06,0x10,0x00,0x00,0x52,0x08,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x52,0x21,0x10,0x00,0x00,0x52,0x7a,0x06,0x05,0x04,0x13,0x00,0x00,0x52,0x7a,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x24,0x49,0x6e,0x74,0x65,0x72,0x6e,0x61,0x6c,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x20,0x74,0x79,0x70,0x65,0x3a,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x52,0x78,0x10,0x00,0x00,0x52,0x7a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x52,0xa5,0x10,0x00,0x00,0x52,0xa7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x52,0xca,0x10,0x00,0x00,0x52,0xcc,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x71,0x12,0x00,0x00,0x52,0xf1,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x53,0x11,0x04,0x13,0x00,0x00,0x54,0xab,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x53,0x7f,0x10,0x00,0x00,0x53,0x81,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0x53,0x91,0x04,0x13,0x00,0x00,0x53,0xe8,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x53,0xc2,0x10,0x00,0x00,0x53,0xc4,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x53,0xe5,0x06,0x05,0x04,0x14,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x12,0x00,0x00,0x54,0x01,0x10,0x00,0x00,0x54,0x03,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x54,0x1c,0x10,0x00,0x00,0x54,0x1e,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x54,0x42,0x10,0x00,0x00,0x54,0x44,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x54,0x5d,0x10,0x00,0x00,0x54,0x5f,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x6c,0x69,0x73,0x74,0x2d,0x3e,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x54,0x8c,0x10,0x00,0x00,0x54,0x8e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x54,0xa8,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x54,0xc8,0x04,0x13,0x00,0x00,0x55,0xdd,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x3d,0x12,0x00,0x00,0x55,0x34,0x10,0x00,0x00,0x55,0x36,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x55,0x4f,0x10,0x00,0x00,0x55,0x51,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x55,0x75,0x10,0x00,0x00,0x55,0x77,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x55,0x90,0x10,0x00,0x00,0x55,0x92,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x6c,0x69,0x73,0x74,0x2d,0x3e,0x76,0x65,0x63,0x74,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x55,0xbe,0x10,0x00,0x00,0x55,0xc0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x55,0xda,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x55,0xfa,0x04,0x13,0x00,0x00,0x5d,0xe7,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x12,0x00,0x00,0x56,0x29,0x10,0x00,0x00,0x56,0x2b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x56,0x3d,0x03,0x13,0x00,0x00,0x5d,0xde,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x12,0x00,0x00,0x56,0x6c,0x10,0x00,0x00,0x56,0x6e,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x56,0xc1,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x51,0x12,0x00,0x00,0x56,0xbe,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x56,0xe3,0x10,0x00,0x00,0x56,0xe5,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x57,0xe8,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x57,0x25,0x10,0x00,0x00,0x57,0x27,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6e,0x69,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x57,0x51,0x10,0x00,0x00,0x57,0x53,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x57,0x6c,0x10,0x00,0x00,0x57,0x6e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x57,0x99,0x10,0x00,0x00,0x57,0x9b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x57,0xbe,0x10,0x00,0x00,0x57,0xc0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x71,0x12,0x00,0x00,0x57,0xe5,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x58,0x0a,0x10,0x00,0x00,0x58,0x0c,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x59,0xad,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x58,0x7c,0x10,0x00,0x00,0x58,0x7e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x58,0x97,0x10,0x00,0x00,0x58,0x99,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x58,0xbe,0x10,0x00,0x00,0x58,0xc0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x58,0xd9,0x10,0x00,0x00,0x58,0xdb,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x59,0x0b,0x10,0x00,0x00,0x59,0x0d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x59,0x26,0x10,0x00,0x00,0x59,0x28,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x59,0x4d,0x10,0x00,0x00,0x59,0x4f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x59,0x68,0x10,0x00,0x00,0x59,0x6a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x59,0x8e,0x10,0x00,0x00,0x59,0x90,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x59,0xaa,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0x59,0xcf,0x10,0x00,0x00,0x59,0xd1,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x5b,0x1d,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x37,0x12,0x00,0x00,0x5a,0x16,0x10,0x00,0x00,0x5a,0x18,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5a,0x31,0x10,0x00,0x00,0x5a,0x33,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5a,0x57,0x10,0x00,0x00,0x5a,0x59,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5a,0x86,0x10,0x00,0x00,0x5a,0x88,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5a,0xa1,0x10,0x00,0x00,0x5a,0xa3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5a,0xce,0x10,0x00,0x00,0x5a,0xd0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x5a,0xf3,0x10,0x00,0x00,0x5a,0xf5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x71,0x12,0x00,0x00,0x5b,0x1a,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x6f,0x12,0x00,0x00,0x5b,0x3f,0x10,0x00,0x00,0x5b,0x41,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x5c,0x58,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x5b,0xad,0x10,0x00,0x00,0x5b,0xaf,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5b,0xc8,0x10,0x00,0x00,0x5b,0xca,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5b,0xef,0x10,0x00,0x00,0x5b,0xf1,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5c,0x0a,0x10,0x00,0x00,0x5c,0x0c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x6c,0x69,0x73,0x74,0x2d,0x3e,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5c,0x39,0x10,0x00,0x00,0x5c,0x3b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x5c,0x55,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0a,0x12,0x00,0x00,0x5c,0x7a,0x10,0x00,0x00,0x5c,0x7c,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x5d,0x92,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x3d,0x12,0x00,0x00,0x5c,0xe8,0x10,0x00,0x00,0x5c,0xea,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5d,0x03,0x10,0x00,0x00,0x5d,0x05,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5d,0x2a,0x10,0x00,0x00,0x5d,0x2c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5d,0x45,0x10,0x00,0x00,0x5d,0x47,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x6c,0x69,0x73,0x74,0x2d,0x3e,0x76,0x65,0x63,0x74,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5d,0x73,0x10,0x00,0x00,0x5d,0x75,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x5d,0x8f,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x22,0x43,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x71,0x75,0x6f,0x74,0x65,0x20,0x74,0x79,0x70,0x65,0x3a,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x5d,0xdb,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x5d,0xe4,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x5e,0x04,0x04,0x13,0x00,0x00,0x60,0x75,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4c,0x12,0x00,0x00,0x5e,0x41,0x10,0x00,0x00,0x5e,0x43,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x5e,0x55,0x03,0x13,0x00,0x00,0x60,0x6c,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x75,0x12,0x00,0x00,0x5e,0x86,0x10,0x00,0x00,0x5e,0x88,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x5f,0x34,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5e,0xc0,0x10,0x00,0x00,0x5e,0xc2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5e,0xe6,0x10,0x00,0x00,0x5e,0xe8,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x62,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5f,0x12,0x10,0x00,0x00,0x5f,0x14,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5f,0x2d,0x10,0x00,0x00,0x5f,0xcd,0x06,0x05,0x04,0x13,0x00,0x00,0x5f,0xcd,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x5f,0x65,0x10,0x00,0x00,0x5f,0x67,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5f,0x8b,0x10,0x00,0x00,0x5f,0x8d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x67,0x65,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5f,0xb0,0x10,0x00,0x00,0x5f,0xb2,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x5f,0xcb,0x10,0x00,0x00,0x5f,0xcd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x5f,0xf4,0x10,0x00,0x00,0x5f,0xf6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x60,0x23,0x10,0x00,0x00,0x60,0x25,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x60,0x42,0x10,0x00,0x00,0x60,0x44,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x71,0x12,0x00,0x00,0x60,0x69,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x60,0x72,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x60,0x92,0x04,0x13,0x00,0x00,0x63,0x7d,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x0a,0x6c,0x61,0x6d,0x62,0x64,0x61,0x5f,0x65,0x6e,0x64,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x46,0x12,0x00,0x00,0x60,0xc9,0x10,0x00,0x00,0x60,0xcb,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x0d,0x04,0x00,0x00,0x00,0x0c,0x6c,0x61,0x6d,0x62,0x64,0x61,0x5f,0x65,0x6e,0x74,0x72,0x79,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x46,0x12,0x00,0x00,0x60,0xfc,0x10,0x00,0x00,0x60,0xfe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x61,0x13,0x03,0x13,0x00,0x00,0x63,0x74,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x61,0x4c,0x10,0x00,0x00,0x61,0x4e,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x61,0x64,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x13,0x00,0x00,0x61,0x6e,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x02,0x01,0x0f,0x00,0x00,0x61,0x7e,0x03,0x13,0x00,0x00,0x63,0x6b,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x58,0x12,0x00,0x00,0x61,0xdc,0x10,0x00,0x00,0x61,0xde,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x62,0x1c,0x10,0x00,0x00,0x62,0x1e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x62,0x42,0x10,0x00,0x00,0x62,0x44,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x62,0x71,0x10,0x00,0x00,0x62,0x73,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x62,0x8c,0x10,0x00,0x00,0x62,0x8e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x62,0xb5,0x10,0x00,0x00,0x62,0xb7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x62,0xe4,0x10,0x00,0x00,0x62,0xe6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x63,0x03,0x10,0x00,0x00,0x63,0x05,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x71,0x12,0x00,0x00,0x63,0x2d,0x10,0x00,0x00,0x63,0x2f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x70,0x12,0x00,0x00,0x63,0x4c,0x10,0x00,0x00,0x63,0x4e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x63,0x68,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x63,0x71,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x63,0x7a,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x63,0x9a,0x04,0x13,0x00,0x00,0x65,0x40,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x63,0xc5,0x10,0x00,0x00,0x63,0xc7,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x63,0xdb,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0x63,0xfd,0x10,0x00,0x00,0x63,0xff,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x64,0x4c,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0x64,0x34,0x10,0x00,0x00,0x64,0x36,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x5e,0x12,0x00,0x00,0x64,0x49,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0x64,0x6e,0x10,0x00,0x00,0x64,0x70,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x64,0xed,0x01,0x01,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0x64,0xa7,0x10,0x00,0x00,0x64,0xa9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x64,0xce,0x10,0x00,0x00,0x64,0xd0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x57,0x12,0x00,0x00,0x64,0xea,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x29,0x43,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x74,0x79,0x70,0x65,0x20,0x6f,0x66,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x3a,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x65,0x3d,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x57,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x65,0x5d,0x04,0x13,0x00,0x00,0x68,0xdd,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x12,0x00,0x00,0x65,0xa3,0x10,0x00,0x00,0x65,0xa5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4a,0x12,0x00,0x00,0x65,0xc2,0x10,0x00,0x00,0x65,0xc4,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x12,0x00,0x00,0x65,0xed,0x10,0x00,0x00,0x65,0xef,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4b,0x12,0x00,0x00,0x66,0x0c,0x10,0x00,0x00,0x66,0x0e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x12,0x00,0x00,0x66,0x37,0x10,0x00,0x00,0x66,0x39,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x66,0x4e,0x03,0x13,0x00,0x00,0x68,0xd4,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x72,0x65,0x74,0x75,0x72,0x6e,0x04,0x00,0x04,0x00,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x12,0x00,0x00,0x66,0xad,0x10,0x00,0x00,0x66,0xaf,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x12,0x00,0x00,0x66,0xcc,0x10,0x00,0x00,0x66,0xce,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x47,0x12,0x00,0x00,0x67,0x15,0x10,0x00,0x00,0x67,0x17,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x67,0x30,0x10,0x00,0x00,0x67,0x32,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x57,0x12,0x00,0x00,0x67,0x65,0x10,0x00,0x00,0x67,0x67,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x67,0x80,0x10,0x00,0x00,0x67,0x82,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x67,0xa8,0x10,0x00,0x00,0x67,0xaa,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x67,0xc3,0x10,0x00,0x00,0x67,0xc5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x67,0xe9,0x10,0x00,0x00,0x67,0xeb,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x68,0x17,0x10,0x00,0x00,0x68,0x19,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x68,0x4b,0x10,0x00,0x00,0x68,0x4d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x70,0x72,0x6f,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x68,0x71,0x10,0x00,0x00,0x68,0x73,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x68,0x96,0x10,0x00,0x00,0x68,0x98,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x68,0xb5,0x10,0x00,0x00,0x68,0xb7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x68,0xd1,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x68,0xda,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x68,0xfa,0x04,0x13,0x00,0x00,0x6b,0x8e,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x25,0x12,0x00,0x00,0x69,0x58,0x10,0x00,0x00,0x69,0x5a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4c,0x12,0x00,0x00,0x69,0x77,0x10,0x00,0x00,0x69,0x79,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x69,0x92,0x10,0x00,0x00,0x69,0x94,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x69,0xb8,0x10,0x00,0x00,0x69,0xba,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x73,0x65,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x69,0xdd,0x10,0x00,0x00,0x69,0xdf,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x69,0xf8,0x10,0x00,0x00,0x69,0xfa,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x6a,0x27,0x10,0x00,0x00,0x6a,0x29,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x6a,0x59,0x10,0x00,0x00,0x6a,0x5b,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x6a,0x7e,0x10,0x00,0x00,0x6a,0x80,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x6a,0x9d,0x10,0x00,0x00,0x6a,0x9f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x12,0x00,0x00,0x6a,0xf7,0x10,0x00,0x00,0x6a,0xf9,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x6b,0x16,0x10,0x00,0x00,0x6b,0x18,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x6b,0x45,0x10,0x00,0x00,0x6b,0x47,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x6b,0x64,0x10,0x00,0x00,0x6b,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x71,0x12,0x00,0x00,0x6b,0x8b,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x6b,0xab,0x04,0x13,0x00,0x00,0x70,0x84,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x06,0x69,0x66,0x5f,0x65,0x6e,0x64,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x46,0x12,0x00,0x00,0x6b,0xde,0x10,0x00,0x00,0x6b,0xe0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x0d,0x04,0x00,0x00,0x00,0x08,0x69,0x66,0x5f,0x66,0x61,0x6c,0x73,0x65,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x46,0x12,0x00,0x00,0x6c,0x0f,0x10,0x00,0x00,0x6c,0x11,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x0d,0x04,0x00,0x00,0x00,0x07,0x69,0x66,0x5f,0x74,0x72,0x75,0x65,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x46,0x12,0x00,0x00,0x6c,0x40,0x10,0x00,0x00,0x6c,0x42,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x6c,0x57,0x03,0x13,0x00,0x00,0x70,0x7b,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x6c,0x90,0x10,0x00,0x00,0x6c,0x92,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x6c,0xa8,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x13,0x00,0x00,0x6c,0xb2,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x02,0x01,0x0f,0x00,0x00,0x6c,0xc2,0x03,0x13,0x00,0x00,0x70,0x72,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x2f,0x12,0x00,0x00,0x6d,0x20,0x10,0x00,0x00,0x6d,0x22,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x6d,0x3f,0x10,0x00,0x00,0x6d,0x41,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x2e,0x12,0x00,0x00,0x6d,0x99,0x10,0x00,0x00,0x6d,0x9b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x6d,0xb8,0x10,0x00,0x00,0x6d,0xba,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x04,0x00,0x04,0x00,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x2d,0x12,0x00,0x00,0x6e,0x12,0x10,0x00,0x00,0x6e,0x14,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x6e,0x31,0x10,0x00,0x00,0x6e,0x33,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x6e,0x48,0x03,0x13,0x00,0x00,0x70,0x69,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x6e,0x9e,0x10,0x00,0x00,0x6e,0xa0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x6e,0xd7,0x10,0x00,0x00,0x6e,0xd9,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6f,0x12,0x00,0x00,0x6e,0xf6,0x10,0x00,0x00,0x6e,0xf8,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x6f,0x35,0x10,0x00,0x00,0x6f,0x37,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x62,0x72,0x61,0x6e,0x63,0x68,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x6f,0x5d,0x10,0x00,0x00,0x6f,0x5f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x6f,0x78,0x10,0x00,0x00,0x6f,0x7a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x08,0x04,0x04,0x00,0x04,0x00,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x6f,0xaa,0x10,0x00,0x00,0x6f,0xac,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x6f,0xc9,0x10,0x00,0x00,0x6f,0xcb,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x6f,0xe8,0x10,0x00,0x00,0x6f,0xea,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x70,0x25,0x10,0x00,0x00,0x70,0x27,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x70,0x4a,0x10,0x00,0x00,0x70,0x4c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x70,0x66,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x70,0x6f,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x70,0x78,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x70,0x81,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5a,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x70,0xa1,0x04,0x13,0x00,0x00,0x74,0xdc,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x60,0x12,0x00,0x00,0x70,0xf2,0x10,0x00,0x00,0x70,0xf4,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x04,0x00,0x04,0x00,0x0d,0x04,0x00,0x00,0x00,0x04,0x70,0x72,0x6f,0x63,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x32,0x12,0x00,0x00,0x71,0x4c,0x10,0x00,0x00,0x71,0x4e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x71,0x6b,0x10,0x00,0x00,0x71,0x6d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x71,0x9f,0x10,0x00,0x00,0x71,0xa1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x71,0xc5,0x10,0x00,0x00,0x71,0xc7,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x71,0xea,0x10,0x00,0x00,0x71,0xec,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x72,0x09,0x10,0x00,0x00,0x72,0x0b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x33,0x12,0x00,0x00,0x72,0x3c,0x10,0x00,0x00,0x72,0x3e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x64,0x12,0x00,0x00,0x72,0x54,0x10,0x00,0x00,0x72,0x56,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0x72,0x66,0x03,0x13,0x00,0x00,0x74,0x3f,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x04,0x00,0x04,0x00,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x72,0xd7,0x10,0x00,0x00,0x72,0xd9,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x72,0xf2,0x10,0x00,0x00,0x72,0xf4,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x09,0x6c,0x69,0x73,0x74,0x2d,0x63,0x6f,0x70,0x79,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x73,0x1d,0x10,0x00,0x00,0x73,0x1f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x73,0x38,0x10,0x00,0x00,0x73,0x3a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x73,0x6c,0x10,0x00,0x00,0x73,0x6e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x64,0x12,0x00,0x00,0x73,0x84,0x10,0x00,0x00,0x73,0x86,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x73,0x9f,0x10,0x00,0x00,0x73,0xa1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x73,0xc5,0x10,0x00,0x00,0x73,0xc7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x73,0xe0,0x10,0x00,0x00,0x73,0xe2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x74,0x08,0x10,0x00,0x00,0x74,0x0a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x74,0x27,0x10,0x00,0x00,0x74,0x29,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x74,0x3c,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x74,0x4a,0x10,0x00,0x00,0x74,0x4c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5c,0x12,0x00,0x00,0x74,0x66,0x10,0x00,0x00,0x74,0x68,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x74,0x98,0x10,0x00,0x00,0x74,0x9a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x74,0xbd,0x10,0x00,0x00,0x74,0xbf,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x74,0xd9,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x74,0xf9,0x04,0x13,0x00,0x00,0x77,0xad,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x75,0x24,0x10,0x00,0x00,0x75,0x26,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x75,0xfd,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x75,0x64,0x10,0x00,0x00,0x75,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6e,0x69,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x75,0x90,0x10,0x00,0x00,0x75,0x92,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x75,0xab,0x10,0x00,0x00,0x75,0xad,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x75,0xd8,0x10,0x00,0x00,0x75,0xda,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x75,0xfa,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x76,0x21,0x10,0x00,0x00,0x76,0x23,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x76,0x62,0x10,0x00,0x00,0x76,0x64,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x76,0x88,0x10,0x00,0x00,0x76,0x8a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x61,0x73,0x73,0x69,0x67,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x76,0xb0,0x10,0x00,0x00,0x76,0xb2,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x76,0xcb,0x10,0x00,0x00,0x76,0xcd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x76,0xfa,0x10,0x00,0x00,0x76,0xfc,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x77,0x29,0x10,0x00,0x00,0x77,0x2b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x77,0x48,0x10,0x00,0x00,0x77,0x4a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x77,0x6f,0x10,0x00,0x00,0x77,0x71,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x77,0x8e,0x10,0x00,0x00,0x77,0x90,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5e,0x12,0x00,0x00,0x77,0xaa,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x77,0xca,0x04,0x13,0x00,0x00,0x7a,0x8c,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x60,0x12,0x00,0x00,0x78,0x1b,0x10,0x00,0x00,0x78,0x1d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x04,0x00,0x04,0x00,0x0d,0x04,0x00,0x00,0x00,0x04,0x70,0x72,0x6f,0x63,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x35,0x12,0x00,0x00,0x78,0x75,0x10,0x00,0x00,0x78,0x77,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x78,0x94,0x10,0x00,0x00,0x78,0x96,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x78,0xc8,0x10,0x00,0x00,0x78,0xca,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x78,0xee,0x10,0x00,0x00,0x78,0xf0,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x79,0x13,0x10,0x00,0x00,0x79,0x15,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x79,0x32,0x10,0x00,0x00,0x79,0x34,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x36,0x12,0x00,0x00,0x79,0x65,0x10,0x00,0x00,0x79,0x67,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0x79,0x77,0x04,0x13,0x00,0x00,0x79,0xc9,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x04,0x00,0x04,0x00,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0x79,0xc6,0x06,0x05,0x04,0x14,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x12,0x00,0x00,0x79,0xe2,0x10,0x00,0x00,0x79,0xe4,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x64,0x12,0x00,0x00,0x79,0xfa,0x10,0x00,0x00,0x79,0xfc,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5f,0x12,0x00,0x00,0x7a,0x16,0x10,0x00,0x00,0x7a,0x18,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7a,0x48,0x10,0x00,0x00,0x7a,0x4a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7a,0x6d,0x10,0x00,0x00,0x7a,0x6f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x7a,0x89,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x7a,0xa9,0x04,0x13,0x00,0x00,0x7d,0x77,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x7a,0xd4,0x10,0x00,0x00,0x7a,0xd6,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x7a,0xea,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x7b,0x12,0x10,0x00,0x00,0x7b,0x14,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7b,0x56,0x10,0x00,0x00,0x7b,0x58,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7b,0x7b,0x10,0x00,0x00,0x7b,0x7d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7b,0xa1,0x10,0x00,0x00,0x7b,0xa3,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7b,0xc7,0x10,0x00,0x00,0x7b,0xc9,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7b,0xe2,0x10,0x00,0x00,0x7b,0xe4,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7c,0x11,0x10,0x00,0x00,0x7c,0x13,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7c,0x43,0x10,0x00,0x00,0x7c,0x45,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7c,0x68,0x10,0x00,0x00,0x7c,0x6a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x7c,0x87,0x10,0x00,0x00,0x7c,0x89,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x7c,0xb0,0x10,0x00,0x00,0x7c,0xb2,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7c,0xe0,0x10,0x00,0x00,0x7c,0xe2,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x7c,0xff,0x10,0x00,0x00,0x7d,0x01,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5e,0x12,0x00,0x00,0x7d,0x1e,0x10,0x00,0x00,0x7d,0x20,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7d,0x58,0x10,0x00,0x00,0x7d,0x5a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0x7d,0x74,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5e,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x7d,0x94,0x04,0x13,0x00,0x00,0x80,0x46,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x7d,0xbf,0x10,0x00,0x00,0x7d,0xc1,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x7e,0x98,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7d,0xff,0x10,0x00,0x00,0x7e,0x01,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6e,0x69,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7e,0x2b,0x10,0x00,0x00,0x7e,0x2d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7e,0x46,0x10,0x00,0x00,0x7e,0x48,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7e,0x73,0x10,0x00,0x00,0x7e,0x75,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x7e,0x95,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x7e,0xbc,0x10,0x00,0x00,0x7e,0xbe,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7e,0xfd,0x10,0x00,0x00,0x7e,0xff,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7f,0x23,0x10,0x00,0x00,0x7f,0x25,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7f,0x49,0x10,0x00,0x00,0x7f,0x4b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7f,0x64,0x10,0x00,0x00,0x7f,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7f,0x93,0x10,0x00,0x00,0x7f,0x95,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x7f,0xc2,0x10,0x00,0x00,0x7f,0xc4,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x7f,0xe1,0x10,0x00,0x00,0x7f,0xe3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x80,0x08,0x10,0x00,0x00,0x80,0x0a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x80,0x27,0x10,0x00,0x00,0x80,0x29,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5e,0x12,0x00,0x00,0x80,0x43,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x80,0x63,0x04,0x13,0x00,0x00,0x89,0xb6,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x05,0x0f,0x00,0x00,0x80,0x77,0x04,0x13,0x00,0x00,0x85,0x8b,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x80,0xb3,0x10,0x00,0x00,0x80,0xb5,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x82,0x1f,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x06,0x72,0x65,0x74,0x75,0x72,0x6e,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x80,0xec,0x10,0x00,0x00,0x80,0xee,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x81,0x4c,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x70,0x70,0x6c,0x79,0x5f,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x81,0x2a,0x10,0x00,0x00,0x81,0x2c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x81,0x45,0x10,0x00,0x00,0x85,0x0c,0x06,0x05,0x04,0x13,0x00,0x00,0x85,0x0c,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x70,0x70,0x6c,0x79,0x5f,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x81,0x85,0x10,0x00,0x00,0x81,0x87,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x81,0xa0,0x10,0x00,0x00,0x81,0xa2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x81,0xcf,0x10,0x00,0x00,0x81,0xd1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x81,0xfd,0x10,0x00,0x00,0x81,0xff,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x82,0x18,0x10,0x00,0x00,0x85,0x0c,0x06,0x05,0x04,0x13,0x00,0x00,0x85,0x0c,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x06,0x72,0x65,0x74,0x75,0x72,0x6e,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x82,0x4f,0x10,0x00,0x00,0x82,0x51,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x82,0xb2,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x27,0x49,0x6e,0x74,0x65,0x72,0x6e,0x61,0x6c,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x52,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x69,0x6e,0x6b,0x61,0x67,0x65,0x20,0x6e,0x6f,0x74,0x20,0x76,0x61,0x6c,0x3a,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x82,0xab,0x10,0x00,0x00,0x85,0x0c,0x06,0x05,0x04,0x13,0x00,0x00,0x85,0x0c,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x0b,0x70,0x72,0x6f,0x63,0x5f,0x72,0x65,0x74,0x75,0x72,0x6e,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x46,0x12,0x00,0x00,0x82,0xdd,0x10,0x00,0x00,0x82,0xdf,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0x82,0xef,0x03,0x13,0x00,0x00,0x84,0xff,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x83,0x37,0x10,0x00,0x00,0x83,0x39,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x67,0x6f,0x74,0x6f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x83,0x5d,0x10,0x00,0x00,0x83,0x5f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x83,0x78,0x10,0x00,0x00,0x83,0x7a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x83,0xa8,0x10,0x00,0x00,0x83,0xaa,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x83,0xce,0x10,0x00,0x00,0x83,0xd0,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x61,0x73,0x73,0x69,0x67,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x83,0xf6,0x10,0x00,0x00,0x83,0xf8,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x84,0x11,0x10,0x00,0x00,0x84,0x13,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x84,0x37,0x10,0x00,0x00,0x84,0x39,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x70,0x70,0x6c,0x79,0x5f,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x84,0x6c,0x10,0x00,0x00,0x84,0x6e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x84,0x87,0x10,0x00,0x00,0x84,0x89,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x84,0xb6,0x10,0x00,0x00,0x84,0xb8,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x84,0xe4,0x10,0x00,0x00,0x84,0xe6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x84,0xfc,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x85,0x0a,0x10,0x00,0x00,0x85,0x0c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x65,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x85,0x46,0x10,0x00,0x00,0x85,0x48,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x70,0x72,0x6f,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x85,0x6c,0x10,0x00,0x00,0x85,0x6e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x85,0x88,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0f,0x00,0x00,0x85,0xa0,0x04,0x13,0x00,0x00,0x86,0xf6,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x85,0xe0,0x10,0x00,0x00,0x85,0xe2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x09,0x61,0x70,0x70,0x6c,0x79,0x5f,0x62,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x86,0x0b,0x10,0x00,0x00,0x86,0x0d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x86,0x26,0x10,0x00,0x00,0x86,0x28,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x86,0x55,0x10,0x00,0x00,0x86,0x57,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x86,0x87,0x10,0x00,0x00,0x86,0x89,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x70,0x72,0x6f,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x86,0xad,0x10,0x00,0x00,0x86,0xaf,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x86,0xcc,0x10,0x00,0x00,0x86,0xce,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x71,0x12,0x00,0x00,0x86,0xf3,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x09,0x61,0x70,0x70,0x6c,0x79,0x5f,0x65,0x6e,0x64,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x46,0x12,0x00,0x00,0x87,0x2d,0x10,0x00,0x00,0x87,0x2f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x0d,0x04,0x00,0x00,0x00,0x0f,0x61,0x70,0x70,0x6c,0x79,0x5f,0x70,0x72,0x69,0x6d,0x69,0x74,0x69,0x76,0x65,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x46,0x12,0x00,0x00,0x87,0x63,0x10,0x00,0x00,0x87,0x65,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x87,0x7a,0x03,0x13,0x00,0x00,0x89,0xad,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x87,0xdc,0x10,0x00,0x00,0x87,0xde,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x88,0x06,0x10,0x00,0x00,0x88,0x08,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0x88,0x4c,0x10,0x00,0x00,0x88,0x4e,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x88,0x64,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x13,0x00,0x00,0x88,0x6e,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x02,0x00,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x88,0x97,0x10,0x00,0x00,0x88,0x99,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6f,0x12,0x00,0x00,0x88,0xb6,0x10,0x00,0x00,0x88,0xb8,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x88,0xf5,0x10,0x00,0x00,0x88,0xf7,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x62,0x72,0x61,0x6e,0x63,0x68,0x5f,0x62,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x89,0x21,0x10,0x00,0x00,0x89,0x23,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x89,0x3c,0x10,0x00,0x00,0x89,0x3e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x08,0x04,0x04,0x00,0x04,0x00,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x70,0x72,0x6f,0x63,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x89,0x6f,0x10,0x00,0x00,0x89,0x71,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x89,0x8e,0x10,0x00,0x00,0x89,0x90,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x89,0xaa,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x89,0xb3,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x89,0xfe,0x10,0x00,0x00,0x8a,0x00,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x61,0x70,0x70,0x6c,0x79,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8a,0x36,0x10,0x00,0x00,0x8a,0x38,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x62,0x65,0x67,0x69,0x6e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8a,0x71,0x10,0x00,0x00,0x8a,0x73,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5a,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x69,0x66,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8a,0xa9,0x10,0x00,0x00,0x8a,0xab,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x64,0x65,0x66,0x69,0x6e,0x65,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8a,0xe5,0x10,0x00,0x00,0x8a,0xe7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x73,0x65,0x74,0x21,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8b,0x1f,0x10,0x00,0x00,0x8b,0x21,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x1c,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8b,0x71,0x10,0x00,0x00,0x8b,0x73,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x13,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8b,0xba,0x10,0x00,0x00,0x8b,0xbc,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x1e,0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8c,0x0e,0x10,0x00,0x00,0x8c,0x10,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x71,0x75,0x61,0x73,0x69,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8c,0x4e,0x10,0x00,0x00,0x8c,0x50,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8c,0x89,0x10,0x00,0x00,0x8c,0x8b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x64,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8c,0xc3,0x10,0x00,0x00,0x8c,0xc5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x6c,0x65,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8c,0xfc,0x10,0x00,0x00,0x8c,0xfe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x6f,0x72,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8d,0x34,0x10,0x00,0x00,0x8d,0x36,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x61,0x6e,0x64,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8d,0x6b,0x10,0x00,0x00,0x8d,0x6d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x8d,0x86,0x10,0x00,0x00,0x8d,0x88,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x8d,0x9e,0x10,0x00,0x00,0x8d,0xa0,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x8d,0xbf,0x04,0x13,0x00,0x00,0x8f,0x51,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x0f,0x00,0x00,0x8d,0xd3,0x04,0x13,0x00,0x00,0x8e,0xf8,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x8d,0xfe,0x10,0x00,0x00,0x8e,0x00,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x8e,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x8e,0x47,0x10,0x00,0x00,0x8e,0x49,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x42,0x12,0x00,0x00,0x8e,0x70,0x10,0x00,0x00,0x8e,0x72,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0x8e,0xa2,0x10,0x00,0x00,0x8e,0xa4,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0x8e,0xcb,0x10,0x00,0x00,0x8e,0xcd,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0x8e,0xf5,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x01,0x00,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x3f,0x12,0x00,0x00,0x8f,0x32,0x10,0x00,0x00,0x8f,0x34,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0x8f,0x4e,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x12,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x62,0x69,0x67,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x8f,0xd9,0x10,0x00,0x00,0x8f,0xdb,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x08,0x6c,0x6f,0x61,0x64,0x5f,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x90,0x03,0x10,0x00,0x00,0x90,0x05,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x90,0x31,0x10,0x00,0x00,0x90,0x33,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x90,0x63,0x10,0x00,0x00,0x90,0x65,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x90,0x95,0x10,0x00,0x00,0x90,0x97,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x65,0x6e,0x76,0x5f,0x65,0x78,0x74,0x65,0x6e,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x90,0xc1,0x10,0x00,0x00,0x90,0xc3,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x73,0x65,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x90,0xe6,0x10,0x00,0x00,0x90,0xe8,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x67,0x65,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x91,0x0b,0x10,0x00,0x00,0x91,0x0d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x64,0x65,0x66,0x69,0x6e,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x91,0x33,0x10,0x00,0x00,0x91,0x35,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x91,0x5b,0x10,0x00,0x00,0x91,0x5d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x62,0x72,0x61,0x6e,0x63,0x68,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x91,0x83,0x10,0x00,0x00,0x91,0x85,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x91,0xa9,0x10,0x00,0x00,0x91,0xab,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x67,0x6f,0x74,0x6f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x91,0xcf,0x10,0x00,0x00,0x91,0xd1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x62,0x72,0x61,0x6e,0x63,0x68,0x5f,0x62,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x91,0xfb,0x10,0x00,0x00,0x91,0xfd,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x07,0x63,0x61,0x6c,0x6c,0x5f,0x63,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x92,0x24,0x10,0x00,0x00,0x92,0x26,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x92,0x52,0x10,0x00,0x00,0x92,0x54,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x92,0x81,0x10,0x00,0x00,0x92,0x83,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x62,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x92,0xad,0x10,0x00,0x00,0x92,0xaf,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x92,0xdc,0x10,0x00,0x00,0x92,0xde,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x93,0x0b,0x10,0x00,0x00,0x93,0x0d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x14,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x73,0x6d,0x61,0x6c,0x6c,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x93,0x41,0x10,0x00,0x00,0x93,0x43,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x66,0x61,0x6c,0x73,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x93,0x6f,0x10,0x00,0x00,0x93,0x71,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0b,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x74,0x72,0x75,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x93,0x9c,0x10,0x00,0x00,0x93,0x9e,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6e,0x69,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x93,0xc8,0x10,0x00,0x00,0x93,0xca,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x61,0x73,0x73,0x69,0x67,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x93,0xf0,0x10,0x00,0x00,0x93,0xf2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x70,0x70,0x6c,0x79,0x5f,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x94,0x1e,0x10,0x00,0x00,0x94,0x20,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x09,0x61,0x70,0x70,0x6c,0x79,0x5f,0x62,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x94,0x49,0x10,0x00,0x00,0x94,0x4b,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x94,0x6f,0x10,0x00,0x00,0x94,0x71,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x94,0x95,0x10,0x00,0x00,0x94,0x97,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x94,0xbe,0x10,0x00,0x00,0x94,0xc0,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x73,0x61,0x76,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x94,0xe4,0x10,0x00,0x00,0x94,0xe6,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x65,0x78,0x69,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x95,0x0a,0x10,0x00,0x00,0x95,0x0c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x12,0x00,0x00,0x95,0x26,0x10,0x00,0x00,0x95,0x28,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0x95,0x38,0x03,0x13,0x00,0x00,0x96,0x48,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x0f,0x00,0x00,0x95,0x48,0x04,0x14,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x41,0x12,0x00,0x00,0x95,0x81,0x10,0x00,0x00,0x95,0x83,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x95,0x95,0x03,0x13,0x00,0x00,0x96,0x3f,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x95,0xb8,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x14,0x49,0x6c,0x6c,0x65,0x67,0x61,0x6c,0x20,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x3a,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x95,0xfc,0x10,0x00,0x00,0x95,0xfe,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x96,0x10,0x03,0x13,0x00,0x00,0x96,0x36,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x96,0x33,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x00,0x96,0x3c,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x96,0x45,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x96,0x53,0x10,0x00,0x00,0x96,0x55,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x96,0x9a,0x10,0x00,0x00,0x96,0x9c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x70,0x72,0x6f,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x96,0xc0,0x10,0x00,0x00,0x96,0xc2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x96,0xe5,0x10,0x00,0x00,0x96,0xe7,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x97,0x0b,0x10,0x00,0x00,0x97,0x0d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x97,0x31,0x10,0x00,0x00,0x97,0x33,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x12,0x00,0x00,0x97,0x4d,0x10,0x00,0x00,0x97,0x4f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0x97,0x5f,0x03,0x13,0x00,0x00,0x98,0x6c,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x0f,0x00,0x00,0x97,0x6f,0x04,0x14,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x41,0x12,0x00,0x00,0x97,0xa8,0x10,0x00,0x00,0x97,0xaa,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x97,0xbc,0x03,0x13,0x00,0x00,0x98,0x63,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x97,0xdf,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x11,0x49,0x6c,0x6c,0x65,0x67,0x61,0x6c,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x3a,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0x98,0x20,0x10,0x00,0x00,0x98,0x22,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x98,0x34,0x03,0x13,0x00,0x00,0x98,0x5a,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x98,0x57,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x00,0x98,0x60,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x98,0x69,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0x98,0x77,0x10,0x00,0x00,0x98,0x79,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x98,0xba,0x10,0x00,0x00,0x98,0xbc,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x70,0x72,0x6f,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x98,0xe0,0x10,0x00,0x00,0x98,0xe2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x99,0x05,0x10,0x00,0x00,0x99,0x07,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x99,0x2b,0x10,0x00,0x00,0x99,0x2d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x99,0x51,0x10,0x00,0x00,0x99,0x53,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x99,0x72,0x04,0x13,0x00,0x00,0x99,0xb3,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x99,0xb0,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x99,0xd0,0x04,0x13,0x00,0x00,0x99,0xfd,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x04,0x03,0x00,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0x99,0xfa,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x9a,0x1a,0x04,0x13,0x00,0x00,0x9a,0x8c,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x75,0x12,0x00,0x00,0x9a,0x45,0x10,0x00,0x00,0x9a,0x47,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x9a,0x6c,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x9a,0x69,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x12,0x00,0x00,0x9a,0x89,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x9a,0xa9,0x04,0x13,0x00,0x00,0x9a,0xfe,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x75,0x12,0x00,0x00,0x9a,0xd4,0x10,0x00,0x00,0x9a,0xd6,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x9a,0xe2,0x08,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x9a,0xfb,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x9b,0x1b,0x04,0x13,0x00,0x00,0x9b,0x74,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x75,0x12,0x00,0x00,0x9b,0x46,0x10,0x00,0x00,0x9b,0x48,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x9b,0x54,0x08,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0x9b,0x71,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6a,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x9b,0x91,0x04,0x13,0x00,0x00,0x9b,0xe6,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x69,0x12,0x00,0x00,0x9b,0xc0,0x10,0x00,0x00,0x9b,0xc2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x67,0x12,0x00,0x00,0x9b,0xe3,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x9c,0x03,0x04,0x13,0x00,0x00,0x9c,0x58,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6a,0x12,0x00,0x00,0x9c,0x32,0x10,0x00,0x00,0x9c,0x34,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x67,0x12,0x00,0x00,0x9c,0x55,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0x9c,0x75,0x04,0x13,0x00,0x00,0xa0,0xb9,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0x9c,0xa0,0x10,0x00,0x00,0x9c,0xa2,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0x9c,0xd9,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0x9c,0xd6,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0x9c,0xfb,0x10,0x00,0x00,0x9c,0xfd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0x9d,0x0f,0x03,0x13,0x00,0x00,0xa0,0xb0,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6b,0x12,0x00,0x00,0x9d,0x4e,0x10,0x00,0x00,0x9d,0x50,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0x9d,0x9c,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6c,0x12,0x00,0x00,0x9d,0x87,0x10,0x00,0x00,0x9d,0x89,0x06,0x05,0x04,0x15,0x00,0x00,0x9d,0x95,0x09,0x04,0x13,0x00,0x00,0x9d,0x9e,0x0a,0x04,0x13,0x00,0x00,0x9d,0x9e,0x0a,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xa0,0x52,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x9d,0xf3,0x10,0x00,0x00,0x9d,0xf5,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x9e,0x1c,0x10,0x00,0x00,0x9e,0x1e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x9e,0x37,0x10,0x00,0x00,0x9e,0x39,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x68,0x12,0x00,0x00,0x9e,0x64,0x10,0x00,0x00,0x9e,0x66,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x9e,0x9f,0x10,0x00,0x00,0x9e,0xa1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x73,0x61,0x76,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x9e,0xc5,0x10,0x00,0x00,0x9e,0xc7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0x9e,0xe0,0x10,0x00,0x00,0x9e,0xe2,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0x9e,0xfb,0x10,0x00,0x00,0x9e,0xfd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x9f,0x28,0x10,0x00,0x00,0x9f,0x2a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6a,0x12,0x00,0x00,0x9f,0x53,0x10,0x00,0x00,0x9f,0x55,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1f,0x12,0x00,0x00,0x9f,0x72,0x10,0x00,0x00,0x9f,0x74,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x69,0x12,0x00,0x00,0x9f,0xa4,0x10,0x00,0x00,0x9f,0xa6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0x9f,0xcb,0x10,0x00,0x00,0x9f,0xcd,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1e,0x12,0x00,0x00,0x9f,0xea,0x10,0x00,0x00,0x9f,0xec,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xa0,0x09,0x10,0x00,0x00,0xa0,0x0b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xa0,0x33,0x10,0x00,0x00,0xa0,0x35,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0xa0,0x4f,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xa0,0x91,0x10,0x00,0x00,0xa0,0x93,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0xa0,0xad,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xa0,0xb6,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xa0,0xd6,0x04,0x13,0x00,0x00,0xa3,0xdb,0x16,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x03,0x0f,0x00,0x00,0xa0,0xea,0x04,0x13,0x00,0x00,0xa2,0xc9,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x68,0x12,0x00,0x00,0xa1,0x1f,0x10,0x00,0x00,0xa1,0x21,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x68,0x12,0x00,0x00,0xa1,0x4a,0x10,0x00,0x00,0xa1,0x4c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0xa1,0x65,0x10,0x00,0x00,0xa1,0x67,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6a,0x12,0x00,0x00,0xa1,0x96,0x10,0x00,0x00,0xa1,0x98,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6a,0x12,0x00,0x00,0xa1,0xc1,0x10,0x00,0x00,0xa1,0xc3,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1e,0x12,0x00,0x00,0xa1,0xe0,0x10,0x00,0x00,0xa1,0xe2,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6a,0x12,0x00,0x00,0xa2,0x16,0x10,0x00,0x00,0xa2,0x18,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x69,0x12,0x00,0x00,0xa2,0x41,0x10,0x00,0x00,0xa2,0x43,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1f,0x12,0x00,0x00,0xa2,0x60,0x10,0x00,0x00,0xa2,0x62,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x69,0x12,0x00,0x00,0xa2,0x8b,0x10,0x00,0x00,0xa2,0x8d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1e,0x12,0x00,0x00,0xa2,0xaa,0x10,0x00,0x00,0xa2,0xac,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xa2,0xc6,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0f,0x00,0x00,0xa2,0xde,0x04,0x13,0x00,0x00,0xa3,0xb1,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0xa3,0x09,0x10,0x00,0x00,0xa3,0x0b,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xa3,0x29,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x67,0x12,0x00,0x00,0xa3,0x26,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xa3,0x4f,0x10,0x00,0x00,0xa3,0x51,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x12,0x00,0x00,0xa3,0x6b,0x10,0x00,0x00,0xa3,0x6d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xa3,0x92,0x10,0x00,0x00,0xa3,0x94,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xa3,0xae,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x12,0x00,0x00,0xa3,0xd8,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xa3,0xf8,0x04,0x13,0x00,0x00,0xa5,0x89,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x68,0x12,0x00,0x00,0xa4,0x2d,0x10,0x00,0x00,0xa4,0x2f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x68,0x12,0x00,0x00,0xa4,0x58,0x10,0x00,0x00,0xa4,0x5a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0xa4,0x73,0x10,0x00,0x00,0xa4,0x75,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6a,0x12,0x00,0x00,0xa4,0xa4,0x10,0x00,0x00,0xa4,0xa6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6a,0x12,0x00,0x00,0xa4,0xcf,0x10,0x00,0x00,0xa4,0xd1,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1e,0x12,0x00,0x00,0xa4,0xee,0x10,0x00,0x00,0xa4,0xf0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x69,0x12,0x00,0x00,0xa5,0x20,0x10,0x00,0x00,0xa5,0x22,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x69,0x12,0x00,0x00,0xa5,0x4b,0x10,0x00,0x00,0xa5,0x4d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1e,0x12,0x00,0x00,0xa5,0x6a,0x10,0x00,0x00,0xa5,0x6c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xa5,0x86,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xa5,0xa6,0x04,0x13,0x00,0x00,0xa6,0x9b,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x68,0x12,0x00,0x00,0xa5,0xdb,0x10,0x00,0x00,0xa5,0xdd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x68,0x12,0x00,0x00,0xa6,0x06,0x10,0x00,0x00,0xa6,0x08,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0xa6,0x21,0x10,0x00,0x00,0xa6,0x23,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6a,0x12,0x00,0x00,0xa6,0x4e,0x10,0x00,0x00,0xa6,0x50,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x69,0x12,0x00,0x00,0xa6,0x7c,0x10,0x00,0x00,0xa6,0x7e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xa6,0x98,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xa6,0xb8,0x04,0x13,0x00,0x00,0xa7,0x43,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x72,0x12,0x00,0x00,0xa6,0xe9,0x10,0x00,0x00,0xa6,0xeb,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xa7,0x24,0x10,0x00,0x00,0xa7,0x26,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x12,0x00,0x00,0xa7,0x40,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xa7,0x60,0x04,0x13,0x00,0x00,0xa9,0x59,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x06,0x72,0x65,0x74,0x75,0x72,0x6e,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0xa7,0x9b,0x10,0x00,0x00,0xa7,0x9d,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xa8,0x6d,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xa7,0xd9,0x10,0x00,0x00,0xa7,0xdb,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xa7,0xf4,0x10,0x00,0x00,0xa7,0xf6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x08,0x04,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xa8,0x28,0x10,0x00,0x00,0xa8,0x2a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xa8,0x4e,0x10,0x00,0x00,0xa8,0x50,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xa8,0x6a,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0xa8,0x9d,0x10,0x00,0x00,0xa8,0x9f,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xa8,0xbd,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x67,0x12,0x00,0x00,0xa8,0xba,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xa8,0xf0,0x10,0x00,0x00,0xa8,0xf2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x67,0x6f,0x74,0x6f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xa9,0x16,0x10,0x00,0x00,0xa9,0x18,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xa9,0x31,0x10,0x00,0x00,0xa9,0x33,0x06,0x05,0x04,0x03,0x00,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xa9,0x56,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0e,0x04,0x00,0x00,0x00,0x75,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xa9,0x8e,0x04,0x13,0x00,0x00,0xb1,0x02,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x0f,0x00,0x00,0xa9,0xa2,0x04,0x13,0x00,0x00,0xb0,0x26,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0xa9,0xcd,0x10,0x00,0x00,0xa9,0xcf,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xa9,0xdb,0x08,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xa9,0xff,0x10,0x00,0x00,0xaa,0x01,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xaa,0x17,0x10,0x00,0x00,0xaa,0x19,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xaa,0xc4,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xaa,0x48,0x10,0x00,0x00,0xaa,0x4a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xaa,0x64,0x10,0x00,0x00,0xaa,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xaa,0x8d,0x10,0x00,0x00,0xaa,0x8f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x64,0x12,0x00,0x00,0xaa,0xa9,0x10,0x00,0x00,0xaa,0xab,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xaa,0xc1,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xaa,0xe8,0x10,0x00,0x00,0xaa,0xea,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x08,0x12,0x00,0x00,0xab,0x00,0x10,0x00,0x00,0xab,0x02,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xac,0x31,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xab,0x31,0x10,0x00,0x00,0xab,0x33,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xab,0x4d,0x10,0x00,0x00,0xab,0x4f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xab,0x7a,0x10,0x00,0x00,0xab,0x7c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x23,0x12,0x00,0x00,0xab,0x92,0x10,0x00,0x00,0xab,0x94,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x04,0x00,0x00,0x00,0x15,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x18,0x12,0x00,0x00,0xab,0xb8,0x10,0x00,0x00,0xab,0xba,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xab,0xe6,0x10,0x00,0x00,0xab,0xe8,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x2e,0x12,0x00,0x00,0xab,0xfe,0x10,0x00,0x00,0xac,0x00,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x59,0x12,0x00,0x00,0xac,0x16,0x10,0x00,0x00,0xac,0x18,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0xac,0x2e,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xac,0x55,0x10,0x00,0x00,0xac,0x57,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x80,0x12,0x00,0x00,0xac,0x6d,0x10,0x00,0x00,0xac,0x6f,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xad,0x16,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xac,0x9e,0x10,0x00,0x00,0xac,0xa0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xac,0xba,0x10,0x00,0x00,0xac,0xbc,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xac,0xe3,0x10,0x00,0x00,0xac,0xe5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x59,0x12,0x00,0x00,0xac,0xfb,0x10,0x00,0x00,0xac,0xfd,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0xad,0x13,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xad,0x3a,0x10,0x00,0x00,0xad,0x3c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x81,0x12,0x00,0x00,0xad,0x52,0x10,0x00,0x00,0xad,0x54,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xae,0xe9,0x01,0x01,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x10,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xad,0x8c,0x10,0x00,0x00,0xad,0x8e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x5b,0x12,0x00,0x00,0xad,0xa7,0x10,0x00,0x00,0xad,0xa9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xad,0xbb,0x03,0x13,0x00,0x00,0xae,0xe0,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xad,0xea,0x10,0x00,0x00,0xad,0xec,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xae,0x06,0x10,0x00,0x00,0xae,0x08,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xae,0x31,0x10,0x00,0x00,0xae,0x33,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x23,0x12,0x00,0x00,0xae,0x5d,0x10,0x00,0x00,0xae,0x5f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x2e,0x12,0x00,0x00,0xae,0x8b,0x10,0x00,0x00,0xae,0x8d,0x06,0x05,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xae,0xad,0x10,0x00,0x00,0xae,0xaf,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x59,0x12,0x00,0x00,0xae,0xc5,0x10,0x00,0x00,0xae,0xc7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0xae,0xdd,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xae,0xe6,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xaf,0x0d,0x10,0x00,0x00,0xaf,0x0f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x84,0x12,0x00,0x00,0xaf,0x25,0x10,0x00,0x00,0xaf,0x27,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xaf,0xce,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xaf,0x56,0x10,0x00,0x00,0xaf,0x58,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xaf,0x72,0x10,0x00,0x00,0xaf,0x74,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xaf,0x9b,0x10,0x00,0x00,0xaf,0x9d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x77,0x12,0x00,0x00,0xaf,0xb3,0x10,0x00,0x00,0xaf,0xb5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0xaf,0xcb,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xaf,0xf0,0x10,0x00,0x00,0xaf,0xf2,0x06,0x05,0x04,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x10,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x3a,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0xb0,0x23,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xb0,0x52,0x10,0x00,0x00,0xb0,0x54,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xb0,0xff,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xb0,0x83,0x10,0x00,0x00,0xb0,0x85,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xb0,0x9f,0x10,0x00,0x00,0xb0,0xa1,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb0,0xc8,0x10,0x00,0x00,0xb0,0xca,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x63,0x12,0x00,0x00,0xb0,0xe4,0x10,0x00,0x00,0xb0,0xe6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xb0,0xfc,0x06,0x05,0x04,0x14,0x09,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xb1,0x1f,0x04,0x13,0x00,0x00,0xbf,0x29,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x0f,0x00,0x00,0xb1,0x33,0x04,0x13,0x00,0x00,0xb6,0x2f,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0xb1,0x5e,0x10,0x00,0x00,0xb1,0x60,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xb1,0x70,0x0b,0x04,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb1,0x94,0x10,0x00,0x00,0xb1,0x96,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xb1,0xac,0x10,0x00,0x00,0xb1,0xae,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xb2,0x19,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xb1,0xdb,0x10,0x00,0x00,0xb1,0xdd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xb1,0xf7,0x10,0x00,0x00,0xb1,0xf9,0x06,0x05,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xb2,0x16,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb2,0x3d,0x10,0x00,0x00,0xb2,0x3f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x08,0x12,0x00,0x00,0xb2,0x55,0x10,0x00,0x00,0xb2,0x57,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xb3,0x1f,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xb2,0x86,0x10,0x00,0x00,0xb2,0x88,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xb2,0xa2,0x10,0x00,0x00,0xb2,0xa4,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb2,0xcd,0x10,0x00,0x00,0xb2,0xcf,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x2e,0x12,0x00,0x00,0xb2,0xe5,0x10,0x00,0x00,0xb2,0xe7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x94,0x12,0x00,0x00,0xb3,0x04,0x10,0x00,0x00,0xb3,0x06,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xb3,0x1c,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb3,0x43,0x10,0x00,0x00,0xb3,0x45,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x80,0x12,0x00,0x00,0xb3,0x5b,0x10,0x00,0x00,0xb3,0x5d,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xb3,0xdf,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xb3,0x8c,0x10,0x00,0x00,0xb3,0x8e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xb3,0xa8,0x10,0x00,0x00,0xb3,0xaa,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x94,0x12,0x00,0x00,0xb3,0xc4,0x10,0x00,0x00,0xb3,0xc6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xb3,0xdc,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb4,0x03,0x10,0x00,0x00,0xb4,0x05,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x81,0x12,0x00,0x00,0xb4,0x1b,0x10,0x00,0x00,0xb4,0x1d,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xb5,0x17,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xb4,0x4c,0x10,0x00,0x00,0xb4,0x4e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xb4,0x68,0x10,0x00,0x00,0xb4,0x6a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0b,0x04,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x10,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb4,0xaa,0x10,0x00,0x00,0xb4,0xac,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x5b,0x12,0x00,0x00,0xb4,0xc5,0x10,0x00,0x00,0xb4,0xc7,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x2e,0x12,0x00,0x00,0xb4,0xdd,0x10,0x00,0x00,0xb4,0xdf,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x94,0x12,0x00,0x00,0xb4,0xfc,0x10,0x00,0x00,0xb4,0xfe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xb5,0x14,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb5,0x3b,0x10,0x00,0x00,0xb5,0x3d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x84,0x12,0x00,0x00,0xb5,0x53,0x10,0x00,0x00,0xb5,0x55,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xb5,0xd7,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xb5,0x84,0x10,0x00,0x00,0xb5,0x86,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xb5,0xa0,0x10,0x00,0x00,0xb5,0xa2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x93,0x12,0x00,0x00,0xb5,0xbc,0x10,0x00,0x00,0xb5,0xbe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xb5,0xd4,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb5,0xf9,0x10,0x00,0x00,0xb5,0xfb,0x06,0x05,0x04,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x10,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x3a,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0xb6,0x2c,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0f,0x00,0x00,0xb6,0x44,0x04,0x13,0x00,0x00,0xb7,0x93,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x0f,0x00,0x00,0xb6,0x58,0x04,0x13,0x00,0x00,0xb7,0x5f,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0xb6,0x83,0x10,0x00,0x00,0xb6,0x85,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xb6,0x99,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb6,0xc1,0x10,0x00,0x00,0xb6,0xc3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x73,0x12,0x00,0x00,0xb6,0xdd,0x10,0x00,0x00,0xb6,0xdf,0x06,0x05,0x04,0x15,0x00,0x00,0xb6,0xef,0x0b,0x04,0x00,0x00,0x00,0x01,0x13,0x00,0x00,0xb6,0xf5,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xb7,0x19,0x10,0x00,0x00,0xb7,0x1b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xb7,0x40,0x10,0x00,0x00,0xb7,0x42,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xb7,0x5c,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xb7,0x90,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x0f,0x00,0x00,0xb7,0xa8,0x04,0x13,0x00,0x00,0xb9,0xb6,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0xb7,0xd3,0x10,0x00,0x00,0xb7,0xd5,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xb7,0xe9,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb8,0x0d,0x10,0x00,0x00,0xb8,0x0f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x73,0x12,0x00,0x00,0xb8,0x29,0x10,0x00,0x00,0xb8,0x2b,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xb8,0xf4,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb8,0x67,0x10,0x00,0x00,0xb8,0x69,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x3c,0x12,0x00,0x00,0xb8,0x90,0x10,0x00,0x00,0xb8,0x92,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xb8,0xd5,0x10,0x00,0x00,0xb8,0xd7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0xb8,0xf1,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x01,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xb9,0x2b,0x10,0x00,0x00,0xb9,0x2d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xb9,0x47,0x10,0x00,0x00,0xb9,0x49,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xb9,0x6d,0x10,0x00,0x00,0xb9,0x6f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xb9,0x97,0x10,0x00,0x00,0xb9,0x99,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0xb9,0xb3,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0f,0x00,0x00,0xb9,0xcb,0x04,0x13,0x00,0x00,0xbe,0x39,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0f,0x00,0x00,0xb9,0xec,0x04,0x13,0x00,0x00,0xbe,0x22,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xba,0x17,0x10,0x00,0x00,0xba,0x19,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xbe,0x1f,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xba,0x48,0x10,0x00,0x00,0xba,0x4a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0xba,0x76,0x10,0x00,0x00,0xba,0x78,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0xba,0x88,0x03,0x13,0x00,0x00,0xbd,0x74,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xba,0xab,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xba,0xcf,0x10,0x00,0x00,0xba,0xd1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0xba,0xfe,0x10,0x00,0x00,0xbb,0x00,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xbb,0x12,0x03,0x13,0x00,0x00,0xbd,0x6b,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xbb,0x35,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xbb,0x59,0x10,0x00,0x00,0xbb,0x5b,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x07,0x63,0x61,0x6c,0x6c,0x5f,0x63,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0xbb,0x82,0x10,0x00,0x00,0xbb,0x84,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xbb,0x96,0x03,0x13,0x00,0x00,0xbd,0x62,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xbb,0xb9,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xbb,0xdd,0x10,0x00,0x00,0xbb,0xdf,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x62,0x72,0x61,0x6e,0x63,0x68,0x5f,0x62,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0xbc,0x09,0x10,0x00,0x00,0xbc,0x0b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xbc,0x1d,0x03,0x13,0x00,0x00,0xbd,0x59,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xbc,0x40,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xbc,0x64,0x10,0x00,0x00,0xbc,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x62,0x72,0x61,0x6e,0x63,0x68,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0xbc,0x8c,0x10,0x00,0x00,0xbc,0x8e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xbc,0xa0,0x03,0x13,0x00,0x00,0xbd,0x50,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xbc,0xc3,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xbc,0xe7,0x10,0x00,0x00,0xbc,0xe9,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x67,0x6f,0x74,0x6f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0xbd,0x0d,0x10,0x00,0x00,0xbd,0x0f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xbd,0x21,0x03,0x13,0x00,0x00,0xbd,0x47,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xbd,0x44,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x00,0xbd,0x4d,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xbd,0x56,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xbd,0x5f,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xbd,0x68,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xbd,0x71,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xbd,0x7f,0x10,0x00,0x00,0xbd,0x81,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xbe,0x1c,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0xbd,0xb4,0x10,0x00,0x00,0xbd,0xb6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x3b,0x12,0x00,0x00,0xbd,0xda,0x10,0x00,0x00,0xbd,0xdc,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xbe,0x01,0x10,0x00,0x00,0xbe,0x03,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x13,0x12,0x00,0x00,0xbe,0x19,0x06,0x05,0x04,0x14,0x09,0x04,0x14,0x09,0x04,0x14,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x19,0x12,0x00,0x00,0xbe,0x36,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x12,0x00,0x00,0xbe,0x6b,0x10,0x00,0x00,0xbe,0x6d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x38,0x12,0x00,0x00,0xbe,0x83,0x10,0x00,0x00,0xbe,0x85,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xbe,0x97,0x03,0x13,0x00,0x00,0xbf,0x20,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1b,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0xbe,0xe2,0x10,0x00,0x00,0xbe,0xe4,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1b,0x02,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0xbf,0x1d,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xbf,0x26,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xbf,0x46,0x04,0x13,0x00,0x00,0xc4,0x43,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x12,0x00,0x00,0xbf,0x6a,0x10,0x00,0x00,0xbf,0x6c,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1b,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xbf,0xa4,0x10,0x00,0x00,0xbf,0xa6,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x00,0xc0,0x5a,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x08,0x6c,0x6f,0x61,0x64,0x5f,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xbf,0xf1,0x10,0x00,0x00,0xbf,0xf3,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc0,0x0c,0x10,0x00,0x00,0xc0,0x0e,0x06,0x05,0x04,0x03,0x00,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xc0,0x34,0x10,0x00,0x00,0xc0,0x36,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0xc0,0x53,0x10,0x00,0x00,0xc2,0xd4,0x06,0x05,0x04,0x13,0x00,0x00,0xc2,0xd4,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x15,0x00,0x00,0xc0,0x78,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0xc2,0xd4,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc0,0xb0,0x10,0x00,0x00,0xc0,0xb2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc0,0xd9,0x10,0x00,0x00,0xc0,0xdb,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc0,0xf4,0x10,0x00,0x00,0xc0,0xf6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc1,0x23,0x10,0x00,0x00,0xc1,0x25,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc1,0x4c,0x10,0x00,0x00,0xc1,0x4e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc1,0x67,0x10,0x00,0x00,0xc1,0x69,0x06,0x05,0x04,0x03,0x00,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xc1,0x8f,0x10,0x00,0x00,0xc1,0x91,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc1,0xdb,0x10,0x00,0x00,0xc1,0xdd,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x73,0x61,0x76,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc2,0x01,0x10,0x00,0x00,0xc2,0x03,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc2,0x1c,0x10,0x00,0x00,0xc2,0x1e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x65,0x6e,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc2,0x4a,0x10,0x00,0x00,0xc2,0x4c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x73,0x61,0x76,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc2,0x70,0x10,0x00,0x00,0xc2,0x72,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc2,0x8b,0x10,0x00,0x00,0xc2,0x8d,0x06,0x05,0x04,0x03,0x00,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xc2,0xb3,0x10,0x00,0x00,0xc2,0xb5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0xc2,0xd2,0x10,0x00,0x00,0xc2,0xd4,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x12,0x00,0x00,0xc2,0xee,0x10,0x00,0x00,0xc2,0xf0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xc3,0x02,0x03,0x13,0x00,0x00,0xc4,0x3a,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x75,0x12,0x00,0x00,0xc3,0x31,0x10,0x00,0x00,0xc3,0x33,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0f,0x00,0x00,0xc3,0x57,0x04,0x13,0x00,0x00,0xc3,0xd2,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x05,0x12,0x00,0x00,0xc3,0x82,0x10,0x00,0x00,0xc3,0x84,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xc3,0xcb,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x74,0x12,0x00,0x00,0xc3,0xb3,0x10,0x00,0x00,0xc3,0xb5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x61,0x12,0x00,0x00,0xc3,0xc8,0x06,0x05,0x04,0x14,0x0c,0x04,0x00,0x00,0x00,0x00,0x14,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x18,0x12,0x00,0x00,0xc3,0xeb,0x10,0x00,0x00,0xc3,0xed,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc4,0x11,0x10,0x00,0x00,0xc4,0x13,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x26,0x12,0x00,0x00,0xc4,0x29,0x10,0x00,0x00,0xc4,0x2b,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1c,0x02,0x01,0x14,0x12,0x00,0x00,0xc4,0x40,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xc4,0x60,0x04,0x13,0x00,0x00,0xc4,0x89,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0xc4,0x86,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xc4,0xa6,0x04,0x13,0x00,0x00,0xc4,0xcf,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0xc4,0xcc,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xc4,0xec,0x04,0x13,0x00,0x00,0xc5,0xde,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x02,0x3a,0x20,0x04,0x00,0x04,0x00,0x01,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x78,0x12,0x00,0x00,0xc5,0x3c,0x10,0x00,0x00,0xc5,0x3e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x5b,0x12,0x00,0x00,0xc5,0x54,0x10,0x00,0x00,0xc5,0x56,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0c,0x04,0x00,0x00,0x00,0x01,0x3a,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x77,0x12,0x00,0x00,0xc5,0x8f,0x10,0x00,0x00,0xc5,0x91,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x5b,0x12,0x00,0x00,0xc5,0xa7,0x10,0x00,0x00,0xc5,0xa9,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x26,0x12,0x00,0x00,0xc5,0xc2,0x10,0x00,0x00,0xc5,0xc4,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0xc5,0xdb,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xc5,0xfb,0x04,0x13,0x00,0x00,0xc8,0x44,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0b,0x04,0xff,0xff,0xff,0xfd,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x58,0x12,0x00,0x00,0xc6,0x31,0x10,0x00,0x00,0xc6,0x33,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xc6,0x48,0x03,0x13,0x00,0x00,0xc8,0x3b,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x0f,0x00,0x00,0xc6,0x58,0x04,0x14,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x3a,0x12,0x00,0x00,0xc6,0x87,0x10,0x00,0x00,0xc6,0x89,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xc6,0xb8,0x10,0x00,0x00,0xc6,0xba,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x5c,0x12,0x00,0x00,0xc6,0xd3,0x10,0x00,0x00,0xc6,0xd5,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xc8,0x38,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xc7,0x0a,0x10,0x00,0x00,0xc7,0x0c,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x02,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xc7,0x4e,0x10,0x00,0x00,0xc7,0x50,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x3b,0x12,0x00,0x00,0xc7,0x74,0x10,0x00,0x00,0xc7,0x76,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xc7,0xa7,0x10,0x00,0x00,0xc7,0xa9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x3b,0x12,0x00,0x00,0xc7,0xcd,0x10,0x00,0x00,0xc7,0xcf,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc7,0xe8,0x10,0x00,0x00,0xc7,0xea,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x3b,0x12,0x00,0x00,0xc8,0x1d,0x10,0x00,0x00,0xc8,0x1f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xc8,0x35,0x06,0x05,0x04,0x14,0x0a,0x04,0x14,0x12,0x00,0x00,0xc8,0x41,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7a,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x01,0x02,0x08,0x00,0x0f,0x00,0x00,0xc8,0x65,0x03,0x13,0x00,0x00,0xdb,0x62,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x0f,0x00,0x00,0xc8,0x79,0x04,0x13,0x00,0x00,0xca,0x2f,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xc8,0xb2,0x10,0x00,0x00,0xc8,0xb4,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xc9,0x35,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xc8,0xf3,0x10,0x00,0x00,0xc8,0xf5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xc9,0x1a,0x10,0x00,0x00,0xc9,0x1c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xc9,0x32,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xc9,0x65,0x10,0x00,0x00,0xc9,0x67,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xc9,0x79,0x03,0x13,0x00,0x00,0xca,0x26,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xc9,0xb8,0x10,0x00,0x00,0xc9,0xba,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xc9,0xf0,0x10,0x00,0x00,0xc9,0xf2,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xca,0x0b,0x10,0x00,0x00,0xca,0x0d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xca,0x23,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xca,0x2c,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0xca,0x44,0x04,0x13,0x00,0x00,0xcd,0x40,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0xca,0x6f,0x10,0x00,0x00,0xca,0x71,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xca,0x7d,0x08,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xca,0xa3,0x10,0x00,0x00,0xca,0xa5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x08,0x12,0x00,0x00,0xca,0xbf,0x10,0x00,0x00,0xca,0xc1,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0xca,0xd1,0x03,0x13,0x00,0x00,0xcb,0x81,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xca,0xf4,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x65,0x12,0x00,0x00,0xcb,0x23,0x10,0x00,0x00,0xcb,0x25,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x5c,0x12,0x00,0x00,0xcb,0x3e,0x10,0x00,0x00,0xcb,0x40,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xcb,0x52,0x03,0x13,0x00,0x00,0xcb,0x78,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xcb,0x75,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x00,0xcb,0x7e,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xcb,0x8c,0x10,0x00,0x00,0xcb,0x8e,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xcb,0xc6,0x0c,0x04,0x00,0x00,0x00,0x13,0x49,0x6e,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x20,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x2e,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0xcb,0xc3,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0xcb,0xee,0x10,0x00,0x00,0xcb,0xf0,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x3a,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x00,0xcc,0x11,0x10,0x00,0x00,0xcc,0x13,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xcc,0xee,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x15,0x12,0x00,0x00,0xcc,0x46,0x10,0x00,0x00,0xcc,0x48,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xcc,0x62,0x10,0x00,0x00,0xcc,0x64,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x12,0x00,0x00,0xcc,0x91,0x10,0x00,0x00,0xcc,0x93,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xcc,0xb8,0x10,0x00,0x00,0xcc,0xba,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xcc,0xd3,0x10,0x00,0x00,0xcc,0xd5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xcc,0xeb,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x28,0x4d,0x61,0x70,0x70,0x69,0x6e,0x67,0x20,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x20,0x6e,0x6f,0x74,0x20,0x73,0x65,0x70,0x61,0x72,0x61,0x74,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x60,0x3a,0x27,0x2e,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0xcd,0x3d,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0f,0x00,0x00,0xcd,0x55,0x04,0x13,0x00,0x00,0xcf,0x0f,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xcd,0x8e,0x10,0x00,0x00,0xcd,0x90,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xcd,0xdf,0x0c,0x04,0x00,0x00,0x00,0x1c,0x55,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x60,0x2e,0x27,0x20,0x6f,0x75,0x74,0x73,0x69,0x64,0x65,0x20,0x6c,0x69,0x73,0x74,0x2e,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x79,0x12,0x00,0x00,0xcd,0xdc,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xce,0x13,0x10,0x00,0x00,0xce,0x15,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xce,0x27,0x03,0x13,0x00,0x00,0xcf,0x06,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xce,0x54,0x10,0x00,0x00,0xce,0x56,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x00,0xce,0x6c,0x10,0x00,0x00,0xce,0x6e,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xce,0x93,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xce,0x90,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x23,0x55,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x64,0x6f,0x74,0x74,0x65,0x64,0x20,0x70,0x61,0x69,0x72,0x2e,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,0x12,0x00,0x00,0xce,0xe7,0x10,0x00,0x00,0xce,0xe9,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x79,0x12,0x00,0x00,0xcf,0x03,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xcf,0x0c,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x0f,0x00,0x00,0xcf,0x24,0x04,0x13,0x00,0x00,0xd0,0x4b,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xcf,0x5b,0x10,0x00,0x00,0xcf,0x5d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xcf,0x85,0x10,0x00,0x00,0xcf,0x87,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xcf,0x99,0x03,0x13,0x00,0x00,0xd0,0x42,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xcf,0xd2,0x10,0x00,0x00,0xcf,0xd4,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xcf,0xe8,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xd0,0x1c,0x10,0x00,0x00,0xd0,0x1e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xd0,0x3f,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xd0,0x48,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0f,0x00,0x00,0xd0,0x60,0x04,0x13,0x00,0x00,0xd0,0xdc,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5c,0x12,0x00,0x00,0xd0,0x95,0x10,0x00,0x00,0xd0,0x97,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xd0,0xd9,0x0c,0x04,0x00,0x00,0x00,0x0f,0x55,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x60,0x29,0x27,0x2e,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x79,0x12,0x00,0x00,0xd0,0xd6,0x06,0x05,0x04,0x14,0x08,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0f,0x00,0x00,0xd0,0xf1,0x04,0x13,0x00,0x00,0xd2,0x50,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xd1,0x2c,0x10,0x00,0x00,0xd1,0x2e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xd1,0x56,0x10,0x00,0x00,0xd1,0x58,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xd1,0x72,0x10,0x00,0x00,0xd1,0x74,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0xd1,0x8a,0x10,0x00,0x00,0xd1,0x8c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xd1,0x9e,0x03,0x13,0x00,0x00,0xd2,0x47,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xd1,0xd7,0x10,0x00,0x00,0xd1,0xd9,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xd1,0xed,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xd2,0x21,0x10,0x00,0x00,0xd2,0x23,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xd2,0x44,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xd2,0x4d,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x0f,0x00,0x00,0xd2,0x65,0x04,0x13,0x00,0x00,0xd3,0xa6,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x5d,0x12,0x00,0x00,0xd2,0x9e,0x10,0x00,0x00,0xd2,0xa0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xd2,0xc8,0x10,0x00,0x00,0xd2,0xca,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x12,0x12,0x00,0x00,0xd2,0xe0,0x10,0x00,0x00,0xd2,0xe2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xd2,0xf4,0x03,0x13,0x00,0x00,0xd3,0x9d,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xd3,0x2d,0x10,0x00,0x00,0xd3,0x2f,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xd3,0x43,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xd3,0x77,0x10,0x00,0x00,0xd3,0x79,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xd3,0x9a,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xd3,0xa3,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x29,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xd3,0xe3,0x10,0x00,0x00,0xd3,0xe5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x23,0x28,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xd4,0x18,0x10,0x00,0x00,0xd4,0x1a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x25,0x28,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xd4,0x50,0x10,0x00,0x00,0xd4,0x52,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x28,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xd4,0x87,0x10,0x00,0x00,0xd4,0x89,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x2e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xd4,0xbe,0x10,0x00,0x00,0xd4,0xc0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x0f,0x00,0x00,0xd4,0xd7,0x04,0x13,0x00,0x00,0xd5,0x72,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xd5,0x21,0x10,0x00,0x00,0xd5,0x23,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x2d,0x73,0x70,0x6c,0x69,0x63,0x69,0x6e,0x67,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xd5,0x53,0x10,0x00,0x00,0xd5,0x55,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0xd5,0x6f,0x06,0x05,0x04,0x14,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x2c,0x40,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xd5,0x92,0x10,0x00,0x00,0xd5,0x94,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x0f,0x00,0x00,0xd5,0xab,0x04,0x13,0x00,0x00,0xd6,0x3d,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xd5,0xf5,0x10,0x00,0x00,0xd5,0xf7,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x07,0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xd6,0x1e,0x10,0x00,0x00,0xd6,0x20,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0xd6,0x3a,0x06,0x05,0x04,0x14,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x2c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xd6,0x5c,0x10,0x00,0x00,0xd6,0x5e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x02,0x01,0x00,0x0f,0x00,0x00,0xd6,0x75,0x04,0x13,0x00,0x00,0xd7,0x0a,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xd6,0xbf,0x10,0x00,0x00,0xd6,0xc1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x71,0x75,0x61,0x73,0x69,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xd6,0xeb,0x10,0x00,0x00,0xd6,0xed,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0xd7,0x07,0x06,0x05,0x04,0x14,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x60,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xd7,0x29,0x10,0x00,0x00,0xd7,0x2b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x01,0x00,0x0f,0x00,0x00,0xd7,0x40,0x04,0x13,0x00,0x00,0xd7,0xd0,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xd7,0x8a,0x10,0x00,0x00,0xd7,0x8c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xd7,0xb1,0x10,0x00,0x00,0xd7,0xb3,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0xd7,0xcd,0x06,0x05,0x04,0x14,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x27,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xd7,0xef,0x10,0x00,0x00,0xd7,0xf1,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x11,0x12,0x00,0x00,0xd8,0x0a,0x10,0x00,0x00,0xd8,0x0c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0xd8,0x22,0x10,0x00,0x00,0xd8,0x24,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x02,0x01,0x0f,0x00,0x00,0xd8,0x3d,0x04,0x13,0x00,0x00,0xd8,0xe3,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xd8,0x6a,0x10,0x00,0x00,0xd8,0x6c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xd8,0x82,0x10,0x00,0x00,0xd8,0x84,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xd8,0xc7,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xd8,0xaf,0x10,0x00,0x00,0xd8,0xb1,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x6c,0x12,0x00,0x00,0xd8,0xc4,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xd8,0xe0,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x0f,0x00,0x00,0xd8,0xf4,0x04,0x14,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0xd9,0x18,0x10,0x00,0x00,0xd9,0x1a,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x15,0x00,0x00,0xda,0xf1,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xd9,0x5b,0x10,0x00,0x00,0xd9,0x5d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x41,0x12,0x00,0x00,0xd9,0x81,0x10,0x00,0x00,0xd9,0x83,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xda,0x1a,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x01,0x00,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xd9,0xdb,0x10,0x00,0x00,0xd9,0xdd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x41,0x12,0x00,0x00,0xda,0x09,0x10,0x00,0x00,0xda,0x01,0x06,0x07,0x03,0x04,0x13,0x00,0x00,0xda,0x0b,0x05,0x03,0x02,0x02,0x02,0x01,0x02,0x00,0x12,0x00,0x00,0xda,0x17,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xda,0x4a,0x10,0x00,0x00,0xda,0x4c,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xda,0x75,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x12,0x00,0x00,0xda,0x72,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xda,0xab,0x10,0x00,0x00,0xda,0xad,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x12,0x00,0x00,0xda,0xd6,0x10,0x00,0x00,0xda,0xd8,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xda,0xee,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x09,0x12,0x00,0x00,0xdb,0x21,0x10,0x00,0x00,0xdb,0x23,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x00,0xdb,0x2f,0x0a,0x04,0x14,0x0c,0x04,0x00,0x00,0x00,0x17,0x55,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x2e,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x12,0x00,0x00,0xdb,0x5f,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xdb,0x6d,0x10,0x00,0x00,0xdb,0x6f,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xdb,0x8e,0x04,0x13,0x00,0x00,0xdd,0xb1,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x5a,0x12,0x00,0x00,0xdb,0xbd,0x10,0x00,0x00,0xdb,0xbf,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x00,0xdb,0xcf,0x03,0x13,0x00,0x00,0xdc,0x74,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xdb,0xf2,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x13,0x43,0x6f,0x75,0x6c,0x64,0x6e,0x27,0x74,0x20,0x72,0x65,0x61,0x64,0x20,0x66,0x69,0x6c,0x65,0x3a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x60,0x12,0x00,0x00,0xdc,0x31,0x10,0x00,0x00,0xdc,0x33,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xdc,0x45,0x03,0x13,0x00,0x00,0xdc,0x6b,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xdc,0x68,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x00,0xdc,0x71,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xdc,0x7f,0x10,0x00,0x00,0xdc,0x81,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7a,0x12,0x00,0x00,0xdc,0x9b,0x10,0x00,0x00,0xdc,0x9d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xdc,0xaf,0x03,0x13,0x00,0x00,0xdd,0xa8,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x0f,0x00,0x00,0xdc,0xc3,0x04,0x13,0x00,0x00,0xdd,0x52,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xdd,0x4f,0x01,0x01,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xdd,0x0d,0x10,0x00,0x00,0xdd,0x0f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xdd,0x29,0x10,0x00,0x00,0xdd,0x2b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xdd,0x4c,0x06,0x05,0x04,0x14,0x08,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xdd,0x8c,0x10,0x00,0x00,0xdd,0x8e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xdd,0xa5,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xdd,0xae,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xdd,0xce,0x04,0x13,0x00,0x00,0xdf,0x13,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7a,0x12,0x00,0x00,0xdd,0xfd,0x10,0x00,0x00,0xdd,0xff,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xde,0x11,0x03,0x13,0x00,0x00,0xdf,0x0a,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x0f,0x00,0x00,0xde,0x25,0x04,0x13,0x00,0x00,0xde,0xb4,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xde,0xb1,0x01,0x01,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xde,0x6f,0x10,0x00,0x00,0xde,0x71,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xde,0x8b,0x10,0x00,0x00,0xde,0x8d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xde,0xae,0x06,0x05,0x04,0x14,0x08,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x7b,0x12,0x00,0x00,0xde,0xee,0x10,0x00,0x00,0xde,0xf0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x12,0x00,0x00,0xdf,0x07,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xdf,0x10,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7d,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xdf,0x30,0x04,0x13,0x00,0x00,0xe3,0x0c,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x0b,0x04,0x00,0x00,0x00,0x00,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1b,0x0c,0x04,0x00,0x00,0x00,0x00,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1c,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xdf,0x7d,0x10,0x00,0x00,0xdf,0x7f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4b,0x12,0x00,0x00,0xdf,0xa7,0x10,0x00,0x00,0xdf,0xa9,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x09,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xdf,0xf0,0x10,0x00,0x00,0xdf,0xf2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x12,0x00,0x00,0xe0,0x0c,0x10,0x00,0x00,0xe0,0x0e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe0,0x27,0x10,0x00,0x00,0xe0,0x29,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x65,0x6e,0x76,0x5f,0x65,0x78,0x74,0x65,0x6e,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe0,0x53,0x10,0x00,0x00,0xe0,0x55,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe0,0x6e,0x10,0x00,0x00,0xe0,0x70,0x06,0x05,0x04,0x03,0x00,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xe0,0x96,0x10,0x00,0x00,0xe0,0x98,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x76,0x12,0x00,0x00,0xe0,0xb5,0x10,0x00,0x00,0xe0,0xb7,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0f,0x00,0x00,0xe0,0xd7,0x04,0x13,0x00,0x00,0xe1,0x6f,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0a,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x00,0xe1,0x0b,0x10,0x00,0x00,0xe1,0x0d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0d,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x04,0x00,0x04,0x00,0x0d,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x4e,0x12,0x00,0x00,0xe1,0x50,0x10,0x00,0x00,0xe1,0x52,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x76,0x12,0x00,0x00,0xe1,0x6c,0x06,0x05,0x04,0x14,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x19,0x12,0x00,0x00,0xe1,0x88,0x10,0x00,0x00,0xe1,0x8a,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x09,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe1,0xcc,0x10,0x00,0x00,0xe1,0xce,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe1,0xe7,0x10,0x00,0x00,0xe1,0xe9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x08,0x04,0x04,0x00,0x04,0x00,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x6e,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe2,0x1a,0x10,0x00,0x00,0xe2,0x1c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x12,0x00,0x00,0xe2,0x39,0x10,0x00,0x00,0xe2,0x3b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x76,0x12,0x00,0x00,0xe2,0x58,0x10,0x00,0x00,0xe2,0x5a,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x00,0xe2,0x8d,0x10,0x00,0x00,0xe2,0x8f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe2,0xa8,0x10,0x00,0x00,0xe2,0xaa,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe2,0xce,0x10,0x00,0x00,0xe2,0xd0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe2,0xf4,0x10,0x00,0x00,0xe2,0xf6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x12,0x12,0x00,0x00,0xe3,0x09,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xe3,0x29,0x04,0x13,0x00,0x00,0xe4,0xed,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7c,0x12,0x00,0x00,0xe3,0x76,0x10,0x00,0x00,0xe3,0x78,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7e,0x12,0x00,0x00,0xe3,0xa3,0x10,0x00,0x00,0xe3,0xa5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x3b,0x12,0x00,0x00,0xe3,0xbe,0x10,0x00,0x00,0xe3,0xc0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x00,0xe3,0xd2,0x03,0x13,0x00,0x00,0xe4,0xe4,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x02,0x3b,0x0a,0x03,0x00,0x04,0x01,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x2e,0x12,0x00,0x00,0xe4,0x10,0x10,0x00,0x00,0xe4,0x12,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x5b,0x12,0x00,0x00,0xe4,0x28,0x10,0x00,0x00,0xe4,0x2a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0c,0x04,0x00,0x00,0x00,0x1a,0x20,0x7d,0x3b,0x0a,0x0a,0x49,0x4e,0x54,0x20,0x62,0x6f,0x6f,0x74,0x73,0x74,0x72,0x61,0x70,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x04,0x00,0x04,0x00,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x7f,0x12,0x00,0x00,0xe4,0x76,0x10,0x00,0x00,0xe4,0x78,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x0c,0x04,0x00,0x00,0x00,0x23,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x63,0x68,0x61,0x72,0x20,0x62,0x6f,0x6f,0x74,0x73,0x74,0x72,0x61,0x70,0x5f,0x63,0x6f,0x64,0x65,0x5b,0x5d,0x20,0x3d,0x0a,0x7b,0x20,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x26,0x12,0x00,0x00,0xe4,0xbe,0x10,0x00,0x00,0xe4,0xc0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x7e,0x12,0x00,0x00,0xe4,0xe1,0x06,0x05,0x04,0x14,0x12,0x00,0x00,0xe4,0xea,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xe5,0x0a,0x04,0x13,0x00,0x00,0xe5,0xb2,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x08,0x00,0x01,0x00,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x00,0x08,0x04,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe5,0x52,0x10,0x00,0x00,0xe5,0x54,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x0c,0x04,0x00,0x00,0x00,0x06,0x28,0x65,0x76,0x61,0x6c,0x29,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7e,0x12,0x00,0x00,0xe5,0x81,0x10,0x00,0x00,0xe5,0x83,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x62,0x12,0x00,0x00,0xe5,0xa1,0x10,0x00,0x00,0xe5,0x99,0x06,0x07,0x03,0x04,0x13,0x00,0x00,0xe5,0xa3,0x05,0x03,0x02,0x02,0x02,0x01,0x02,0x00,0x12,0x00,0x00,0xe5,0xaf,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xe5,0xcf,0x04,0x13,0x00,0x00,0xe6,0x73,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x08,0x00,0x01,0x00,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x01,0x02,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7c,0x12,0x00,0x00,0xe6,0x15,0x10,0x00,0x00,0xe6,0x17,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7e,0x12,0x00,0x00,0xe6,0x42,0x10,0x00,0x00,0xe6,0x44,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x62,0x12,0x00,0x00,0xe6,0x62,0x10,0x00,0x00,0xe6,0x5a,0x06,0x07,0x03,0x04,0x13,0x00,0x00,0xe6,0x64,0x05,0x03,0x02,0x02,0x02,0x01,0x02,0x00,0x12,0x00,0x00,0xe6,0x70,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x00,0xe6,0x90,0x04,0x13,0x00,0x00,0xe7,0x15,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe6,0xbb,0x10,0x00,0x00,0xe6,0xbd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x6e,0x12,0x00,0x00,0xe6,0xdc,0x10,0x00,0x00,0xe6,0xde,0x06,0x05,0x04,0x03,0x00,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe6,0xfa,0x10,0x00,0x00,0xe6,0xfc,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe7,0x12,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x01,0x02,0x01,0x02,0x07,0x04,0x02,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x7c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe9,0x76,0x10,0x00,0x00,0xe9,0x78,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x09,0x72,0x65,0x61,0x64,0x2d,0x66,0x69,0x6c,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe9,0xa1,0x10,0x00,0x00,0xe9,0xa3,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe9,0xbc,0x10,0x00,0x00,0xe9,0xbe,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x50,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xe9,0xe7,0x10,0x00,0x00,0xe9,0xe9,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x73,0x65,0x71,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xea,0x14,0x10,0x00,0x00,0xea,0x16,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xea,0x2f,0x10,0x00,0x00,0xea,0x31,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x11,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xea,0x5a,0x10,0x00,0x00,0xea,0x5c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x63,0x64,0x61,0x61,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xea,0x81,0x10,0x00,0x00,0xea,0x83,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xea,0x9c,0x10,0x00,0x00,0xea,0x9e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x10,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xea,0xc7,0x10,0x00,0x00,0xea,0xc9,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x63,0x61,0x64,0x61,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xea,0xee,0x10,0x00,0x00,0xea,0xf0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xeb,0x09,0x10,0x00,0x00,0xeb,0x0b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x70,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xeb,0x34,0x10,0x00,0x00,0xeb,0x36,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x17,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x74,0x61,0x63,0x6b,0x2d,0x6f,0x6e,0x2d,0x73,0x65,0x71,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xeb,0x6d,0x10,0x00,0x00,0xeb,0x6f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xeb,0x88,0x10,0x00,0x00,0xeb,0x8a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x6c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xeb,0xb3,0x10,0x00,0x00,0xeb,0xb5,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x15,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x73,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xeb,0xea,0x10,0x00,0x00,0xeb,0xec,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xec,0x05,0x10,0x00,0x00,0xec,0x07,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x65,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xec,0x30,0x10,0x00,0x00,0xec,0x32,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x18,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x61,0x6c,0x6c,0x2d,0x72,0x65,0x67,0x73,0x2d,0x6f,0x6c,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xec,0x6a,0x10,0x00,0x00,0xec,0x6c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xec,0x85,0x10,0x00,0x00,0xec,0x87,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x7a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xec,0xb0,0x10,0x00,0x00,0xec,0xb2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x72,0x65,0x61,0x64,0x2d,0x74,0x6f,0x6b,0x65,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xec,0xdc,0x10,0x00,0x00,0xec,0xde,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xec,0xf7,0x10,0x00,0x00,0xec,0xf9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x51,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xed,0x22,0x10,0x00,0x00,0xed,0x24,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x74,0x6f,0x6d,0x69,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xed,0x52,0x10,0x00,0x00,0xed,0x54,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xed,0x6d,0x10,0x00,0x00,0xed,0x6f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x38,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xed,0x98,0x10,0x00,0x00,0xed,0x9a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x08,0x65,0x78,0x70,0x2d,0x72,0x65,0x73,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xed,0xc2,0x10,0x00,0x00,0xed,0xc4,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xed,0xdd,0x10,0x00,0x00,0xed,0xdf,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x49,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xee,0x08,0x10,0x00,0x00,0xee,0x0a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x65,0x6e,0x76,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xee,0x34,0x10,0x00,0x00,0xee,0x36,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xee,0x4f,0x10,0x00,0x00,0xee,0x51,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x06,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xee,0x7a,0x10,0x00,0x00,0xee,0x7c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x65,0x72,0x72,0x6f,0x72,0x2d,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xee,0xa9,0x10,0x00,0x00,0xee,0xab,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xee,0xc4,0x10,0x00,0x00,0xee,0xc6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x54,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xee,0xef,0x10,0x00,0x00,0xee,0xf1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xef,0x1e,0x10,0x00,0x00,0xef,0x20,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xef,0x39,0x10,0x00,0x00,0xef,0x3b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x37,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xef,0x64,0x10,0x00,0x00,0xef,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x09,0x65,0x78,0x70,0x2d,0x66,0x69,0x72,0x73,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xef,0x8f,0x10,0x00,0x00,0xef,0x91,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xef,0xaa,0x10,0x00,0x00,0xef,0xac,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x82,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xef,0xd5,0x10,0x00,0x00,0xef,0xd7,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x11,0x65,0x6d,0x70,0x74,0x79,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf0,0x08,0x10,0x00,0x00,0xf0,0x0a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf0,0x23,0x10,0x00,0x00,0xf0,0x25,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x48,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf0,0x4e,0x10,0x00,0x00,0xf0,0x50,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x65,0x6e,0x76,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf0,0x7c,0x10,0x00,0x00,0xf0,0x7e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf0,0x97,0x10,0x00,0x00,0xf0,0x99,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x12,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf0,0xc2,0x10,0x00,0x00,0xf0,0xc4,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x63,0x61,0x64,0x64,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf0,0xe9,0x10,0x00,0x00,0xf0,0xeb,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf1,0x04,0x10,0x00,0x00,0xf1,0x06,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x6e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf1,0x2f,0x10,0x00,0x00,0xf1,0x31,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x17,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x61,0x70,0x70,0x65,0x6e,0x64,0x2d,0x73,0x65,0x71,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf1,0x68,0x10,0x00,0x00,0xf1,0x6a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf1,0x83,0x10,0x00,0x00,0xf1,0x85,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x45,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf1,0xae,0x10,0x00,0x00,0xf1,0xb0,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0b,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x72,0x65,0x73,0x65,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf1,0xdb,0x10,0x00,0x00,0xf1,0xdd,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf1,0xf6,0x10,0x00,0x00,0xf1,0xf8,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x40,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf2,0x21,0x10,0x00,0x00,0xf2,0x23,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x14,0x65,0x78,0x70,0x2d,0x63,0x61,0x6c,0x6c,0x2f,0x63,0x63,0x2d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf2,0x57,0x10,0x00,0x00,0xf2,0x59,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf2,0x72,0x10,0x00,0x00,0xf2,0x74,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x13,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf2,0x9d,0x10,0x00,0x00,0xf2,0x9f,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x63,0x64,0x61,0x64,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf2,0xc4,0x10,0x00,0x00,0xf2,0xc6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf2,0xdf,0x10,0x00,0x00,0xf2,0xe1,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf3,0x0a,0x10,0x00,0x00,0xf3,0x0c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x54,0x52,0x41,0x50,0x2d,0x45,0x52,0x52,0x4f,0x52,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf3,0x36,0x10,0x00,0x00,0xf3,0x38,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf3,0x51,0x10,0x00,0x00,0xf3,0x53,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x4e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf3,0x7c,0x10,0x00,0x00,0xf3,0x7e,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x07,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf3,0xa5,0x10,0x00,0x00,0xf3,0xa7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf3,0xc0,0x10,0x00,0x00,0xf3,0xc2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x6f,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf3,0xeb,0x10,0x00,0x00,0xf3,0xed,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x19,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x2d,0x73,0x65,0x71,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf4,0x26,0x10,0x00,0x00,0xf4,0x28,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf4,0x41,0x10,0x00,0x00,0xf4,0x43,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x46,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf4,0x6c,0x10,0x00,0x00,0xf4,0x6e,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x6d,0x61,0x6b,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf4,0x98,0x10,0x00,0x00,0xf4,0x9a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf4,0xb3,0x10,0x00,0x00,0xf4,0xb5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x36,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf4,0xde,0x10,0x00,0x00,0xf4,0xe0,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x18,0x65,0x78,0x70,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf5,0x18,0x10,0x00,0x00,0xf5,0x1a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf5,0x33,0x10,0x00,0x00,0xf5,0x35,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x32,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf5,0x5e,0x10,0x00,0x00,0xf5,0x60,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x12,0x65,0x78,0x70,0x2d,0x61,0x70,0x70,0x6c,0x79,0x2d,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf5,0x92,0x10,0x00,0x00,0xf5,0x94,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf5,0xad,0x10,0x00,0x00,0xf5,0xaf,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x30,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf5,0xd8,0x10,0x00,0x00,0xf5,0xda,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x11,0x65,0x78,0x70,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,0x70,0x61,0x72,0x61,0x6d,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf6,0x0b,0x10,0x00,0x00,0xf6,0x0d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf6,0x26,0x10,0x00,0x00,0xf6,0x28,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x52,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf6,0x51,0x10,0x00,0x00,0xf6,0x53,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf6,0x82,0x10,0x00,0x00,0xf6,0x84,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf6,0x9d,0x10,0x00,0x00,0xf6,0x9f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf6,0xc8,0x10,0x00,0x00,0xf6,0xca,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x2d,0x62,0x65,0x67,0x69,0x6e,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf6,0xf4,0x10,0x00,0x00,0xf6,0xf6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf7,0x0f,0x10,0x00,0x00,0xf7,0x11,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x7b,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf7,0x3a,0x10,0x00,0x00,0xf7,0x3c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x70,0x61,0x72,0x65,0x6e,0x74,0x68,0x65,0x73,0x69,0x66,0x79,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf7,0x68,0x10,0x00,0x00,0xf7,0x6a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf7,0x83,0x10,0x00,0x00,0xf7,0x85,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x15,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf7,0xae,0x10,0x00,0x00,0xf7,0xb0,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x63,0x64,0x64,0x64,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf7,0xd5,0x10,0x00,0x00,0xf7,0xd7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf7,0xf0,0x10,0x00,0x00,0xf7,0xf2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x72,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf8,0x1b,0x10,0x00,0x00,0xf8,0x1d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0f,0x6c,0x69,0x6e,0x6b,0x61,0x67,0x65,0x2d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf8,0x4c,0x10,0x00,0x00,0xf8,0x4e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf8,0x67,0x10,0x00,0x00,0xf8,0x69,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x5e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf8,0x92,0x10,0x00,0x00,0xf8,0x94,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x2d,0x6c,0x6f,0x6f,0x70,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf8,0xd4,0x10,0x00,0x00,0xf8,0xd6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf8,0xef,0x10,0x00,0x00,0xf8,0xf1,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x2d,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf9,0x1a,0x10,0x00,0x00,0xf9,0x1c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x65,0x78,0x70,0x2d,0x69,0x66,0x2d,0x70,0x72,0x65,0x64,0x69,0x63,0x61,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf9,0x4c,0x10,0x00,0x00,0xf9,0x4e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf9,0x67,0x10,0x00,0x00,0xf9,0x69,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x23,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf9,0x92,0x10,0x00,0x00,0xf9,0x94,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x2d,0x71,0x75,0x6f,0x74,0x65,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf9,0xbe,0x10,0x00,0x00,0xf9,0xc0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xf9,0xd9,0x10,0x00,0x00,0xf9,0xdb,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x1b,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfa,0x04,0x10,0x00,0x00,0xfa,0x06,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x02,0x70,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfa,0x28,0x10,0x00,0x00,0xfa,0x2a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfa,0x43,0x10,0x00,0x00,0xfa,0x45,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x57,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfa,0x6e,0x10,0x00,0x00,0xfa,0x70,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x13,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,0x61,0x72,0x67,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfa,0xa3,0x10,0x00,0x00,0xfa,0xa5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfa,0xbe,0x10,0x00,0x00,0xfa,0xc0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x69,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfa,0xe9,0x10,0x00,0x00,0xfa,0xeb,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x12,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x6e,0x65,0x65,0x64,0x65,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfb,0x1d,0x10,0x00,0x00,0xfb,0x1f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfb,0x38,0x10,0x00,0x00,0xfb,0x3a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x55,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfb,0x63,0x10,0x00,0x00,0xfb,0x65,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfb,0x95,0x10,0x00,0x00,0xfb,0x97,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfb,0xb0,0x10,0x00,0x00,0xfb,0xb2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x34,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfb,0xdb,0x10,0x00,0x00,0xfb,0xdd,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x65,0x78,0x70,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfc,0x0d,0x10,0x00,0x00,0xfc,0x0f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfc,0x28,0x10,0x00,0x00,0xfc,0x2a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x0a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfc,0x53,0x10,0x00,0x00,0xfc,0x55,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x61,0x61,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfc,0x79,0x10,0x00,0x00,0xfc,0x7b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfc,0x94,0x10,0x00,0x00,0xfc,0x96,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x5a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfc,0xbf,0x10,0x00,0x00,0xfc,0xc1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x69,0x66,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfc,0xeb,0x10,0x00,0x00,0xfc,0xed,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfd,0x06,0x10,0x00,0x00,0xfd,0x08,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x5b,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfd,0x31,0x10,0x00,0x00,0xfd,0x33,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x79,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfd,0x60,0x10,0x00,0x00,0xfd,0x62,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfd,0x7b,0x10,0x00,0x00,0xfd,0x7d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x5d,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfd,0xa6,0x10,0x00,0x00,0xfd,0xa8,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x13,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfd,0xdb,0x10,0x00,0x00,0xfd,0xdd,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfd,0xf6,0x10,0x00,0x00,0xfd,0xf8,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x14,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfe,0x21,0x10,0x00,0x00,0xfe,0x23,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x63,0x64,0x64,0x61,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfe,0x48,0x10,0x00,0x00,0xfe,0x4a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfe,0x63,0x10,0x00,0x00,0xfe,0x65,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfe,0x8e,0x10,0x00,0x00,0xfe,0x90,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfe,0xc0,0x10,0x00,0x00,0xfe,0xc2,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xfe,0xdb,0x10,0x00,0x00,0xfe,0xdd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x6b,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xff,0x06,0x10,0x00,0x00,0xff,0x08,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x12,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x6e,0x65,0x65,0x64,0x73,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xff,0x3a,0x10,0x00,0x00,0xff,0x3c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xff,0x55,0x10,0x00,0x00,0xff,0x57,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x3f,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xff,0x80,0x10,0x00,0x00,0xff,0x82,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x12,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x71,0x75,0x61,0x73,0x69,0x71,0x75,0x6f,0x74,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xff,0xb4,0x10,0x00,0x00,0xff,0xb6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xff,0xcf,0x10,0x00,0x00,0xff,0xd1,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x33,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x00,0xff,0xfa,0x10,0x00,0x00,0xff,0xfc,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x12,0x65,0x78,0x70,0x2d,0x61,0x70,0x70,0x6c,0x79,0x2d,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x00,0x2e,0x10,0x00,0x01,0x00,0x30,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x00,0x49,0x10,0x00,0x01,0x00,0x4b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x4b,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x00,0x74,0x10,0x00,0x01,0x00,0x76,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x16,0x65,0x6e,0x76,0x2d,0x65,0x78,0x74,0x65,0x6e,0x64,0x2d,0x64,0x65,0x66,0x69,0x6e,0x69,0x74,0x69,0x6f,0x6e,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x00,0xac,0x10,0x00,0x01,0x00,0xae,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x00,0xc7,0x10,0x00,0x01,0x00,0xc9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x7d,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x00,0xf2,0x10,0x00,0x01,0x00,0xf4,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x72,0x65,0x61,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x01,0x18,0x10,0x00,0x01,0x01,0x1a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x01,0x33,0x10,0x00,0x01,0x01,0x35,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x18,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x01,0x5e,0x10,0x00,0x01,0x01,0x60,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x6d,0x61,0x70,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x01,0x83,0x10,0x00,0x01,0x01,0x85,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x01,0x9e,0x10,0x00,0x01,0x01,0xa0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x4c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x01,0xc9,0x10,0x00,0x01,0x01,0xcb,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x65,0x6e,0x76,0x2d,0x6c,0x6f,0x6f,0x6b,0x75,0x70,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x01,0xf5,0x10,0x00,0x01,0x01,0xf7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x02,0x10,0x10,0x00,0x01,0x02,0x12,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x01,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x02,0x3b,0x10,0x00,0x01,0x02,0x3d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x54,0x52,0x41,0x50,0x2d,0x43,0x41,0x54,0x43,0x48,0x2d,0x53,0x54,0x41,0x43,0x4b,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x02,0x6d,0x10,0x00,0x01,0x02,0x6f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x02,0x88,0x10,0x00,0x01,0x02,0x8a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x85,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x02,0xb3,0x10,0x00,0x01,0x02,0xb5,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x72,0x65,0x70,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x02,0xd9,0x10,0x00,0x01,0x02,0xdb,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x02,0xf4,0x10,0x00,0x01,0x02,0xf6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x56,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x03,0x1f,0x10,0x00,0x01,0x03,0x21,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x03,0x4f,0x10,0x00,0x01,0x03,0x51,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x03,0x6a,0x10,0x00,0x01,0x03,0x6c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x03,0x95,0x10,0x00,0x01,0x03,0x97,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x63,0x61,0x74,0x63,0x68,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x03,0xbc,0x10,0x00,0x01,0x03,0xbe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x03,0xd7,0x10,0x00,0x01,0x03,0xd9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x63,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x04,0x02,0x10,0x00,0x01,0x04,0x04,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x63,0x6f,0x64,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x04,0x34,0x10,0x00,0x01,0x04,0x36,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x04,0x4f,0x10,0x00,0x01,0x04,0x51,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x4d,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x04,0x7a,0x10,0x00,0x01,0x04,0x7c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x65,0x78,0x70,0x2d,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x04,0xa8,0x10,0x00,0x01,0x04,0xaa,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x04,0xc3,0x10,0x00,0x01,0x04,0xc5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x0c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x04,0xee,0x10,0x00,0x01,0x04,0xf0,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x64,0x61,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x05,0x14,0x10,0x00,0x01,0x05,0x16,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x05,0x2f,0x10,0x00,0x01,0x05,0x31,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x05,0x5a,0x10,0x00,0x01,0x05,0x5c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6c,0x65,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x05,0x87,0x10,0x00,0x01,0x05,0x89,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x05,0xa2,0x10,0x00,0x01,0x05,0xa4,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x80,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x05,0xcd,0x10,0x00,0x01,0x05,0xcf,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x65,0x76,0x61,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x05,0xf3,0x10,0x00,0x01,0x05,0xf5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x06,0x0e,0x10,0x00,0x01,0x06,0x10,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x1e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x06,0x39,0x10,0x00,0x01,0x06,0x3b,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x6c,0x69,0x73,0x74,0x2d,0x75,0x6e,0x69,0x6f,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x06,0x65,0x10,0x00,0x01,0x06,0x67,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x06,0x80,0x10,0x00,0x01,0x06,0x82,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x7f,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x06,0xab,0x10,0x00,0x01,0x06,0xad,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x2d,0x64,0x75,0x6d,0x70,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x06,0xd9,0x10,0x00,0x01,0x06,0xdb,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x06,0xf4,0x10,0x00,0x01,0x06,0xf6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x09,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x07,0x1f,0x10,0x00,0x01,0x07,0x21,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x01,0x3d,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x07,0x42,0x10,0x00,0x01,0x07,0x44,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x07,0x5d,0x10,0x00,0x01,0x07,0x5f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x0b,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x07,0x88,0x10,0x00,0x01,0x07,0x8a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x61,0x64,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x07,0xae,0x10,0x00,0x01,0x07,0xb0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x07,0xc9,0x10,0x00,0x01,0x07,0xcb,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x61,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x07,0xf4,0x10,0x00,0x01,0x07,0xf6,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x73,0x70,0x65,0x63,0x69,0x61,0x6c,0x2d,0x66,0x6f,0x72,0x6d,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x08,0x23,0x10,0x00,0x01,0x08,0x25,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x08,0x3e,0x10,0x00,0x01,0x08,0x40,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x2e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x08,0x69,0x10,0x00,0x01,0x08,0x6b,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x11,0x65,0x78,0x70,0x2d,0x69,0x66,0x2d,0x63,0x6f,0x6e,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x08,0x9c,0x10,0x00,0x01,0x08,0x9e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x08,0xb7,0x10,0x00,0x01,0x08,0xb9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x24,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x08,0xe2,0x10,0x00,0x01,0x08,0xe4,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x65,0x78,0x70,0x2d,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x09,0x11,0x10,0x00,0x01,0x09,0x13,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x09,0x2c,0x10,0x00,0x01,0x09,0x2e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x74,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x09,0x57,0x10,0x00,0x01,0x09,0x59,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x14,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x09,0x8d,0x10,0x00,0x01,0x09,0x8f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x09,0xa8,0x10,0x00,0x01,0x09,0xaa,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x22,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x09,0xd3,0x10,0x00,0x01,0x09,0xd5,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0b,0x65,0x78,0x70,0x2d,0x76,0x65,0x63,0x74,0x6f,0x72,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0a,0x00,0x10,0x00,0x01,0x0a,0x02,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0a,0x1b,0x10,0x00,0x01,0x0a,0x1d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x84,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0a,0x46,0x10,0x00,0x01,0x0a,0x48,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x17,0x69,0x6e,0x74,0x65,0x72,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0a,0x7f,0x10,0x00,0x01,0x0a,0x81,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0a,0x9a,0x10,0x00,0x01,0x0a,0x9c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x08,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0a,0xc5,0x10,0x00,0x01,0x0a,0xc7,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x03,0x6e,0x6f,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0a,0xea,0x10,0x00,0x01,0x0a,0xec,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0b,0x05,0x10,0x00,0x01,0x0b,0x07,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x6a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0b,0x30,0x10,0x00,0x01,0x0b,0x32,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x14,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0b,0x66,0x10,0x00,0x01,0x0b,0x68,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0b,0x81,0x10,0x00,0x01,0x0b,0x83,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x41,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0b,0xac,0x10,0x00,0x01,0x0b,0xae,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x63,0x61,0x6c,0x6c,0x2f,0x63,0x63,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0b,0xdd,0x10,0x00,0x01,0x0b,0xdf,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0b,0xf8,0x10,0x00,0x01,0x0b,0xfa,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x43,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0c,0x23,0x10,0x00,0x01,0x0c,0x25,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x1b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0c,0x60,0x10,0x00,0x01,0x0c,0x62,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0c,0x7b,0x10,0x00,0x01,0x0c,0x7d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x4f,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0c,0xa6,0x10,0x00,0x01,0x0c,0xa8,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x62,0x65,0x67,0x69,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0c,0xd5,0x10,0x00,0x01,0x0c,0xd7,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0c,0xf0,0x10,0x00,0x01,0x0c,0xf2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x27,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0d,0x1b,0x10,0x00,0x01,0x0d,0x1d,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x11,0x65,0x78,0x70,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0d,0x4e,0x10,0x00,0x01,0x0d,0x50,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0d,0x69,0x10,0x00,0x01,0x0d,0x6b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x17,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0d,0x94,0x10,0x00,0x01,0x0d,0x96,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x63,0x61,0x64,0x61,0x64,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0d,0xbc,0x10,0x00,0x01,0x0d,0xbe,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0d,0xd7,0x10,0x00,0x01,0x0d,0xd9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x05,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0e,0x02,0x10,0x00,0x01,0x0e,0x04,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x65,0x72,0x72,0x6f,0x72,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0e,0x2a,0x10,0x00,0x01,0x0e,0x2c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0e,0x45,0x10,0x00,0x01,0x0e,0x47,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x66,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0e,0x70,0x10,0x00,0x01,0x0e,0x72,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x14,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x6d,0x61,0x6b,0x65,0x2d,0x73,0x65,0x71,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0e,0xa6,0x10,0x00,0x01,0x0e,0xa8,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0e,0xc1,0x10,0x00,0x01,0x0e,0xc3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x1f,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0e,0xec,0x10,0x00,0x01,0x0e,0xee,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0f,0x6c,0x69,0x73,0x74,0x2d,0x64,0x69,0x66,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0f,0x1d,0x10,0x00,0x01,0x0f,0x1f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0f,0x38,0x10,0x00,0x01,0x0f,0x3a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x5c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0f,0x63,0x10,0x00,0x01,0x0f,0x65,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x16,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x79,0x2d,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0f,0x9b,0x10,0x00,0x01,0x0f,0x9d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0f,0xb6,0x10,0x00,0x01,0x0f,0xb8,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x83,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x0f,0xe1,0x10,0x00,0x01,0x0f,0xe3,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x1d,0x69,0x6e,0x74,0x65,0x72,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x2d,0x76,0x61,0x6c,0x75,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x10,0x20,0x10,0x00,0x01,0x10,0x22,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x10,0x3b,0x10,0x00,0x01,0x10,0x3d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x10,0x66,0x10,0x00,0x01,0x10,0x68,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x63,0x64,0x64,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x10,0x8c,0x10,0x00,0x01,0x10,0x8e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x10,0xa7,0x10,0x00,0x01,0x10,0xa9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x26,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x10,0xd2,0x10,0x00,0x01,0x10,0xd4,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x65,0x78,0x70,0x2d,0x73,0x65,0x74,0x2d,0x76,0x61,0x6c,0x75,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x11,0x01,0x10,0x00,0x01,0x11,0x03,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x11,0x1c,0x10,0x00,0x01,0x11,0x1e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x20,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x11,0x47,0x10,0x00,0x01,0x11,0x49,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0b,0x65,0x78,0x70,0x2d,0x61,0x74,0x6f,0x6d,0x69,0x63,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x11,0x74,0x10,0x00,0x01,0x11,0x76,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x11,0x8f,0x10,0x00,0x01,0x11,0x91,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x42,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x11,0xba,0x10,0x00,0x01,0x11,0xbc,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x24,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x12,0x00,0x10,0x00,0x01,0x12,0x02,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x12,0x1b,0x10,0x00,0x01,0x12,0x1d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x81,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x12,0x46,0x10,0x00,0x01,0x12,0x48,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x04,0x6c,0x6f,0x61,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x12,0x6c,0x10,0x00,0x01,0x12,0x6e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x12,0x87,0x10,0x00,0x01,0x12,0x89,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x1c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x12,0xb2,0x10,0x00,0x01,0x12,0xb4,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0b,0x74,0x68,0x65,0x2d,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x12,0xdf,0x10,0x00,0x01,0x12,0xe1,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x12,0xfa,0x10,0x00,0x01,0x12,0xfc,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x3d,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x13,0x25,0x10,0x00,0x01,0x13,0x27,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x63,0x6f,0x6e,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x13,0x53,0x10,0x00,0x01,0x13,0x55,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x13,0x6e,0x10,0x00,0x01,0x13,0x70,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x1a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x13,0x99,0x10,0x00,0x01,0x13,0x9b,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x76,0x61,0x6c,0x75,0x65,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x13,0xc1,0x10,0x00,0x01,0x13,0xc3,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x13,0xdc,0x10,0x00,0x01,0x13,0xde,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x07,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x14,0x07,0x10,0x00,0x01,0x14,0x09,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x77,0x65,0x72,0x72,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x14,0x2f,0x10,0x00,0x01,0x14,0x31,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x14,0x4a,0x10,0x00,0x01,0x14,0x4c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x62,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x14,0x75,0x10,0x00,0x01,0x14,0x77,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x11,0x65,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x65,0x2d,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x14,0xa8,0x10,0x00,0x01,0x14,0xaa,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x14,0xc3,0x10,0x00,0x01,0x14,0xc5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x3a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x14,0xee,0x10,0x00,0x01,0x14,0xf0,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x6e,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x15,0x1b,0x10,0x00,0x01,0x15,0x1d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x15,0x36,0x10,0x00,0x01,0x15,0x38,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x39,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x15,0x61,0x10,0x00,0x01,0x15,0x63,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x09,0x65,0x78,0x70,0x2d,0x6c,0x61,0x73,0x74,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x15,0x8c,0x10,0x00,0x01,0x15,0x8e,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x15,0xa7,0x10,0x00,0x01,0x15,0xa9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x31,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x15,0xd2,0x10,0x00,0x01,0x15,0xd4,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0f,0x65,0x78,0x70,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,0x62,0x6f,0x64,0x79,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x16,0x03,0x10,0x00,0x01,0x16,0x05,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x16,0x1e,0x10,0x00,0x01,0x16,0x20,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x3e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x16,0x49,0x10,0x00,0x01,0x16,0x4b,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0f,0x65,0x78,0x70,0x2d,0x71,0x75,0x61,0x73,0x69,0x71,0x75,0x6f,0x74,0x65,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x16,0x7a,0x10,0x00,0x01,0x16,0x7c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x16,0x95,0x10,0x00,0x01,0x16,0x97,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x2a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x16,0xc0,0x10,0x00,0x01,0x16,0xc2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x65,0x78,0x70,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x2d,0x76,0x61,0x6c,0x75,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x16,0xf2,0x10,0x00,0x01,0x16,0xf4,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x17,0x0d,0x10,0x00,0x01,0x17,0x0f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x5f,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x17,0x38,0x10,0x00,0x01,0x17,0x3a,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x1c,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x17,0x76,0x10,0x00,0x01,0x17,0x78,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x17,0x91,0x10,0x00,0x01,0x17,0x93,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x35,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x17,0xbc,0x10,0x00,0x01,0x17,0xbe,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x18,0x65,0x78,0x70,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x17,0xf6,0x10,0x00,0x01,0x17,0xf8,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x18,0x11,0x10,0x00,0x01,0x18,0x13,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x16,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x18,0x3c,0x10,0x00,0x01,0x18,0x3e,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x06,0x63,0x61,0x64,0x64,0x64,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x18,0x64,0x10,0x00,0x01,0x18,0x66,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x18,0x7f,0x10,0x00,0x01,0x18,0x81,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x7e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x18,0xaa,0x10,0x00,0x01,0x18,0xac,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x18,0xdb,0x10,0x00,0x01,0x18,0xdd,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x18,0xf6,0x10,0x00,0x01,0x18,0xf8,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x3b,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x19,0x21,0x10,0x00,0x01,0x19,0x23,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x19,0x4d,0x10,0x00,0x01,0x19,0x4f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x19,0x68,0x10,0x00,0x01,0x19,0x6a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x21,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x19,0x93,0x10,0x00,0x01,0x19,0x95,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x65,0x78,0x70,0x2d,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x19,0xc1,0x10,0x00,0x01,0x19,0xc3,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x19,0xdc,0x10,0x00,0x01,0x19,0xde,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x0f,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1a,0x07,0x10,0x00,0x01,0x1a,0x09,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x63,0x61,0x61,0x64,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1a,0x2e,0x10,0x00,0x01,0x1a,0x30,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1a,0x49,0x10,0x00,0x01,0x1a,0x4b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x79,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1a,0x74,0x10,0x00,0x01,0x1a,0x76,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x65,0x72,0x72,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1a,0xa3,0x10,0x00,0x01,0x1a,0xa5,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1a,0xbe,0x10,0x00,0x01,0x1a,0xc0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x73,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1a,0xe9,0x10,0x00,0x01,0x1a,0xeb,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0f,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1b,0x1a,0x10,0x00,0x01,0x1b,0x1c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1b,0x35,0x10,0x00,0x01,0x1b,0x37,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x68,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1b,0x60,0x10,0x00,0x01,0x1b,0x62,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x11,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x73,0x74,0x6d,0x74,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1b,0x93,0x10,0x00,0x01,0x1b,0x95,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1b,0xae,0x10,0x00,0x01,0x1b,0xb0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1b,0xd9,0x10,0x00,0x01,0x1b,0xdb,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0b,0x65,0x78,0x70,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1c,0x06,0x10,0x00,0x01,0x1c,0x08,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1c,0x21,0x10,0x00,0x01,0x1c,0x23,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x1d,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1c,0x4c,0x10,0x00,0x01,0x1c,0x4e,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x6c,0x69,0x73,0x74,0x2d,0x74,0x61,0x67,0x67,0x65,0x64,0x3f,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1c,0x7a,0x10,0x00,0x01,0x1c,0x7c,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1c,0x95,0x10,0x00,0x01,0x1c,0x97,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x71,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1c,0xc0,0x10,0x00,0x01,0x1c,0xc2,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0b,0x6c,0x69,0x6e,0x6b,0x61,0x67,0x65,0x2d,0x65,0x6e,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1c,0xed,0x10,0x00,0x01,0x1c,0xef,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1d,0x08,0x10,0x00,0x01,0x1d,0x0a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x44,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1d,0x33,0x10,0x00,0x01,0x1d,0x35,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0d,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1d,0x62,0x10,0x00,0x01,0x1d,0x64,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1d,0x7d,0x10,0x00,0x01,0x1d,0x7f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x2f,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1d,0xa8,0x10,0x00,0x01,0x1d,0xaa,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x12,0x65,0x78,0x70,0x2d,0x69,0x66,0x2d,0x61,0x6c,0x74,0x65,0x72,0x6e,0x61,0x74,0x69,0x76,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1d,0xdc,0x10,0x00,0x01,0x1d,0xde,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1d,0xf7,0x10,0x00,0x01,0x1d,0xf9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x03,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1e,0x22,0x10,0x00,0x01,0x1e,0x24,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x74,0x68,0x72,0x6f,0x77,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1e,0x49,0x10,0x00,0x01,0x1e,0x4b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1e,0x64,0x10,0x00,0x01,0x1e,0x66,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x19,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1e,0x8f,0x10,0x00,0x01,0x1e,0x91,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x08,0x66,0x6f,0x72,0x2d,0x65,0x61,0x63,0x68,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1e,0xb9,0x10,0x00,0x01,0x1e,0xbb,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1e,0xd4,0x10,0x00,0x01,0x1e,0xd6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x4a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1e,0xff,0x10,0x00,0x01,0x1f,0x01,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0a,0x65,0x6e,0x76,0x2d,0x65,0x78,0x74,0x65,0x6e,0x64,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1f,0x2b,0x10,0x00,0x01,0x1f,0x2d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1f,0x46,0x10,0x00,0x01,0x1f,0x48,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x04,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1f,0x71,0x10,0x00,0x01,0x1f,0x73,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x65,0x72,0x72,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1f,0x98,0x10,0x00,0x01,0x1f,0x9a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1f,0xb3,0x10,0x00,0x01,0x1f,0xb5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x77,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x1f,0xde,0x10,0x00,0x01,0x1f,0xe0,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x09,0x74,0x6f,0x6b,0x65,0x6e,0x2d,0x72,0x6f,0x77,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x20,0x09,0x10,0x00,0x01,0x20,0x0b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x20,0x24,0x10,0x00,0x01,0x20,0x26,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x75,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x20,0x4f,0x10,0x00,0x01,0x20,0x51,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0f,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x73,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x20,0x80,0x10,0x00,0x01,0x20,0x82,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x20,0x9b,0x10,0x00,0x01,0x20,0x9d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x58,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x20,0xc6,0x10,0x00,0x01,0x20,0xc8,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x13,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,0x62,0x6f,0x64,0x79,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x20,0xfb,0x10,0x00,0x01,0x20,0xfd,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x21,0x16,0x10,0x00,0x01,0x21,0x18,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x2c,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x21,0x41,0x10,0x00,0x01,0x21,0x43,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0e,0x65,0x78,0x70,0x2d,0x62,0x65,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x64,0x79,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x21,0x71,0x10,0x00,0x01,0x21,0x73,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x21,0x8c,0x10,0x00,0x01,0x21,0x8e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x29,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x21,0xb7,0x10,0x00,0x01,0x21,0xb9,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x13,0x65,0x78,0x70,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x2d,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x21,0xec,0x10,0x00,0x01,0x21,0xee,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x22,0x07,0x10,0x00,0x01,0x22,0x09,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x0e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x22,0x32,0x10,0x00,0x01,0x22,0x34,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x63,0x61,0x61,0x61,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x22,0x59,0x10,0x00,0x01,0x22,0x5b,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x22,0x74,0x10,0x00,0x01,0x22,0x76,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x47,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x22,0x9f,0x10,0x00,0x01,0x22,0xa1,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x13,0x65,0x6e,0x76,0x2d,0x64,0x65,0x66,0x69,0x6e,0x69,0x74,0x69,0x6f,0x6e,0x2d,0x73,0x69,0x7a,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x22,0xd4,0x10,0x00,0x01,0x22,0xd6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x22,0xef,0x10,0x00,0x01,0x22,0xf1,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x64,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x23,0x1a,0x10,0x00,0x01,0x23,0x1c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x14,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x23,0x50,0x10,0x00,0x01,0x23,0x52,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x23,0x6b,0x10,0x00,0x01,0x23,0x6d,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x59,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x23,0x96,0x10,0x00,0x01,0x23,0x98,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0c,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x73,0x65,0x74,0x21,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x23,0xc4,0x10,0x00,0x01,0x23,0xc6,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x23,0xdf,0x10,0x00,0x01,0x23,0xe1,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x60,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x24,0x0a,0x10,0x00,0x01,0x24,0x0c,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x1c,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x24,0x48,0x10,0x00,0x01,0x24,0x4a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x24,0x63,0x10,0x00,0x01,0x24,0x65,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x53,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x24,0x8e,0x10,0x00,0x01,0x24,0x90,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x0e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x76,0x65,0x63,0x74,0x6f,0x72,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x24,0xbe,0x10,0x00,0x01,0x24,0xc0,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x24,0xd9,0x10,0x00,0x01,0x24,0xdb,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x78,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x25,0x04,0x10,0x00,0x01,0x25,0x06,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x09,0x74,0x6f,0x6b,0x65,0x6e,0x2d,0x63,0x6f,0x6c,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x25,0x2f,0x10,0x00,0x01,0x25,0x31,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x25,0x4a,0x10,0x00,0x01,0x25,0x4c,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x67,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x25,0x75,0x10,0x00,0x01,0x25,0x77,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x15,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x65,0x6d,0x70,0x74,0x79,0x2d,0x73,0x65,0x71,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x25,0xac,0x10,0x00,0x01,0x25,0xae,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x25,0xc7,0x10,0x00,0x01,0x25,0xc9,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x6d,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x25,0xf2,0x10,0x00,0x01,0x25,0xf4,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x14,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x26,0x28,0x10,0x00,0x01,0x26,0x2a,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x26,0x43,0x10,0x00,0x01,0x26,0x45,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x25,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x26,0x6e,0x10,0x00,0x01,0x26,0x70,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x10,0x65,0x78,0x70,0x2d,0x73,0x65,0x74,0x2d,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x26,0xa0,0x10,0x00,0x01,0x26,0xa2,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x26,0xbb,0x10,0x00,0x01,0x26,0xbd,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x6e,0x12,0x00,0x01,0x26,0xd3,0x10,0x00,0x01,0x26,0xd5,0x06,0x05,0x04,0x03,0x00,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x26,0xf1,0x10,0x00,0x01,0x26,0xf3,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x27,0x0c,0x10,0x00,0x01,0x27,0x0e,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x01,0x27,0x2d,0x04,0x13,0x00,0x01,0x29,0xb0,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x0f,0x00,0x01,0x27,0x41,0x04,0x13,0x00,0x01,0x28,0x18,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x01,0x27,0x6c,0x10,0x00,0x01,0x27,0x6e,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x27,0x7a,0x08,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x01,0x27,0xa0,0x10,0x00,0x01,0x27,0xa2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x72,0x12,0x00,0x01,0x27,0xb8,0x10,0x00,0x01,0x27,0xba,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x01,0x27,0xe1,0x10,0x00,0x01,0x27,0xe3,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x12,0x00,0x01,0x27,0xfd,0x10,0x00,0x01,0x27,0xff,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x28,0x15,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x01,0x28,0x2d,0x04,0x13,0x00,0x01,0x29,0x04,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x03,0x12,0x00,0x01,0x28,0x58,0x10,0x00,0x01,0x28,0x5a,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x28,0x66,0x08,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x01,0x28,0x8c,0x10,0x00,0x01,0x28,0x8e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x74,0x12,0x00,0x01,0x28,0xa4,0x10,0x00,0x01,0x28,0xa6,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x01,0x28,0xcd,0x10,0x00,0x01,0x28,0xcf,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x01,0x28,0xe9,0x10,0x00,0x01,0x28,0xeb,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x29,0x01,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x83,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x01,0x29,0x34,0x10,0x00,0x01,0x29,0x36,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x12,0x00,0x01,0x29,0x50,0x10,0x00,0x01,0x29,0x52,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x83,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x0f,0x12,0x00,0x01,0x29,0x79,0x10,0x00,0x01,0x29,0x7b,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x01,0x29,0x95,0x10,0x00,0x01,0x29,0x97,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x29,0xad,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0f,0x00,0x01,0x29,0xcd,0x04,0x13,0x00,0x01,0x34,0x0f,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x01,0x01,0x01,0x02,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x84,0x12,0x00,0x01,0x29,0xf1,0x10,0x00,0x01,0x29,0xf3,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x0f,0x00,0x01,0x2a,0x0c,0x04,0x13,0x00,0x01,0x2a,0x90,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x02,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x24,0x20,0x72,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x20,0x53,0x68,0x6f,0x65,0x20,0x69,0x6e,0x63,0x72,0x65,0x6d,0x65,0x6e,0x74,0x61,0x6c,0x20,0x66,0x72,0x6f,0x6e,0x74,0x65,0x6e,0x64,0x2e,0x0a,0x03,0x00,0x04,0x01,0x00,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x95,0x12,0x00,0x01,0x2a,0x5d,0x10,0x00,0x01,0x2a,0x5f,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x26,0x12,0x00,0x01,0x2a,0x78,0x10,0x00,0x01,0x2a,0x7a,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2a,0x8d,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0f,0x00,0x01,0x2a,0xa5,0x04,0x13,0x00,0x01,0x31,0x8c,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x02,0x3e,0x20,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2a,0xce,0x10,0x00,0x01,0x2a,0xd0,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x01,0x2a,0xdf,0x04,0x13,0x00,0x01,0x31,0x66,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x02,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x91,0x12,0x00,0x01,0x2a,0xff,0x10,0x00,0x01,0x2b,0x01,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x26,0x12,0x00,0x01,0x2b,0x3f,0x10,0x00,0x01,0x2b,0x41,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x2e,0x12,0x00,0x01,0x2b,0x73,0x10,0x00,0x01,0x2b,0x75,0x06,0x05,0x04,0x03,0x00,0x04,0x0b,0x04,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x12,0x00,0x01,0x2b,0x99,0x10,0x00,0x01,0x2b,0x9b,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x2b,0xa7,0x0a,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x02,0x2e,0x0a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x2b,0xd5,0x10,0x00,0x01,0x2b,0xd7,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x2c,0x1d,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x16,0x49,0x6e,0x70,0x75,0x74,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x6c,0x75,0x73,0x68,0x65,0x64,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2c,0x14,0x10,0x00,0x01,0x2c,0x16,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x08,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x04,0x6e,0x65,0x77,0x0a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x2c,0x4d,0x10,0x00,0x01,0x2c,0x4f,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x2c,0xbf,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x15,0x45,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x20,0x66,0x6c,0x75,0x73,0x68,0x65,0x64,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2c,0x8b,0x10,0x00,0x01,0x2c,0x8d,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x84,0x12,0x00,0x01,0x2c,0xac,0x10,0x00,0x01,0x2c,0xae,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x02,0x01,0x08,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x05,0x68,0x65,0x6c,0x70,0x0a,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x2c,0xf0,0x10,0x00,0x01,0x2c,0xf2,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x2f,0x30,0x01,0x01,0x01,0x02,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x12,0x00,0x01,0x2d,0x16,0x10,0x00,0x01,0x2d,0x18,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x47,0x54,0x68,0x69,0x73,0x20,0x69,0x73,0x20,0x61,0x6e,0x20,0x69,0x6e,0x74,0x65,0x72,0x61,0x63,0x74,0x69,0x76,0x65,0x20,0x74,0x6f,0x6f,0x6c,0x20,0x69,0x6e,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x79,0x6f,0x75,0x20,0x63,0x61,0x6e,0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x61,0x6e,0x79,0x20,0x53,0x68,0x6f,0x65,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2d,0x81,0x10,0x00,0x01,0x2d,0x83,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x3d,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x6f,0x72,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x2e,0x20,0x20,0x54,0x68,0x65,0x72,0x65,0x20,0x61,0x72,0x65,0x20,0x61,0x6c,0x73,0x6f,0x20,0x73,0x6f,0x6d,0x65,0x20,0x65,0x78,0x74,0x72,0x61,0x20,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x3a,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2d,0xe2,0x10,0x00,0x01,0x2d,0xe4,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x01,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2e,0x07,0x10,0x00,0x01,0x2e,0x09,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x1e,0x20,0x20,0x68,0x65,0x6c,0x70,0x20,0x20,0x20,0x20,0x20,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x74,0x68,0x69,0x73,0x20,0x74,0x65,0x78,0x74,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2e,0x49,0x10,0x00,0x01,0x2e,0x4b,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x2e,0x20,0x20,0x6e,0x65,0x77,0x20,0x20,0x20,0x20,0x20,0x20,0x43,0x6c,0x65,0x61,0x72,0x20,0x61,0x6c,0x6c,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2e,0x9b,0x10,0x00,0x01,0x2e,0x9d,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x26,0x20,0x20,0x2e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x41,0x62,0x6f,0x72,0x74,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x69,0x6e,0x70,0x75,0x74,0x20,0x62,0x61,0x74,0x63,0x68,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2e,0xe5,0x10,0x00,0x01,0x2e,0xe7,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x1e,0x20,0x20,0x5e,0x44,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x78,0x69,0x74,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x2f,0x27,0x10,0x00,0x01,0x2f,0x29,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x08,0x04,0x14,0x01,0x01,0x01,0x02,0x0f,0x00,0x01,0x2f,0x3f,0x04,0x13,0x00,0x01,0x30,0x84,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x7a,0x12,0x00,0x01,0x2f,0x6e,0x10,0x00,0x01,0x2f,0x70,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x01,0x2f,0x82,0x03,0x13,0x00,0x01,0x30,0x7b,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x0f,0x00,0x01,0x2f,0x96,0x04,0x13,0x00,0x01,0x30,0x25,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x30,0x22,0x01,0x01,0x01,0x02,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x7b,0x12,0x00,0x01,0x2f,0xe0,0x10,0x00,0x01,0x2f,0xe2,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x12,0x00,0x01,0x2f,0xfc,0x10,0x00,0x01,0x2f,0xfe,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x30,0x1f,0x06,0x05,0x04,0x14,0x08,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0b,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x7b,0x12,0x00,0x01,0x30,0x5f,0x10,0x00,0x01,0x30,0x61,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x12,0x00,0x01,0x30,0x78,0x06,0x05,0x04,0x14,0x12,0x00,0x01,0x30,0x81,0x06,0x05,0x04,0x14,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x12,0x00,0x01,0x30,0x9c,0x10,0x00,0x01,0x30,0x9e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x01,0x30,0xb0,0x03,0x13,0x00,0x01,0x31,0x5d,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x17,0x55,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x2e,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x12,0x00,0x01,0x31,0x00,0x10,0x00,0x01,0x31,0x02,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x31,0x52,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x03,0x3e,0x3e,0x20,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x31,0x2c,0x10,0x00,0x01,0x31,0x2e,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x12,0x00,0x01,0x31,0x4f,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x12,0x00,0x01,0x31,0x63,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x04,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x01,0x31,0x89,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x01,0x01,0x02,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x12,0x00,0x01,0x31,0xb1,0x10,0x00,0x01,0x31,0xb3,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x01,0x31,0xc2,0x04,0x13,0x00,0x01,0x33,0xf0,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x12,0x00,0x01,0x31,0xe6,0x10,0x00,0x01,0x31,0xe8,0x06,0x05,0x04,0x02,0x02,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x33,0xc7,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x12,0x00,0x01,0x32,0x2d,0x10,0x00,0x01,0x32,0x2f,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x01,0x32,0x5f,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x06,0x12,0x00,0x01,0x32,0x58,0x10,0x00,0x01,0x33,0xae,0x06,0x05,0x04,0x13,0x00,0x01,0x33,0xae,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0f,0x00,0x01,0x32,0x77,0x04,0x13,0x00,0x01,0x33,0x93,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x0f,0x00,0x01,0x32,0x8f,0x04,0x13,0x00,0x01,0x32,0xc6,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x80,0x12,0x00,0x01,0x32,0xc3,0x06,0x05,0x04,0x14,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x12,0x00,0x01,0x32,0xde,0x10,0x00,0x01,0x32,0xe0,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x01,0x32,0xf2,0x03,0x13,0x00,0x01,0x33,0x8a,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x12,0x00,0x01,0x33,0x23,0x10,0x00,0x01,0x33,0x25,0x06,0x05,0x04,0x02,0x02,0x15,0x00,0x01,0x33,0x55,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x06,0x12,0x00,0x01,0x33,0x4e,0x10,0x00,0x01,0x33,0x75,0x06,0x05,0x04,0x13,0x00,0x01,0x33,0x75,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x33,0x73,0x10,0x00,0x01,0x33,0x75,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x55,0x12,0x00,0x01,0x33,0x87,0x06,0x05,0x04,0x14,0x12,0x00,0x01,0x33,0x90,0x06,0x05,0x04,0x14,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x19,0x12,0x00,0x01,0x33,0xac,0x10,0x00,0x01,0x33,0xae,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x12,0x00,0x01,0x33,0xc4,0x06,0x05,0x04,0x14,0x0c,0x04,0x00,0x00,0x00,0x11,0x54,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,0x20,0x63,0x6c,0x6f,0x73,0x65,0x64,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x33,0xed,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x12,0x00,0x01,0x34,0x0c,0x06,0x05,0x04,0x14,0x19,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x02,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x0a,0x04,0x03,0x00,0x04,0x0a,0x04,0x04,0x00,0x04,0x00,0x0a,0x04,0x04,0x00,0x04,0x00,0x09,0x04,0x04,0x00,0x04,0x00,0x09,0x04,0x04,0x00,0x04,0x00,0x0a,0x04,0x04,0x00,0x04,0x00,0x0f,0x00,0x01,0x34,0x4f,0x03,0x13,0x00,0x01,0x3e,0x47,0x16,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x00,0x12,0x00,0x01,0x34,0x75,0x10,0x00,0x01,0x34,0x77,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x3d,0x12,0x00,0x01,0x34,0x8d,0x10,0x00,0x01,0x34,0x8f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x10,0x12,0x00,0x01,0x34,0xa5,0x10,0x00,0x01,0x34,0xa7,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x01,0x34,0xb7,0x04,0x13,0x00,0x01,0x39,0x67,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x08,0x12,0x00,0x01,0x34,0xe6,0x10,0x00,0x01,0x34,0xe8,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x35,0x06,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x08,0x12,0x00,0x01,0x35,0x2c,0x10,0x00,0x01,0x35,0x2e,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x35,0x4c,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x02,0x2d,0x64,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x35,0x7c,0x10,0x00,0x01,0x35,0x7e,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x01,0x35,0x8e,0x03,0x13,0x00,0x01,0x36,0x26,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x35,0xb1,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x06,0x2d,0x2d,0x64,0x75,0x6d,0x70,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x35,0xe3,0x10,0x00,0x01,0x35,0xe5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x01,0x35,0xf7,0x03,0x13,0x00,0x01,0x36,0x1d,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x36,0x1a,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x01,0x36,0x23,0x06,0x05,0x04,0x14,0x12,0x00,0x01,0x36,0x31,0x10,0x00,0x01,0x36,0x33,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x36,0x55,0x0a,0x04,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x09,0x04,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x02,0x2d,0x65,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x36,0x85,0x10,0x00,0x01,0x36,0x87,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x01,0x36,0x97,0x03,0x13,0x00,0x01,0x37,0x32,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x36,0xba,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x09,0x2d,0x2d,0x65,0x78,0x65,0x63,0x75,0x74,0x65,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x36,0xef,0x10,0x00,0x01,0x36,0xf1,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x01,0x37,0x03,0x03,0x13,0x00,0x01,0x37,0x29,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x37,0x26,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x01,0x37,0x2f,0x06,0x05,0x04,0x14,0x12,0x00,0x01,0x37,0x3d,0x10,0x00,0x01,0x37,0x3f,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x37,0x55,0x0a,0x04,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x02,0x2d,0x68,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x37,0x85,0x10,0x00,0x01,0x37,0x87,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x01,0x37,0x97,0x03,0x13,0x00,0x01,0x38,0x2f,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x37,0xba,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x06,0x2d,0x2d,0x68,0x65,0x6c,0x70,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x37,0xec,0x10,0x00,0x01,0x37,0xee,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x01,0x38,0x00,0x03,0x13,0x00,0x01,0x38,0x26,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x38,0x23,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x01,0x38,0x2c,0x06,0x05,0x04,0x14,0x12,0x00,0x01,0x38,0x3a,0x10,0x00,0x01,0x38,0x3c,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x38,0x52,0x09,0x04,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x02,0x2d,0x76,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x38,0x82,0x10,0x00,0x01,0x38,0x84,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x0f,0x00,0x01,0x38,0x94,0x03,0x13,0x00,0x01,0x39,0x2f,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x38,0xb7,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x0c,0x04,0x00,0x00,0x00,0x09,0x2d,0x2d,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x04,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,0x00,0x0d,0x12,0x00,0x01,0x38,0xec,0x10,0x00,0x01,0x38,0xee,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0f,0x00,0x01,0x39,0x00,0x03,0x13,0x00,0x01,0x39,0x26,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x39,0x23,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x0a,0x04,0x14,0x12,0x00,0x01,0x39,0x2c,0x06,0x05,0x04,0x14,0x12,0x00,0x01,0x39,0x3a,0x10,0x00,0x01,0x39,0x3c,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x39,0x52,0x09,0x04,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x14,0x04,0x00,0x04,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x19,0x12,0x00,0x01,0x39,0x80,0x10,0x00,0x01,0x39,0x82,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x15,0x00,0x01,0x3a,0x12,0x01,0x01,0x01,0x02,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x26,0x2e,0x20,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x31,0x39,0x39,0x39,0x20,0x46,0x72,0x65,0x64,0x72,0x69,0x6b,0x20,0x4e,0x6f,0x72,0x69,0x6e,0x67,0x2e,0x0a,0x03,0x00,0x04,0x01,0x00,0x08,0x00,0x0e,0x03,0x00,0x00,0x00,0x95,0x12,0x00,0x01,0x39,0xdf,0x10,0x00,0x01,0x39,0xe1,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x26,0x12,0x00,0x01,0x39,0xfa,0x10,0x00,0x01,0x39,0xfc,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x02,0x01,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x3a,0x0f,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x15,0x00,0x01,0x3c,0x5b,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x20,0x55,0x73,0x61,0x67,0x65,0x3a,0x20,0x73,0x68,0x6f,0x65,0x20,0x5b,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x5d,0x20,0x5b,0x73,0x63,0x72,0x69,0x70,0x74,0x5d,0x0a,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x3a,0x5f,0x10,0x00,0x01,0x3a,0x61,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x09,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x3a,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x3a,0x8c,0x10,0x00,0x01,0x3a,0x8e,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x37,0x20,0x20,0x2d,0x64,0x2c,0x20,0x2d,0x2d,0x64,0x75,0x6d,0x70,0x20,0x3c,0x66,0x69,0x6c,0x65,0x3e,0x20,0x20,0x20,0x20,0x20,0x44,0x75,0x6d,0x70,0x73,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x20,0x61,0x73,0x20,0x61,0x20,0x43,0x20,0x66,0x69,0x6c,0x65,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x3a,0xe7,0x10,0x00,0x01,0x3a,0xe9,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x45,0x20,0x20,0x2d,0x65,0x2c,0x20,0x2d,0x2d,0x65,0x78,0x65,0x63,0x75,0x74,0x65,0x20,0x3c,0x63,0x6d,0x64,0x3e,0x20,0x20,0x20,0x52,0x75,0x6e,0x20,0x74,0x68,0x65,0x20,0x67,0x69,0x76,0x65,0x6e,0x20,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x20,0x69,0x6e,0x73,0x74,0x65,0x61,0x64,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x73,0x63,0x72,0x69,0x70,0x74,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x3b,0x50,0x10,0x00,0x01,0x3b,0x52,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x34,0x20,0x20,0x2d,0x68,0x2c,0x20,0x2d,0x2d,0x68,0x65,0x6c,0x70,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x74,0x68,0x69,0x73,0x20,0x68,0x65,0x6c,0x70,0x20,0x61,0x6e,0x64,0x20,0x65,0x78,0x69,0x74,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x3b,0xa8,0x10,0x00,0x01,0x3b,0xaa,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x0c,0x04,0x00,0x00,0x00,0x32,0x20,0x20,0x2d,0x76,0x2c,0x20,0x2d,0x2d,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x65,0x78,0x69,0x74,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x3b,0xfe,0x10,0x00,0x01,0x3c,0x00,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x0c,0x04,0x00,0x00,0x00,0x3f,0x0a,0x57,0x68,0x65,0x6e,0x20,0x6e,0x6f,0x20,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x69,0x73,0x20,0x67,0x69,0x76,0x65,0x6e,0x2c,0x20,0x53,0x68,0x6f,0x65,0x20,0x77,0x69,0x6c,0x6c,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x69,0x6e,0x20,0x69,0x6e,0x74,0x65,0x72,0x61,0x63,0x74,0x69,0x76,0x65,0x20,0x6d,0x6f,0x64,0x65,0x2e,0x0a,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x54,0x12,0x00,0x01,0x3c,0x58,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x0e,0x03,0x00,0x00,0x00,0x01,0x12,0x00,0x01,0x3c,0x7f,0x10,0x00,0x01,0x3c,0x81,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x12,0x00,0x01,0x3c,0x9b,0x10,0x00,0x01,0x3c,0x9d,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x3d,0x5a,0x01,0x01,0x01,0x02,0x01,0x02,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x84,0x12,0x00,0x01,0x3c,0xc3,0x10,0x00,0x01,0x3c,0xc5,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x01,0x00,0x01,0x02,0x01,0x02,0x08,0x04,0x03,0x00,0x04,0x01,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7d,0x12,0x00,0x01,0x3c,0xf9,0x10,0x00,0x01,0x3c,0xfb,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x63,0x12,0x00,0x01,0x3d,0x14,0x10,0x00,0x01,0x3d,0x16,0x06,0x05,0x04,0x03,0x00,0x04,0x0d,0x04,0x00,0x00,0x00,0x05,0x62,0x65,0x67,0x69,0x6e,0x04,0x00,0x04,0x00,0x02,0x02,0x0e,0x03,0x00,0x00,0x00,0x0e,0x12,0x00,0x01,0x3d,0x3b,0x10,0x00,0x01,0x3d,0x3d,0x06,0x05,0x04,0x02,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x12,0x00,0x01,0x3d,0x57,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x12,0x00,0x01,0x3d,0x80,0x10,0x00,0x01,0x3d,0x82,0x06,0x05,0x04,0x02,0x02,0x02,0x01,0x15,0x00,0x01,0x3d,0xa0,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x85,0x12,0x00,0x01,0x3d,0x9d,0x06,0x05,0x04,0x14,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x15,0x00,0x01,0x3e,0x02,0x01,0x01,0x01,0x02,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x82,0x12,0x00,0x01,0x3d,0xca,0x10,0x00,0x01,0x3d,0xcc,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x04,0x00,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7f,0x12,0x00,0x01,0x3d,0xff,0x06,0x05,0x04,0x14,0x01,0x01,0x01,0x02,0x08,0x00,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x84,0x12,0x00,0x01,0x3e,0x1d,0x10,0x00,0x01,0x3e,0x1f,0x06,0x05,0x04,0x03,0x00,0x04,0x02,0x02,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x18,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x81,0x12,0x00,0x01,0x3e,0x44,0x06,0x05,0x04,0x14,0x12,0x00,0x01,0x3e,0x52,0x10,0x00,0x01,0x3e,0x54,0x06,0x05,0x04,0x02,0x01,0x02,0x02,0x14 };
+{ 0x53,0x68,0x6f,0x65,0x08,0x00,0x00,0x00,0x68,0x74,0x01,0x00,0x1e,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0xc5,0x00,0x00,0x00,0x20,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x5c,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2c,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x94,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xb0,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0xec,0x01,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x0f,0x03,0x00,0x00,0xd4,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x4c,0x01,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x2c,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x20,0x01,0x00,0x00,0x79,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x24,0x01,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x08,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x44,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x68,0x01,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x01,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x01,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x88,0x01,0x00,0x00,0x13,0x00,0x00,0x00,0xd8,0x01,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xc8,0x01,0x00,0x00,0x79,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe4,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf8,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x20,0x02,0x00,0x00,0x13,0x00,0x00,0x00,0x38,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2c,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x54,0x02,0x00,0x00,0x78,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0x02,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x74,0x02,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xf4,0x02,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x2c,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xc0,0x02,0x00,0x00,0x79,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc4,0x02,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x03,0x04,0x00,0x12,0x00,0x00,0x00,0xec,0x02,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x1c,0x03,0x00,0x00,0x60,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x58,0x03,0x00,0x00,0x13,0x00,0x00,0x00,0x9c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xc0,0x03,0x00,0x00,0x79,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc4,0x03,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xdc,0x03,0x00,0x00,0x13,0x00,0x00,0x00,0x20,0x04,0x00,0x00,0x16,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x40,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x20,0x06,0x00,0x00,0x16,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xdc,0x04,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xd4,0x04,0x00,0x00,0x20,0x01,0x02,0x00,0x3c,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x08,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x04,0x00,0x00,0x25,0x00,0x00,0x00,0xb0,0x04,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xcc,0x04,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x18,0x06,0x00,0x00,0x20,0x01,0x02,0x00,0x3c,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x08,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x05,0x00,0x00,0x25,0x00,0x00,0x00,0x28,0x05,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x10,0x06,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x74,0x05,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x05,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x78,0x05,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x0e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x05,0x00,0x00,0x25,0x00,0x00,0x00,0xa8,0x05,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x08,0x06,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe4,0x05,0x00,0x00,0x25,0x00,0x00,0x00,0xe8,0x05,0x00,0x00,0x05,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x40,0x06,0x00,0x00,0x13,0x00,0x00,0x00,0x4c,0x07,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x74,0x06,0x00,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x78,0x06,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x07,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xa0,0x06,0x00,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x06,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xc8,0x06,0x00,0x00,0x13,0x00,0x00,0x00,0x28,0x07,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xfc,0x06,0x00,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x20,0x07,0x00,0x00,0x54,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x17,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x44,0x07,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x6c,0x07,0x00,0x00,0x13,0x00,0x00,0x00,0xd8,0x07,0x00,0x00,0x16,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0e,0x04,0x00,0x00,0x54,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x17,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x07,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x07,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xd0,0x07,0x00,0x00,0x55,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x07,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xf8,0x07,0x00,0x00,0x13,0x00,0x00,0x00,0x18,0x08,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x38,0x08,0x00,0x00,0x13,0x00,0x00,0x00,0x58,0x08,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x78,0x08,0x00,0x00,0x13,0x00,0x00,0x00,0x98,0x08,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x0a,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xb8,0x08,0x00,0x00,0x13,0x00,0x00,0x00,0xd8,0x08,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x0b,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xf8,0x08,0x00,0x00,0x13,0x00,0x00,0x00,0x1c,0x09,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x0c,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x3c,0x09,0x00,0x00,0x13,0x00,0x00,0x00,0x60,0x09,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x0d,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x80,0x09,0x00,0x00,0x13,0x00,0x00,0x00,0xa4,0x09,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x0e,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xc4,0x09,0x00,0x00,0x13,0x00,0x00,0x00,0xe8,0x09,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x0f,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x08,0x0a,0x00,0x00,0x13,0x00,0x00,0x00,0x2c,0x0a,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x10,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x4c,0x0a,0x00,0x00,0x13,0x00,0x00,0x00,0x70,0x0a,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x11,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x90,0x0a,0x00,0x00,0x13,0x00,0x00,0x00,0xb4,0x0a,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x12,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xd4,0x0a,0x00,0x00,0x13,0x00,0x00,0x00,0xf8,0x0a,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x18,0x0b,0x00,0x00,0x13,0x00,0x00,0x00,0x40,0x0b,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x60,0x0b,0x00,0x00,0x13,0x00,0x00,0x00,0x88,0x0b,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x38,0x04,0x04,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xa8,0x0b,0x00,0x00,0x13,0x00,0x00,0x00,0x7c,0x0d,0x00,0x00,0x16,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xd4,0x0b,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x9a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0x0c,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x20,0x0c,0x00,0x00,0x74,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x24,0x0c,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x50,0x0c,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0x0c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x74,0x0c,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x78,0x0c,0x00,0x00,0x05,0x04,0x00,0x00,0x07,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x0c,0x00,0x00,0x25,0x00,0x00,0x00,0x98,0x0c,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xa8,0x0c,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xdc,0x0c,0x00,0x00,0x99,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x0c,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xfc,0x0c,0x00,0x00,0x74,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x24,0x0d,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x28,0x0d,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x48,0x0d,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x0d,0x00,0x00,0x05,0x04,0x00,0x00,0x07,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x26,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0x0d,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0x0d,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x16,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x9c,0x0d,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0x0f,0x00,0x00,0x16,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xc8,0x0d,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xf4,0x0d,0x00,0x00,0x99,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf8,0x0d,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x14,0x0e,0x00,0x00,0x74,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x0e,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x3c,0x0e,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0x0e,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x60,0x0e,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0x0e,0x00,0x00,0x05,0x04,0x00,0x00,0x07,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x26,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x0e,0x00,0x00,0x25,0x00,0x00,0x00,0x84,0x0e,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xb4,0x0e,0x00,0x00,0x9a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x0e,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xd4,0x0e,0x00,0x00,0x74,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd8,0x0e,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x04,0x0f,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x08,0x0f,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x28,0x0f,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0x0f,0x00,0x00,0x05,0x04,0x00,0x00,0x07,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x17,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x0f,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x17,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x70,0x0f,0x00,0x00,0x13,0x00,0x00,0x00,0x64,0x10,0x00,0x00,0x16,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x0f,0x03,0x00,0x00,0x94,0x0f,0x00,0x00,0x13,0x00,0x00,0x00,0x3c,0x10,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xcc,0x0f,0x00,0x00,0x74,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0x0f,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xf4,0x0f,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf8,0x0f,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x18,0x10,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0x10,0x00,0x00,0x05,0x04,0x00,0x00,0x07,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x26,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x34,0x10,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x58,0x10,0x00,0x00,0x12,0x00,0x00,0x00,0x54,0x10,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0x10,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x18,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x84,0x10,0x00,0x00,0x13,0x00,0x00,0x00,0xd4,0x10,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0x10,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0x10,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x27,0x03,0x00,0x00,0x41,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xcc,0x10,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x19,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xf4,0x10,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0x11,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x1a,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x2c,0x11,0x00,0x00,0x13,0x00,0x00,0x00,0xa4,0x11,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x4c,0x11,0x00,0x00,0x13,0x00,0x00,0x00,0x88,0x11,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x11,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x9c,0x11,0x00,0x00,0xa5,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x1b,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xc4,0x11,0x00,0x00,0x13,0x00,0x00,0x00,0x80,0x12,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xf8,0x11,0x00,0x00,0xa7,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xfc,0x11,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x18,0x12,0x00,0x00,0x13,0x00,0x00,0x00,0x6c,0x12,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x40,0x12,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x1c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x12,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x78,0x12,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x1c,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xa0,0x12,0x00,0x00,0x13,0x00,0x00,0x00,0xf4,0x12,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xcc,0x12,0x00,0x00,0xa6,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0x12,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x1a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0x12,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x1d,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x14,0x13,0x00,0x00,0x13,0x00,0x00,0x00,0x70,0x13,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x48,0x13,0x00,0x00,0xa8,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x13,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x1a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0x13,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x1e,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x90,0x13,0x00,0x00,0x13,0x00,0x00,0x00,0x08,0x14,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xb0,0x13,0x00,0x00,0x13,0x00,0x00,0x00,0xec,0x13,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe4,0x13,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0xaa,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x1f,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x28,0x14,0x00,0x00,0x13,0x00,0x00,0x00,0x5c,0x14,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x54,0x14,0x00,0x00,0xab,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x7c,0x14,0x00,0x00,0x13,0x00,0x00,0x00,0x30,0x15,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xbc,0x14,0x00,0x00,0xae,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0x14,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xd4,0x14,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x1a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0x14,0x00,0x00,0x25,0x00,0x00,0x00,0xf8,0x14,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x21,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x28,0x15,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x50,0x15,0x00,0x00,0x13,0x00,0x00,0x00,0x34,0x16,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x84,0x15,0x00,0x00,0xaf,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0x15,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xa4,0x15,0x00,0x00,0x13,0x00,0x00,0x00,0x20,0x16,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xcc,0x15,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x1a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0x15,0x00,0x00,0x25,0x00,0x00,0x00,0xf0,0x15,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x22,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x16,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0x16,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x22,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x54,0x16,0x00,0x00,0x13,0x00,0x00,0x00,0x88,0x16,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x80,0x16,0x00,0x00,0xb0,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x23,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xa8,0x16,0x00,0x00,0x13,0x00,0x00,0x00,0x3c,0x17,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x0f,0x04,0x00,0x00,0xd4,0x16,0x00,0x00,0x13,0x00,0x00,0x00,0x10,0x17,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0x17,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x28,0x17,0x00,0x00,0xb1,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0x17,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x24,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x5c,0x17,0x00,0x00,0x13,0x00,0x00,0x00,0x1c,0x19,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x10,0x19,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xa0,0x17,0x00,0x00,0xb2,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x17,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xc0,0x17,0x00,0x00,0x13,0x00,0x00,0x00,0xfc,0x18,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xa8,0x18,0x00,0x00,0x20,0x01,0x02,0x00,0x0a,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x08,0x18,0x00,0x00,0x13,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x0c,0x18,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x38,0x18,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x13,0x00,0x00,0x00,0x68,0x18,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x18,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x18,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x90,0x18,0x00,0x00,0x14,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x94,0x18,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x1a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc8,0x18,0x00,0x00,0x25,0x00,0x00,0x00,0xcc,0x18,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x25,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0x18,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0x19,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x25,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x3c,0x19,0x00,0x00,0x13,0x00,0x00,0x00,0xf4,0x19,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x88,0x19,0x00,0x00,0x3a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x8c,0x19,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xa8,0x19,0x00,0x00,0x38,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0x19,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0x27,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0x19,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x26,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x14,0x1a,0x00,0x00,0x13,0x00,0x00,0x00,0x68,0x1b,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x54,0x1a,0x00,0x00,0x3a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x48,0x1a,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x58,0x1a,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x35,0x04,0x04,0x03,0x02,0x01,0x00,0x00,0x15,0x00,0x00,0x00,0x60,0x1b,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xa4,0x1a,0x00,0x00,0x3b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa8,0x1a,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0xc8,0x1a,0x00,0x00,0x25,0x00,0x00,0x00,0xcc,0x1a,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x1b,0x00,0x00,0x3c,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0x1b,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x29,0x04,0x00,0x00,0x32,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x27,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0x1b,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x27,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x88,0x1b,0x00,0x00,0x13,0x00,0x00,0x00,0x2c,0x1c,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xc4,0x1b,0x00,0x00,0x13,0x00,0x00,0x00,0xfc,0x1b,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0x1b,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1c,0x1c,0x00,0x00,0x25,0x00,0x00,0x00,0x20,0x1c,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x28,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x4c,0x1c,0x00,0x00,0x13,0x00,0x00,0x00,0xac,0x1c,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x2a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x1c,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x29,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xcc,0x1c,0x00,0x00,0x13,0x00,0x00,0x00,0xfc,0x1d,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x0c,0x1d,0x00,0x00,0x3a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x1d,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x10,0x1d,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x35,0x04,0x04,0x03,0x02,0x01,0x00,0x00,0x15,0x00,0x00,0x00,0xf4,0x1d,0x00,0x00,0x01,0x01,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x29,0x04,0x00,0x00,0x32,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x84,0x1d,0x00,0x00,0x3b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0x1d,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x1d,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x1d,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0x2a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0x1d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x2a,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x1c,0x1e,0x00,0x00,0x13,0x00,0x00,0x00,0x6c,0x1f,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x26,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x2f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x70,0x1e,0x00,0x00,0x25,0x00,0x00,0x00,0x74,0x1e,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x90,0x1e,0x00,0x00,0x13,0x00,0x00,0x00,0x58,0x1f,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xc0,0x1e,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xe8,0x1e,0x00,0x00,0x74,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0x1e,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x10,0x1f,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0x1f,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x34,0x1f,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x38,0x1f,0x00,0x00,0x05,0x04,0x00,0x00,0x07,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0x50,0x1f,0x00,0x00,0xb5,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x1f,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x2b,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x8c,0x1f,0x00,0x00,0x13,0x00,0x00,0x00,0xf0,0x1f,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x28,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x2f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0x1f,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0x1f,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x2c,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x10,0x20,0x00,0x00,0x13,0x00,0x00,0x00,0x20,0x21,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x50,0x20,0x00,0x00,0x3a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0x20,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x70,0x20,0x00,0x00,0x27,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x2e,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x2f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb8,0x20,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0x20,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xd8,0x20,0x00,0x00,0x12,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0x20,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x21,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x2d,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x40,0x21,0x00,0x00,0x13,0x00,0x00,0x00,0xe0,0x21,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xa0,0x21,0x00,0x00,0x3b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x21,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0x2a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0x21,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x2e,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x00,0x22,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0x24,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x32,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0x22,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x22,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x58,0x22,0x00,0x00,0x13,0x00,0x00,0x00,0x3c,0x24,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x8c,0x22,0x00,0x00,0x13,0x00,0x00,0x00,0xec,0x22,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x30,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe4,0x22,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0x23,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0x23,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x2c,0x23,0x00,0x00,0x13,0x00,0x00,0x00,0x28,0x24,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0x23,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0x23,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xa4,0x23,0x00,0x00,0x13,0x00,0x00,0x00,0x14,0x24,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x31,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0x23,0x00,0x00,0x25,0x00,0x00,0x00,0xf0,0x23,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0x24,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x34,0x24,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x24,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x2f,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x70,0x24,0x00,0x00,0x13,0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x90,0x24,0x00,0x00,0x13,0x00,0x00,0x00,0xdc,0x24,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd4,0x24,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x24,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf8,0x24,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x30,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x20,0x25,0x00,0x00,0x13,0x00,0x00,0x00,0x04,0x26,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x25,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0x25,0x00,0x00,0x25,0x00,0x00,0x00,0x5c,0x25,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x78,0x25,0x00,0x00,0x13,0x00,0x00,0x00,0xf0,0x25,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0x25,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0x25,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xe8,0x25,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0x25,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0x25,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x31,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x24,0x26,0x00,0x00,0x13,0x00,0x00,0x00,0x08,0x27,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x5c,0x26,0x00,0x00,0xb3,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x60,0x26,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x98,0x26,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x90,0x26,0x00,0x00,0x11,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xc0,0x26,0x00,0x00,0xb3,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc4,0x26,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x32,0x03,0x04,0x03,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x34,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0xb4,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x32,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x01,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0x35,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x3c,0x27,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0x27,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x33,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x64,0x27,0x00,0x00,0x13,0x00,0x00,0x00,0x88,0x27,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x33,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x34,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xa8,0x27,0x00,0x00,0x13,0x00,0x00,0x00,0xdc,0x29,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x08,0x04,0x00,0x00,0x04,0x00,0x04,0x00,0x0a,0x04,0x00,0x00,0x04,0x00,0x04,0x00,0x0a,0x04,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xf4,0x27,0x00,0x00,0x39,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf8,0x27,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x14,0x28,0x00,0x00,0x13,0x00,0x00,0x00,0xc8,0x29,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x0f,0x04,0x00,0x00,0x38,0x28,0x00,0x00,0x13,0x00,0x00,0x00,0x08,0x29,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x0f,0x04,0x00,0x00,0x5c,0x28,0x00,0x00,0x13,0x00,0x00,0x00,0x90,0x28,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x01,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x18,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x88,0x28,0x00,0x00,0x02,0x01,0x00,0x00,0x14,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x28,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x28,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x0a,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xf4,0x28,0x00,0x00,0x3c,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf8,0x28,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x04,0x00,0x00,0x33,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x38,0x29,0x00,0x00,0x3c,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x29,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x4c,0x29,0x00,0x00,0x14,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x8c,0x29,0x00,0x00,0x3b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x90,0x29,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xbc,0x29,0x00,0x00,0x01,0x01,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0xb0,0x29,0x00,0x00,0x21,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x14,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x33,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd4,0x29,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x35,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xfc,0x29,0x00,0x00,0x13,0x00,0x00,0x00,0x18,0x2b,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x28,0x2a,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0x2a,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x48,0x2a,0x00,0x00,0x13,0x00,0x00,0x00,0x04,0x2b,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x34,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x2a,0x00,0x00,0x25,0x00,0x00,0x00,0x84,0x2a,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x98,0x2a,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc0,0x2a,0x00,0x00,0x25,0x00,0x00,0x00,0xc4,0x2a,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x36,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0x2a,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x2b,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x36,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x38,0x2b,0x00,0x00,0x13,0x00,0x00,0x00,0x38,0x2c,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x2b,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x2b,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x84,0x2b,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0x2c,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x34,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0x2b,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0x2b,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xd4,0x2b,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x37,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0x2c,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x10,0x2c,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0x2c,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x37,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x58,0x2c,0x00,0x00,0x13,0x00,0x00,0x00,0x58,0x2d,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x78,0x2c,0x00,0x00,0x13,0x00,0x00,0x00,0x34,0x2d,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xa8,0x2c,0x00,0x00,0x13,0x00,0x00,0x00,0x10,0x2d,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe4,0x2c,0x00,0x00,0x25,0x00,0x00,0x00,0xe8,0x2c,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0x2d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x36,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0x2d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x35,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x50,0x2d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x38,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x39,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x3b,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x08,0x04,0x00,0x00,0x2d,0x04,0x00,0x00,0x3b,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x3c,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x01,0x02,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xe0,0x2d,0x00,0x00,0x3f,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0x2d,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x3d,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x08,0x04,0x00,0x00,0x2d,0x04,0x00,0x00,0x3e,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x3f,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x34,0x2e,0x00,0x00,0x13,0x00,0x00,0x00,0x84,0x2e,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x7c,0x2e,0x00,0x00,0x27,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x74,0x2e,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x40,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xa4,0x2e,0x00,0x00,0x13,0x00,0x00,0x00,0xa0,0x2f,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xcc,0x2e,0x00,0x00,0x27,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xfc,0x2e,0x00,0x00,0x67,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x2f,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x44,0x2f,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x41,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x3c,0x2f,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x41,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x88,0x2f,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0x2f,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x8c,0x2f,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x41,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xc0,0x2f,0x00,0x00,0x13,0x00,0x00,0x00,0xbc,0x30,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xe8,0x2f,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x18,0x30,0x00,0x00,0x67,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0x30,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x60,0x30,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x42,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0x30,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x42,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x30,0x00,0x00,0x25,0x00,0x00,0x00,0x98,0x30,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xa8,0x30,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x42,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xdc,0x30,0x00,0x00,0x13,0x00,0x00,0x00,0xe4,0x32,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x10,0x31,0x00,0x00,0x01,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0x31,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x30,0x31,0x00,0x00,0x13,0x00,0x00,0x00,0xd0,0x32,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x54,0x31,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x78,0x31,0x00,0x00,0x02,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0x31,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x98,0x31,0x00,0x00,0x13,0x00,0x00,0x00,0xbc,0x32,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xbc,0x31,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xe0,0x31,0x00,0x00,0x04,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0x31,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x00,0x32,0x00,0x00,0x13,0x00,0x00,0x00,0xa8,0x32,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x24,0x32,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x48,0x32,0x00,0x00,0x08,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x32,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x68,0x32,0x00,0x00,0x13,0x00,0x00,0x00,0x94,0x32,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x8c,0x32,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa0,0x32,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x32,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc8,0x32,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x32,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x43,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x6f,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x44,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x0a,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x45,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x46,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x47,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x64,0x33,0x00,0x00,0x13,0x00,0x00,0x00,0x20,0x34,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa0,0x33,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x33,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xc0,0x33,0x00,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc4,0x33,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xf8,0x33,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x33,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x0d,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x34,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x48,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x40,0x34,0x00,0x00,0x13,0x00,0x00,0x00,0x68,0x35,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x7c,0x34,0x00,0x00,0x25,0x00,0x00,0x00,0x80,0x34,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x9c,0x34,0x00,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa0,0x34,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xd4,0x34,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xcc,0x34,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x0b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x35,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0x35,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x11,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0x35,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x35,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x4a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0x35,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x49,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x88,0x35,0x00,0x00,0x13,0x00,0x00,0x00,0xb8,0x35,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x27,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x42,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x4a,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xd8,0x35,0x00,0x00,0x13,0x00,0x00,0x00,0x20,0x36,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x44,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x40,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x36,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x4b,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x40,0x36,0x00,0x00,0x13,0x00,0x00,0x00,0xfc,0x36,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x7c,0x36,0x00,0x00,0x25,0x00,0x00,0x00,0x80,0x36,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x9c,0x36,0x00,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa0,0x36,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xd4,0x36,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xcc,0x36,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x0d,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0x36,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x4c,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x1c,0x37,0x00,0x00,0x13,0x00,0x00,0x00,0x44,0x38,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0x37,0x00,0x00,0x25,0x00,0x00,0x00,0x5c,0x37,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x78,0x37,0x00,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0x37,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xb0,0x37,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa8,0x37,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x0b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x37,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x37,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x11,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0x38,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x38,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x4a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x3c,0x38,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x4d,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x64,0x38,0x00,0x00,0x13,0x00,0x00,0x00,0xac,0x38,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x48,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x40,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x38,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x4e,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x10,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x4f,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x50,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x10,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x51,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x14,0x39,0x00,0x00,0x13,0x00,0x00,0x00,0x94,0x39,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x13,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0x39,0x00,0x00,0x25,0x00,0x00,0x00,0x50,0x39,0x00,0x00,0x05,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x3b,0x04,0x04,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x8c,0x39,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0x39,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x52,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xb4,0x39,0x00,0x00,0x13,0x00,0x00,0x00,0xfc,0x39,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x42,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x40,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0x39,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x53,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x54,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x0b,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x55,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x56,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x0b,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x57,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x58,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x0f,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x59,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x10,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x5a,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x0f,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x5b,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x10,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x5c,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xf4,0x3a,0x00,0x00,0x13,0x00,0x00,0x00,0x14,0x3b,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x39,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x5d,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x34,0x3b,0x00,0x00,0x13,0x00,0x00,0x00,0xcc,0x3c,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x64,0x3b,0x00,0x00,0x13,0x00,0x00,0x00,0xb8,0x3c,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xdc,0x3b,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd4,0x3b,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x08,0x03,0x00,0x00,0x0a,0x04,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x58,0x3c,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x3c,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x5c,0x3c,0x00,0x00,0x05,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x4e,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x4d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0x3c,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0x3c,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x5e,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xec,0x3c,0x00,0x00,0x13,0x00,0x00,0x00,0xdc,0x3e,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x1c,0x3d,0x00,0x00,0x13,0x00,0x00,0x00,0xc8,0x3e,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x94,0x3d,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0x3d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x10,0x3e,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0x3e,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x14,0x3e,0x00,0x00,0x05,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x52,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x51,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x51,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x4d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x51,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x50,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc0,0x3e,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd4,0x3e,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x5f,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xfc,0x3e,0x00,0x00,0x13,0x00,0x00,0x00,0xf8,0x41,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x1c,0x3f,0x00,0x00,0x13,0x00,0x00,0x00,0x94,0x3f,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x54,0x3f,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0x3f,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0e,0x04,0x00,0x00,0x0f,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0x3f,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xac,0x3f,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0x40,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe4,0x3f,0x00,0x00,0x25,0x00,0x00,0x00,0xe8,0x3f,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1c,0x40,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x3c,0x40,0x00,0x00,0x13,0x00,0x00,0x00,0x74,0x40,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x0b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x6c,0x40,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2a,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x40,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x40,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x0c,0x41,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x41,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x10,0x41,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x03,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2a,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0x41,0x00,0x00,0x25,0x00,0x00,0x00,0x50,0x41,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x7c,0x41,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x70,0x41,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x80,0x41,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2a,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x41,0x00,0x00,0x25,0x00,0x00,0x00,0xb0,0x41,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x42,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x41,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x60,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x18,0x42,0x00,0x00,0x13,0x00,0x00,0x00,0xe8,0x46,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x38,0x42,0x00,0x00,0x13,0x00,0x00,0x00,0x70,0x42,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x08,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0x42,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x88,0x42,0x00,0x00,0x13,0x00,0x00,0x00,0xc0,0x42,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x0a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb8,0x42,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xd8,0x42,0x00,0x00,0x13,0x00,0x00,0x00,0xfc,0x42,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x5a,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x14,0x43,0x00,0x00,0x13,0x00,0x00,0x00,0x5c,0x46,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x3c,0x43,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0x43,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0x43,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x90,0x43,0x00,0x00,0x25,0x00,0x00,0x00,0x94,0x43,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x20,0x44,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0x43,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0x43,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x08,0x44,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xfc,0x43,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x0c,0x44,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x48,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x44,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x44,0x00,0x00,0x05,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x4c,0x45,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x07,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x9c,0x44,0x00,0x00,0x25,0x00,0x00,0x00,0xa0,0x44,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x58,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x58,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x4d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x45,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0x45,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x58,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x50,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x07,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0x45,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0x45,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x20,0x03,0x02,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc8,0x45,0x00,0x00,0x25,0x00,0x00,0x00,0xcc,0x45,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xf8,0x45,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0x45,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xfc,0x45,0x00,0x00,0x05,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x48,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x3c,0x46,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0x46,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x4d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x07,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2a,0x03,0x00,0x00,0x07,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb8,0x46,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0x46,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0x46,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x61,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x08,0x47,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0x47,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x5f,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x40,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x47,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x62,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x70,0x47,0x00,0x00,0x13,0x00,0x00,0x00,0x48,0x4d,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x90,0x47,0x00,0x00,0x13,0x00,0x00,0x00,0xd8,0x47,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x67,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x40,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd0,0x47,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xf0,0x47,0x00,0x00,0x13,0x00,0x00,0x00,0x38,0x48,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x65,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x40,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0x48,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x50,0x48,0x00,0x00,0x13,0x00,0x00,0x00,0x80,0x4c,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x62,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x88,0x48,0x00,0x00,0x25,0x00,0x00,0x00,0x8c,0x48,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x0c,0x49,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x32,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x46,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x48,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x48,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2b,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x49,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x34,0x49,0x00,0x00,0x25,0x00,0x00,0x00,0x38,0x49,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xf8,0x49,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x84,0x49,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x46,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x7c,0x49,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x33,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x46,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc8,0x49,0x00,0x00,0x25,0x00,0x00,0x00,0xcc,0x49,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2b,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x49,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x60,0x4c,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x34,0x4a,0x00,0x00,0x25,0x00,0x00,0x00,0x38,0x4a,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xb4,0x4b,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xfc,0x4a,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa0,0x4a,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x4a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x46,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x4a,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x4a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x63,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0x4b,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0x4b,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x33,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0x4b,0x00,0x00,0x25,0x00,0x00,0x00,0x98,0x4b,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x62,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf8,0x4b,0x00,0x00,0x25,0x00,0x00,0x00,0xfc,0x4b,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0x4c,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0x4c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x62,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x61,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x46,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0x4c,0x00,0x00,0x25,0x00,0x00,0x00,0xf0,0x4c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2a,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x4d,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0x4d,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0x4d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x63,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x64,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x80,0x4d,0x00,0x00,0x13,0x00,0x00,0x00,0x2c,0x51,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x71,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0x4d,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0x4d,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xdc,0x4d,0x00,0x00,0x13,0x00,0x00,0x00,0x18,0x51,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x3c,0x03,0x00,0x00,0x6d,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x64,0x4e,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0x4e,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x4f,0x00,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x18,0x4f,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x67,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0x4f,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x4f,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0x4f,0x00,0x00,0x25,0x00,0x00,0x00,0x50,0x4f,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x96,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa8,0x4f,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0x4f,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6e,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x50,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x50,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x64,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0x50,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0x50,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe8,0x50,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0x50,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x51,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x51,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x65,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x4c,0x51,0x00,0x00,0x13,0x00,0x00,0x00,0x2c,0x55,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x76,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x75,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x88,0x51,0x00,0x00,0x25,0x00,0x00,0x00,0x8c,0x51,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xa8,0x51,0x00,0x00,0x13,0x00,0x00,0x00,0x18,0x55,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x03,0x00,0x00,0x6d,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xf4,0x51,0x00,0x00,0x08,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x2c,0x52,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x50,0x52,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0x52,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x54,0x52,0x00,0x00,0x05,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x74,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x74,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x53,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0x53,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x96,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x6c,0x53,0x00,0x00,0x25,0x00,0x00,0x00,0x70,0x53,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x73,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0x54,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0x54,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x64,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x54,0x00,0x00,0x25,0x00,0x00,0x00,0x84,0x54,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x54,0x00,0x00,0x25,0x00,0x00,0x00,0xb0,0x54,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0x54,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0x54,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x55,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x55,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x66,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x67,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x10,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x68,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x7c,0x55,0x00,0x00,0x13,0x00,0x00,0x00,0xb4,0x58,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x79,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x5a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x55,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x55,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xd4,0x55,0x00,0x00,0x13,0x00,0x00,0x00,0xa0,0x58,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x20,0x56,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x14,0x56,0x00,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0x56,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0x56,0x00,0x00,0x0a,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x88,0x56,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x56,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x1a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0x57,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0x57,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x44,0x57,0x00,0x00,0x25,0x00,0x00,0x00,0x48,0x57,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x78,0x57,0x00,0x00,0x13,0x00,0x00,0x00,0xe4,0x57,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x57,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x58,0x00,0x00,0x25,0x00,0x00,0x00,0x08,0x58,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x24,0x58,0x00,0x00,0x64,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x28,0x58,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x95,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0x58,0x00,0x00,0x25,0x00,0x00,0x00,0x50,0x58,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x98,0x58,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x58,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x69,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xd4,0x58,0x00,0x00,0x13,0x00,0x00,0x00,0xc8,0x5b,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x96,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0x59,0x00,0x00,0x25,0x00,0x00,0x00,0x34,0x59,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x7a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x59,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x59,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0x59,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0x59,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x68,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x5a,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x5a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x74,0x5a,0x00,0x00,0x25,0x00,0x00,0x00,0x78,0x5a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd0,0x5a,0x00,0x00,0x25,0x00,0x00,0x00,0xd4,0x5a,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x67,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0x5b,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0x5b,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x74,0x5b,0x00,0x00,0x25,0x00,0x00,0x00,0x78,0x5b,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc0,0x5b,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x10,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x18,0x5c,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0x5f,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x7d,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x7c,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x54,0x5c,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0x5c,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x74,0x5c,0x00,0x00,0x13,0x00,0x00,0x00,0xf8,0x5e,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x03,0x00,0x00,0x6d,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xc0,0x5c,0x00,0x00,0x08,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xf8,0x5c,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x1c,0x5d,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0x5d,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x20,0x5d,0x00,0x00,0x05,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x74,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x74,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x7c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x9b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x5d,0x00,0x00,0x25,0x00,0x00,0x00,0xf4,0x5d,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x6b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0x5e,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0x5e,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0x5e,0x00,0x00,0x25,0x00,0x00,0x00,0x90,0x5e,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb8,0x5e,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0x5e,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x5e,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x5f,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x2c,0x5f,0x00,0x00,0x13,0x00,0x00,0x00,0xd8,0x62,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x7e,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0x5f,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0x5f,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x88,0x5f,0x00,0x00,0x13,0x00,0x00,0x00,0xc4,0x62,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x03,0x00,0x00,0x6d,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xd8,0x5f,0x00,0x00,0x08,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x10,0x60,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x34,0x60,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x28,0x60,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x38,0x60,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x7e,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x9b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0x60,0x00,0x00,0x25,0x00,0x00,0x00,0xc8,0x60,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x6b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x34,0x61,0x00,0x00,0x25,0x00,0x00,0x00,0x38,0x61,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0x61,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0x61,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x61,0x00,0x00,0x25,0x00,0x00,0x00,0xa8,0x61,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x6c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0x62,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x62,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0x62,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0x62,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0x62,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0x62,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0x62,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd0,0x62,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x6e,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xf8,0x62,0x00,0x00,0x13,0x00,0x00,0x00,0x6c,0x63,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x61,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x63,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x6f,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x8c,0x63,0x00,0x00,0x13,0x00,0x00,0x00,0x58,0x64,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x81,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1c,0x64,0x00,0x00,0x25,0x00,0x00,0x00,0x20,0x64,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x50,0x64,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x70,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0xff,0xff,0xff,0xff,0x2d,0x04,0x00,0x00,0x71,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x90,0x64,0x00,0x00,0x13,0x00,0x00,0x00,0xb4,0x64,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,0xff,0xff,0xff,0xff,0x2f,0x04,0x00,0x00,0x71,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x72,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xd4,0x64,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0x65,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x83,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x71,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x32,0x04,0x04,0x03,0x2f,0x04,0x00,0x00,0x71,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x71,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x73,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x2c,0x65,0x00,0x00,0x13,0x00,0x00,0x00,0x60,0x65,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x58,0x65,0x00,0x00,0x40,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x74,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x80,0x65,0x00,0x00,0x13,0x00,0x00,0x00,0xc0,0x65,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x85,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xb8,0x65,0x00,0x00,0x41,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x75,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xe0,0x65,0x00,0x00,0x13,0x00,0x00,0x00,0xa4,0x66,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x86,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x75,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x66,0x00,0x00,0x25,0x00,0x00,0x00,0x28,0x66,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x3c,0x66,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x74,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x66,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x66,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x00,0x00,0x24,0x00,0x00,0x00,0x9c,0x66,0x00,0x00,0x42,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x76,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xc4,0x66,0x00,0x00,0x13,0x00,0x00,0x00,0x3c,0x69,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x89,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xe4,0x66,0x00,0x00,0x13,0x00,0x00,0x00,0x98,0x68,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xa4,0x67,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x2c,0x67,0x00,0x00,0x40,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x30,0x67,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x64,0x67,0x00,0x00,0x42,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x67,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x27,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x9c,0x67,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xbc,0x67,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xe0,0x67,0x00,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0x67,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x60,0x68,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x18,0x68,0x00,0x00,0x40,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0x68,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x50,0x68,0x00,0x00,0x42,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0x68,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x87,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x90,0x68,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xd0,0x68,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd4,0x68,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xf0,0x68,0x00,0x00,0x6e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf4,0x68,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x28,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x69,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x69,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x28,0x69,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x5c,0x69,0x00,0x00,0x13,0x00,0x00,0x00,0x1c,0x6b,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x8a,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x8c,0x69,0x00,0x00,0x13,0x00,0x00,0x00,0xec,0x6a,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x4b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0x69,0x00,0x00,0x25,0x00,0x00,0x00,0xc8,0x69,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x40,0x6a,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x4c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x6a,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0x6a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x76,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0x6a,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x4e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0x6a,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0x6a,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xe4,0x6a,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x4f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x6a,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x6a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x78,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x6a,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x17,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0x6b,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0x6b,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x27,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x3c,0x6b,0x00,0x00,0x13,0x00,0x00,0x00,0xb0,0x6b,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x8b,0x00,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x6c,0x6b,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x33,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x79,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa8,0x6b,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x79,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xd0,0x6b,0x00,0x00,0x13,0x00,0x00,0x00,0x4c,0x70,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x97,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x3c,0x03,0x00,0x00,0x96,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x6c,0x00,0x00,0x25,0x00,0x00,0x00,0x28,0x6c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x28,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x0f,0x03,0x00,0x00,0x5c,0x6c,0x00,0x00,0x13,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x28,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xcc,0x6c,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xc0,0x6c,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xb4,0x6c,0x00,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xd0,0x6c,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xd0,0x6c,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xd0,0x6c,0x00,0x00,0x0a,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xf8,0x6c,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x95,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x58,0x6d,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x4c,0x6d,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x40,0x6d,0x00,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x5c,0x6d,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x5c,0x6d,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x5c,0x6d,0x00,0x00,0x0a,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x84,0x6d,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x94,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xe4,0x6d,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xd8,0x6d,0x00,0x00,0x0b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xcc,0x6d,0x00,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xe8,0x6d,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xe8,0x6d,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xe8,0x6d,0x00,0x00,0x0a,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x10,0x6e,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x93,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x70,0x6e,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x64,0x6e,0x00,0x00,0x0b,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x58,0x6e,0x00,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x74,0x6e,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x74,0x6e,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x74,0x6e,0x00,0x00,0x0a,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x9c,0x6e,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x92,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xfc,0x6e,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xec,0x6e,0x00,0x00,0x3c,0x04,0x00,0x00,0x91,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0xf4,0x6e,0x00,0x00,0x3c,0x04,0x00,0x00,0x90,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2c,0x03,0x00,0x00,0x3e,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x79,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0x6f,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0x6f,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xa0,0x6f,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x90,0x6f,0x00,0x00,0x3c,0x04,0x00,0x00,0x8f,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x98,0x6f,0x00,0x00,0x3c,0x04,0x00,0x00,0x8e,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xf0,0x6f,0x00,0x00,0x3c,0x04,0x00,0x00,0x8d,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0xf8,0x6f,0x00,0x00,0x3c,0x04,0x00,0x00,0x8c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x04,0x04,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x44,0x70,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x7a,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x6c,0x70,0x00,0x00,0x13,0x00,0x00,0x00,0x34,0x71,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x98,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x47,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x70,0x00,0x00,0x25,0x00,0x00,0x00,0xa8,0x70,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x2c,0x71,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0x70,0x00,0x00,0x25,0x00,0x00,0x00,0xf0,0x70,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x0c,0x71,0x00,0x00,0x75,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0x71,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x24,0x71,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x7b,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x20,0x02,0x02,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x60,0x71,0x00,0x00,0x57,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0x71,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x03,0x00,0x00,0x80,0x71,0x00,0x00,0x13,0x00,0x00,0x00,0x40,0x74,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0f,0x04,0x00,0x00,0xa0,0x71,0x00,0x00,0x13,0x00,0x00,0x00,0xd8,0x73,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xe4,0x72,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xf0,0x71,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf4,0x71,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x10,0x72,0x00,0x00,0x13,0x00,0x00,0x00,0xd0,0x72,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x34,0x72,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x99,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x70,0x72,0x00,0x00,0x25,0x00,0x00,0x00,0x74,0x72,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x90,0x72,0x00,0x00,0x13,0x00,0x00,0x00,0xbc,0x72,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xb4,0x72,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc8,0x72,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x72,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x14,0x73,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x73,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x88,0x73,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x54,0x73,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0x73,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x24,0x00,0x00,0x00,0x80,0x73,0x00,0x00,0x11,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x32,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd0,0x73,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xec,0x73,0x00,0x00,0x14,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0x74,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x50,0x74,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0x74,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x7c,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x0f,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x7d,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x90,0x74,0x00,0x00,0x13,0x00,0x00,0x00,0x6c,0x77,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x9b,0x00,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x20,0x02,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x58,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0x74,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x75,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xec,0x75,0x00,0x00,0x20,0x02,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7d,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x34,0x75,0x00,0x00,0x25,0x00,0x00,0x00,0x38,0x75,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x97,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x60,0x75,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0x75,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xdc,0x75,0x00,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7d,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x98,0x75,0x00,0x00,0x25,0x00,0x00,0x00,0x9c,0x75,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x97,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xd0,0x75,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc4,0x75,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x50,0x77,0x00,0x00,0x05,0x03,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0x77,0x00,0x00,0x2c,0x03,0x00,0x00,0x8e,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0x77,0x00,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x47,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0x76,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x76,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x34,0x76,0x00,0x00,0x2c,0x03,0x00,0x00,0x85,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0x77,0x00,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x43,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x5c,0x76,0x00,0x00,0x25,0x00,0x00,0x00,0x60,0x76,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x7c,0x76,0x00,0x00,0x2c,0x03,0x00,0x00,0x81,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0x77,0x00,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x44,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x76,0x00,0x00,0x25,0x00,0x00,0x00,0xa8,0x76,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xc4,0x76,0x00,0x00,0x2c,0x03,0x00,0x00,0x82,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0x77,0x00,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x45,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0x76,0x00,0x00,0x25,0x00,0x00,0x00,0xf0,0x76,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x0c,0x77,0x00,0x00,0x2c,0x03,0x00,0x00,0x83,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0x77,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x9a,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0x77,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0x77,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x50,0x77,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x77,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x7e,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x8c,0x77,0x00,0x00,0x13,0x00,0x00,0x00,0x1c,0x78,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x9c,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x4f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0x77,0x00,0x00,0x25,0x00,0x00,0x00,0xf0,0x77,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x80,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0x78,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x7f,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x3c,0x78,0x00,0x00,0x13,0x00,0x00,0x00,0xbc,0x7a,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x9d,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x5d,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x74,0x78,0x00,0x00,0x25,0x00,0x00,0x00,0x78,0x78,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x04,0x79,0x00,0x00,0x20,0x01,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x5b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd4,0x78,0x00,0x00,0x25,0x00,0x00,0x00,0xd8,0x78,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0x78,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x5b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x5c,0x79,0x00,0x00,0x25,0x00,0x00,0x00,0x60,0x79,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x88,0x79,0x00,0x00,0x25,0x00,0x00,0x00,0x8c,0x79,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xa8,0x79,0x00,0x00,0x13,0x00,0x00,0x00,0xa8,0x7a,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x5c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1c,0x7a,0x00,0x00,0x25,0x00,0x00,0x00,0x20,0x7a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x80,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x7a,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x7a,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa0,0x7a,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x7a,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x80,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xdc,0x7a,0x00,0x00,0x13,0x00,0x00,0x00,0x9c,0x7e,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xa6,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x14,0x7b,0x00,0x00,0x01,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x7b,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x74,0x7b,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x58,0x7b,0x00,0x00,0x3c,0x04,0x00,0x00,0xa5,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x60,0x7b,0x00,0x00,0x3c,0x04,0x00,0x00,0xa4,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x13,0x00,0x00,0x00,0x18,0x7e,0x00,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x98,0x7b,0x00,0x00,0x02,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x9c,0x7b,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x10,0x7c,0x00,0x00,0x08,0x03,0x00,0x00,0x20,0x03,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xd8,0x7b,0x00,0x00,0x15,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0x7b,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xa3,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x13,0x00,0x00,0x00,0x18,0x7e,0x00,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x34,0x7c,0x00,0x00,0x80,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x38,0x7c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x84,0x7c,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xa2,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x13,0x00,0x00,0x00,0x18,0x7e,0x00,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xa8,0x7c,0x00,0x00,0x81,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0x7c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xf8,0x7c,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xa1,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x13,0x00,0x00,0x00,0x18,0x7e,0x00,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x1c,0x7d,0x00,0x00,0x84,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x20,0x7d,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x6c,0x7d,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xa0,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x13,0x00,0x00,0x00,0x18,0x7e,0x00,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x90,0x7d,0x00,0x00,0x08,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x94,0x7d,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xe0,0x7d,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x9f,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x13,0x00,0x00,0x00,0x18,0x7e,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x9e,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0x7e,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x7e,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0x7e,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0x7e,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0x7e,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x81,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xbc,0x7e,0x00,0x00,0x13,0x00,0x00,0x00,0x4c,0x80,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xa9,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x20,0x03,0x02,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x20,0x00,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x2c,0x7f,0x00,0x00,0x6d,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x30,0x7f,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x04,0x00,0x00,0x4c,0x7f,0x00,0x00,0x13,0x00,0x00,0x00,0xac,0x7f,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x94,0x7f,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0x7f,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x98,0x7f,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0xa8,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xcc,0x7f,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0x7f,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xfc,0x7f,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf0,0x7f,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x05,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xa8,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa7,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x44,0x80,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x82,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x6c,0x80,0x00,0x00,0x13,0x00,0x00,0x00,0x5c,0x81,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xab,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x20,0x03,0x02,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xdc,0x80,0x00,0x00,0x3d,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x80,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x0c,0x81,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x81,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x10,0x81,0x00,0x00,0x05,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xa8,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xaa,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x54,0x81,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x83,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x7c,0x81,0x00,0x00,0x13,0x00,0x00,0x00,0x4c,0x87,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xaf,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x46,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x81,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x81,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xd4,0x81,0x00,0x00,0x13,0x00,0x00,0x00,0x38,0x87,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x43,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0x82,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0x82,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x74,0x82,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x81,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x6c,0x82,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x38,0x83,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xae,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf8,0x82,0x00,0x00,0x25,0x00,0x00,0x00,0xfc,0x82,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0x83,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xfc,0x83,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x61,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x61,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x62,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0x83,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x20,0x84,0x00,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x24,0x84,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x18,0x85,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x03,0x00,0x00,0x20,0x03,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x64,0x84,0x00,0x00,0x37,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x84,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xad,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0x84,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0x84,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x85,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x3c,0x85,0x00,0x00,0x6f,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0x85,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x0c,0x86,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xb4,0x85,0x00,0x00,0x6d,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x85,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x61,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa7,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x86,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x30,0x86,0x00,0x00,0x0a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x34,0x86,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x00,0x87,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xa8,0x86,0x00,0x00,0x3d,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0x86,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x61,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xaa,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf8,0x86,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xac,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0x87,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x44,0x87,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x84,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x6c,0x87,0x00,0x00,0x13,0x00,0x00,0x00,0x8c,0x89,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xb1,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0x87,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0x87,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xd0,0x87,0x00,0x00,0x13,0x00,0x00,0x00,0x78,0x89,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x0c,0x88,0x00,0x00,0x75,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0x88,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x5c,0x88,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xb0,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x13,0x00,0x00,0x00,0xc4,0x88,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x96,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb8,0x88,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0x88,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xf4,0x88,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf8,0x88,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0x89,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x89,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x70,0x89,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0x89,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x85,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xac,0x89,0x00,0x00,0x13,0x00,0x00,0x00,0x14,0x8a,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xb2,0x00,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x05,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x87,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0x8a,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x86,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x34,0x8a,0x00,0x00,0x13,0x00,0x00,0x00,0x34,0x8d,0x00,0x00,0x16,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0xb6,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0xb5,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x74,0x8a,0x00,0x00,0x25,0x00,0x00,0x00,0x78,0x8a,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xb4,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0x8a,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0x8a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xd4,0x8a,0x00,0x00,0x13,0x00,0x00,0x00,0x20,0x8d,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x3c,0x03,0x00,0x00,0x6b,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x0c,0x8b,0x00,0x00,0x27,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x14,0x8b,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x2c,0x8b,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0x8d,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x89,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0x8b,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0x8b,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xb3,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x38,0x8c,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x8c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x7c,0x8c,0x00,0x00,0x25,0x00,0x00,0x00,0x80,0x8c,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0x8c,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0x8c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa6,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x8c,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x8c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x8d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x8d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0x8d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x87,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x54,0x8d,0x00,0x00,0x13,0x00,0x00,0x00,0x68,0x8e,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xb7,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x7c,0x8d,0x00,0x00,0x27,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xa0,0x8d,0x00,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x8d,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xdc,0x8d,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x32,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xd4,0x8d,0x00,0x00,0x5e,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x30,0x8e,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x32,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x88,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x28,0x8e,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x87,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0x8e,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x88,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x88,0x8e,0x00,0x00,0x13,0x00,0x00,0x00,0x20,0x92,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xb9,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x54,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0x8e,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0x8e,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x77,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x8f,0x00,0x00,0x25,0x00,0x00,0x00,0x08,0x8f,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x55,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x3c,0x8f,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0x8f,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x78,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0x8f,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0x8f,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x54,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa0,0x8f,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x8f,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xc4,0x8f,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0x92,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xb8,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x55,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x34,0x90,0x00,0x00,0x25,0x00,0x00,0x00,0x38,0x90,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x80,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0x90,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0x90,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x08,0x03,0x00,0x00,0x20,0x03,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0xc4,0x90,0x00,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xb8,0x90,0x00,0x00,0x37,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc8,0x90,0x00,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xc8,0x90,0x00,0x00,0x0a,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x74,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0x90,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x91,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x88,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x44,0x91,0x00,0x00,0x25,0x00,0x00,0x00,0x48,0x91,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x42,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x23,0x04,0x04,0x03,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x91,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x91,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x92,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x92,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x89,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x40,0x92,0x00,0x00,0x13,0x00,0x00,0x00,0xc8,0x95,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xbb,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x01,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x48,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x92,0x00,0x00,0x25,0x00,0x00,0x00,0xb0,0x92,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0x92,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0x92,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xba,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0x93,0x00,0x00,0x25,0x00,0x00,0x00,0x24,0x93,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0x93,0x00,0x00,0x25,0x00,0x00,0x00,0x90,0x93,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x49,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc8,0x93,0x00,0x00,0x25,0x00,0x00,0x00,0xcc,0x93,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x53,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x93,0x00,0x00,0x25,0x00,0x00,0x00,0xf4,0x93,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xc8,0x94,0x00,0x00,0x01,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x05,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x48,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x54,0x94,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0x94,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x49,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x90,0x94,0x00,0x00,0x25,0x00,0x00,0x00,0x94,0x94,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x87,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0x94,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x95,0x00,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x4c,0x95,0x00,0x00,0x01,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x49,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1c,0x95,0x00,0x00,0x25,0x00,0x00,0x00,0x20,0x95,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x95,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x95,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0x95,0x00,0x00,0x25,0x00,0x00,0x00,0x90,0x95,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc0,0x95,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x8a,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xe8,0x95,0x00,0x00,0x13,0x00,0x00,0x00,0x78,0x9b,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0xbf,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x28,0x96,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0x96,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0xbe,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x96,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x96,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xbd,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x96,0x00,0x00,0x25,0x00,0x00,0x00,0xa8,0x96,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xc8,0x96,0x00,0x00,0x13,0x00,0x00,0x00,0x64,0x9b,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x3c,0x03,0x00,0x00,0x6b,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x00,0x97,0x00,0x00,0x28,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x08,0x97,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x20,0x97,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0x9b,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x52,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x97,0x00,0x00,0x25,0x00,0x00,0x00,0xa8,0x97,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd0,0x97,0x00,0x00,0x25,0x00,0x00,0x00,0xd4,0x97,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x01,0x02,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x51,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0x98,0x00,0x00,0x25,0x00,0x00,0x00,0x50,0x98,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x78,0x98,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0x98,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x50,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0x98,0x00,0x00,0x25,0x00,0x00,0x00,0xf8,0x98,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0x99,0x00,0x00,0x25,0x00,0x00,0x00,0x24,0x99,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x44,0x99,0x00,0x00,0x13,0x00,0x00,0x00,0x3c,0x9b,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x20,0x02,0x02,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0x99,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0x99,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0x99,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x9a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa5,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x28,0x9a,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0x9a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xbc,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0x9a,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0x9a,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x9a,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x9a,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x34,0x9b,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x9b,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x5c,0x9b,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x70,0x9b,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x8b,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x98,0x9b,0x00,0x00,0x13,0x00,0x00,0x00,0x30,0x9f,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xc2,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x96,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x9b,0x00,0x00,0x25,0x00,0x00,0x00,0xf4,0x9b,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x56,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0x9c,0x00,0x00,0x25,0x00,0x00,0x00,0x5c,0x9c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0x9c,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0x9c,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0x9c,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0x9c,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x20,0x02,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x57,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1c,0x9d,0x00,0x00,0x25,0x00,0x00,0x00,0x20,0x9d,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x3c,0x9d,0x00,0x00,0x64,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0x9d,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x03,0x00,0x00,0x5c,0x9d,0x00,0x00,0x13,0x00,0x00,0x00,0xa4,0x9e,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xc1,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x20,0x03,0x02,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x04,0x9e,0x00,0x00,0x64,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x08,0x9e,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x34,0x9e,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x28,0x9e,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x38,0x9e,0x00,0x00,0x05,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xa8,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x63,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x9e,0x00,0x00,0x25,0x00,0x00,0x00,0x84,0x9e,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0x9c,0x9e,0x00,0x00,0x11,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x9e,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x9e,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x8d,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x9e,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x9e,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x28,0x9f,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x8c,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x50,0x9f,0x00,0x00,0x13,0x00,0x00,0x00,0xec,0xa0,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xc3,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xe4,0x9f,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xae,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x9f,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0xa0,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0xa0,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0xa0,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0xa0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x93,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe4,0xa0,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x8d,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x0c,0xa1,0x00,0x00,0x13,0x00,0x00,0x00,0xf8,0xa1,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xc4,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x91,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x50,0xa1,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0xa1,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xac,0xa1,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x92,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0xa1,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x8f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0xa1,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x8e,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x18,0xa2,0x00,0x00,0x13,0x00,0x00,0x00,0x6c,0xa5,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xc5,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x96,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x70,0xa2,0x00,0x00,0x25,0x00,0x00,0x00,0x74,0xa2,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x59,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0xa2,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0xa2,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0xa3,0x00,0x00,0x25,0x00,0x00,0x00,0x08,0xa3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0xa3,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0xa3,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x20,0x02,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x5a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x9c,0xa3,0x00,0x00,0x25,0x00,0x00,0x00,0xa0,0xa3,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x04,0x00,0x00,0xbc,0xa3,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0xa4,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1c,0xa4,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x44,0xa4,0x00,0x00,0x25,0x00,0x00,0x00,0x48,0xa4,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x64,0xa4,0x00,0x00,0x64,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0xa4,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x59,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0xa4,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0xa4,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0xa4,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0xa4,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xfc,0xa4,0x00,0x00,0x2c,0x03,0x00,0x00,0x94,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x04,0xa5,0x00,0x00,0x2c,0x03,0x00,0x00,0x95,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0xa5,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0xa5,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0xa5,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x8f,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd7,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xd7,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xc4,0xa5,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc8,0xa5,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd6,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xd5,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x14,0xa6,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0xa6,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd4,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xd3,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x68,0xa6,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0xa6,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd2,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xd2,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xbc,0xa6,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0xa6,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd1,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xd1,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x10,0xa7,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0xa7,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x62,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0x62,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x64,0xa7,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0xa7,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xcf,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xd0,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xb8,0xa7,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0xa7,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xcf,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xce,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x0c,0xa8,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0xa8,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xcd,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xcc,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x60,0xa8,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0xa8,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xcb,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xca,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xb4,0xa8,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0xa8,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xc9,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xc8,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x08,0xa9,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x0c,0xa9,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xc7,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xc6,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x5c,0xa9,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x60,0xa9,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x80,0xa9,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x84,0xa9,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xa0,0xa9,0x00,0x00,0x6e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0xa9,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x90,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xc8,0xa9,0x00,0x00,0x13,0x00,0x00,0x00,0xc4,0xab,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xd8,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x59,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0xaa,0x00,0x00,0x25,0x00,0x00,0x00,0x08,0xaa,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x90,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x30,0xaa,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x34,0xaa,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x50,0xaa,0x00,0x00,0x13,0x00,0x00,0x00,0xb0,0xab,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xa8,0xab,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x59,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0xaa,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0xaa,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0xaa,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0xaa,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xa0,0xab,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0xab,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0xab,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x28,0xab,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x03,0x02,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x5a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0xab,0x00,0x00,0x25,0x00,0x00,0x00,0x5c,0xab,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x78,0xab,0x00,0x00,0x65,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0xab,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x98,0xab,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0xab,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x91,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xe4,0xab,0x00,0x00,0x13,0x00,0x00,0x00,0x04,0xb1,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xd9,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x59,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0xac,0x00,0x00,0x25,0x00,0x00,0x00,0x24,0xac,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x90,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x4c,0xac,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x50,0xac,0x00,0x00,0x05,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x5a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x88,0xac,0x00,0x00,0x25,0x00,0x00,0x00,0x8c,0xac,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xac,0xac,0x00,0x00,0x13,0x00,0x00,0x00,0xf0,0xb0,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x58,0xae,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0xad,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0xad,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x98,0xad,0x00,0x00,0x25,0x00,0x00,0x00,0x9c,0xad,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0xae,0x00,0x00,0x25,0x00,0x00,0x00,0x08,0xae,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x50,0xae,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0xaf,0x00,0x00,0x25,0x00,0x00,0x00,0x08,0xaf,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x3c,0xaf,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0xaf,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa8,0xaf,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xaf,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0xb0,0x00,0x00,0x25,0x00,0x00,0x00,0x08,0xb0,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x70,0xb0,0x00,0x00,0x25,0x00,0x00,0x00,0x74,0xb0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x9c,0xb0,0x00,0x00,0x25,0x00,0x00,0x00,0xa0,0xb0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe8,0xb0,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0xb0,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x92,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x24,0xb1,0x00,0x00,0x13,0x00,0x00,0x00,0xd8,0xb2,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xda,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x4c,0xb1,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x62,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0xb2,0x00,0x00,0x25,0x00,0x00,0x00,0x0c,0xb2,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0xb2,0x00,0x00,0x25,0x00,0x00,0x00,0x5c,0xb2,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x93,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0xb2,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0xb2,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd0,0xb2,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x93,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xf8,0xb2,0x00,0x00,0x13,0x00,0x00,0x00,0x94,0xb4,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xdb,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x8c,0xb3,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xae,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0xb3,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa8,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0xb4,0x00,0x00,0x25,0x00,0x00,0x00,0x30,0xb4,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0xb4,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0xb4,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x93,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0xb4,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x94,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xb4,0xb4,0x00,0x00,0x13,0x00,0x00,0x00,0xa4,0xb8,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xde,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xd4,0xb4,0x00,0x00,0x13,0x00,0x00,0x00,0x94,0xb6,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xfc,0xb4,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x33,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xdd,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0xb5,0x00,0x00,0x25,0x00,0x00,0x00,0xc8,0xb5,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0xb6,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0xb6,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0xb6,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0xb6,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0xb6,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x20,0xb7,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xae,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0xb7,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x0b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x54,0xb7,0x00,0x00,0x65,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0xb7,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x33,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xb4,0xb7,0x00,0x00,0x65,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0xb7,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xdc,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0xb8,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0xb8,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x78,0xb8,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0xb8,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x9c,0xb8,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x95,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xc4,0xb8,0x00,0x00,0x13,0x00,0x00,0x00,0x28,0xbf,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0xea,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xe4,0xb8,0x00,0x00,0x13,0x00,0x00,0x00,0x7c,0xbb,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xe9,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x3c,0x03,0x00,0x00,0x6d,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xa0,0xb9,0x00,0x00,0x3c,0x03,0x00,0x00,0xb8,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x50,0xb9,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xe5,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x13,0x00,0x00,0x00,0x1c,0xbb,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xe5,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xe4,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x13,0x00,0x00,0x00,0x1c,0xbb,0x00,0x00,0x3c,0x03,0x00,0x00,0xb8,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xf8,0xb9,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xe8,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0xb9,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0xbb,0x00,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x1c,0xbb,0x00,0x00,0x01,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0xe7,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0xba,0x00,0x00,0x25,0x00,0x00,0x00,0x28,0xba,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x03,0x00,0x00,0x44,0xba,0x00,0x00,0x13,0x00,0x00,0x00,0x08,0xbb,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xe6,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xe5,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xe4,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0xbb,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0xbb,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x9b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x74,0xbb,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x94,0xbb,0x00,0x00,0x13,0x00,0x00,0x00,0x6c,0xbc,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xe3,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xe2,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0xbc,0x00,0x00,0x25,0x00,0x00,0x00,0x34,0xbc,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0xbc,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0xe1,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0xbc,0x00,0x00,0x25,0x00,0x00,0x00,0xa8,0xbc,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xe0,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x73,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0xbc,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0xbc,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x04,0xbd,0x00,0x00,0x13,0x00,0x00,0x00,0x14,0xbf,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x78,0xbd,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0xbd,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0xbd,0x00,0x00,0x25,0x00,0x00,0x00,0xb0,0xbd,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x6b,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xf8,0xbd,0x00,0x00,0x27,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x00,0xbe,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0xbe,0x00,0x00,0x25,0x00,0x00,0x00,0x34,0xbe,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa5,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x5c,0xbe,0x00,0x00,0x25,0x00,0x00,0x00,0x60,0xbe,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xdf,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe4,0xbe,0x00,0x00,0x25,0x00,0x00,0x00,0xe8,0xbe,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0xbf,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0xbf,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x96,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x86,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x42,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x6c,0xbf,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x70,0xbf,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x8c,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xf3,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xa8,0xbf,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xbf,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x48,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe8,0xbf,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0xbf,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x8b,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x4d,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x28,0xc0,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0xc0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x8a,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x44,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x68,0xc0,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0xc0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x8a,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xf2,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xa8,0xc0,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xc0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xf1,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe8,0xc0,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0xc0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xf0,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x28,0xc1,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0xc1,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x6e,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xef,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x68,0xc1,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0xc1,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xee,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xa8,0xc1,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xc1,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x6a,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x1b,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe8,0xc1,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0xc1,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x1a,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x28,0xc2,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0xc2,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xed,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x68,0xc2,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0xc2,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xec,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xa8,0xc2,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xc2,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x5f,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe8,0xc2,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0xc2,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x61,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x28,0xc3,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0xc3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xeb,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x68,0xc3,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0xc3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x50,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xa8,0xc3,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xc3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x52,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe8,0xc3,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0xc3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x4e,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x28,0xc4,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0xc4,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x4c,0xc4,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x50,0xc4,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x6c,0xc4,0x00,0x00,0x6e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x70,0xc4,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x97,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x94,0xc4,0x00,0x00,0x13,0x00,0x00,0x00,0xe0,0xc5,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xf4,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xb4,0xc4,0x00,0x00,0x13,0x00,0x00,0x00,0x70,0xc5,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xdc,0xc4,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x18,0xc5,0x00,0x00,0x42,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0xc5,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x28,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x32,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0xc5,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xb4,0xc5,0x00,0x00,0x3f,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0xc5,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0xc5,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x98,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x7a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x1a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x73,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x02,0x01,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd7,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd6,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd4,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd2,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd1,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xcf,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xcd,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xcb,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xc9,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xc7,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xdd,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xdc,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x8e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x8c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x90,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x8f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x8d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x91,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x92,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x93,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x94,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x95,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x01,0x01,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xff,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xfe,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xfd,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xfc,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa1,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xfb,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa0,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa3,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xfa,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xf9,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xba,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x96,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x44,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x42,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xbc,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xf8,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xe6,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xdf,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xe4,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xb3,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xb0,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xad,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x9f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa2,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa4,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa5,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xae,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xe5,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xe2,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x62,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa8,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x74,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xf7,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xf6,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2a,0x03,0x00,0x00,0x98,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0xc9,0x00,0x00,0x25,0x00,0x00,0x00,0x34,0xc9,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x03,0x00,0x00,0x50,0xc9,0x00,0x00,0x13,0x00,0x00,0x00,0xa0,0xca,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0f,0x04,0x00,0x00,0x6c,0xc9,0x00,0x00,0x14,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xac,0xc9,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb0,0xc9,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xcc,0xc9,0x00,0x00,0x13,0x00,0x00,0x00,0x8c,0xca,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xf0,0xc9,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xf5,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0xca,0x00,0x00,0x25,0x00,0x00,0x00,0x30,0xca,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x4c,0xca,0x00,0x00,0x13,0x00,0x00,0x00,0x78,0xca,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x70,0xca,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0xca,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x98,0xca,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0xca,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0xca,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x99,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2a,0x03,0x00,0x00,0x98,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0xcb,0x00,0x00,0x25,0x00,0x00,0x00,0x30,0xcb,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x03,0x00,0x00,0x4c,0xcb,0x00,0x00,0x13,0x00,0x00,0x00,0x9c,0xcc,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0f,0x04,0x00,0x00,0x68,0xcb,0x00,0x00,0x14,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xa8,0xcb,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xcb,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xc8,0xcb,0x00,0x00,0x13,0x00,0x00,0x00,0x88,0xcc,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xec,0xcb,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x03,0x01,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x28,0xcc,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0xcc,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x48,0xcc,0x00,0x00,0x13,0x00,0x00,0x00,0x74,0xcc,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x6c,0xcc,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0xcc,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0xcc,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0xcc,0x00,0x00,0x25,0x00,0x00,0x00,0xb0,0xcc,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x9a,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x2d,0x04,0x00,0x00,0x9b,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x24,0xcd,0x00,0x00,0x13,0x00,0x00,0x00,0x70,0xcd,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x01,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x68,0xcd,0x00,0x00,0x11,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x9c,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x90,0xcd,0x00,0x00,0x13,0x00,0x00,0x00,0xe0,0xcd,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x01,0x00,0x00,0x08,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0xcd,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x9d,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x00,0xce,0x00,0x00,0x13,0x00,0x00,0x00,0x90,0xce,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x34,0xce,0x00,0x00,0x75,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x38,0xce,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x68,0xce,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x60,0xce,0x00,0x00,0x11,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x88,0xce,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x9e,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xb0,0xce,0x00,0x00,0x13,0x00,0x00,0x00,0x08,0xcf,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xe4,0xce,0x00,0x00,0x75,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe8,0xce,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xfc,0xce,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x9f,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x28,0xcf,0x00,0x00,0x13,0x00,0x00,0x00,0x9c,0xcf,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x5c,0xcf,0x00,0x00,0x75,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x60,0xcf,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x74,0xcf,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0xcf,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xa0,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xbc,0xcf,0x00,0x00,0x13,0x00,0x00,0x00,0x28,0xd0,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0xcf,0x00,0x00,0x25,0x00,0x00,0x00,0xf8,0xcf,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x24,0x00,0x00,0x00,0x20,0xd0,0x00,0x00,0x67,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xa1,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x48,0xd0,0x00,0x00,0x13,0x00,0x00,0x00,0xb4,0xd0,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0a,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0xd0,0x00,0x00,0x25,0x00,0x00,0x00,0x84,0xd0,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x24,0x00,0x00,0x00,0xac,0xd0,0x00,0x00,0x67,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xa2,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xd4,0xd0,0x00,0x00,0x13,0x00,0x00,0x00,0xf4,0xd4,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x28,0xd1,0x00,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0xd1,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x48,0xd1,0x00,0x00,0x13,0x00,0x00,0x00,0xe0,0xd4,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa1,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0xd1,0x00,0x00,0x25,0x00,0x00,0x00,0x98,0xd1,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xfc,0xd1,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa2,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0xd1,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0xd1,0x00,0x00,0x05,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xf0,0xd1,0x00,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x00,0xd2,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x00,0xd2,0x00,0x00,0x0a,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x90,0xd4,0x00,0x00,0x01,0x01,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x74,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x20,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0xd2,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0xd2,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xf7,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xd8,0xd2,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0xd2,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x10,0xd3,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0xd3,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0xd3,0x00,0x00,0x25,0x00,0x00,0x00,0x50,0xd3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x42,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x78,0xd3,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0xd3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0xd3,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0xd3,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xf0,0xd3,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf4,0xd3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x41,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1c,0xd4,0x00,0x00,0x25,0x00,0x00,0x00,0x20,0xd4,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0xd4,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0xd4,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x88,0xd4,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0xd4,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0xd4,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xa3,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x14,0xd5,0x00,0x00,0x13,0x00,0x00,0x00,0x98,0xd8,0x00,0x00,0x16,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x0e,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0x34,0xd5,0x00,0x00,0x13,0x00,0x00,0x00,0xa8,0xd7,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x74,0xd5,0x00,0x00,0x25,0x00,0x00,0x00,0x78,0xd5,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa8,0xd5,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xd5,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xcc,0xd5,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0xd5,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x20,0x02,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0xd6,0x00,0x00,0x25,0x00,0x00,0x00,0x0c,0xd6,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0xd6,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0xd6,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x41,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x6c,0xd6,0x00,0x00,0x25,0x00,0x00,0x00,0x70,0xd6,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0xd6,0x00,0x00,0x25,0x00,0x00,0x00,0xb4,0xd6,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe8,0xd6,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0xd6,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x42,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0xd7,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0xd7,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0xd7,0x00,0x00,0x25,0x00,0x00,0x00,0x50,0xd7,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x41,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x78,0xd7,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0xd7,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa0,0xd7,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xc0,0xd7,0x00,0x00,0x13,0x00,0x00,0x00,0x6c,0xd8,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x00,0xd8,0x00,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9d,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf8,0xd7,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0xd8,0x00,0x00,0x25,0x00,0x00,0x00,0x30,0xd8,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0xd8,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x28,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x90,0xd8,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xa4,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xb8,0xd8,0x00,0x00,0x13,0x00,0x00,0x00,0xc4,0xda,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf8,0xd8,0x00,0x00,0x25,0x00,0x00,0x00,0xfc,0xd8,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0xd9,0x00,0x00,0x25,0x00,0x00,0x00,0x30,0xd9,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x50,0xd9,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0xd9,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x20,0x02,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0xd9,0x00,0x00,0x25,0x00,0x00,0x00,0x90,0xd9,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0xd9,0x00,0x00,0x25,0x00,0x00,0x00,0xc8,0xd9,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x41,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0xd9,0x00,0x00,0x25,0x00,0x00,0x00,0xf4,0xd9,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0xda,0x00,0x00,0x25,0x00,0x00,0x00,0x34,0xda,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0xda,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0xda,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x41,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0xda,0x00,0x00,0x25,0x00,0x00,0x00,0x98,0xda,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0xda,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xa5,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xe4,0xda,0x00,0x00,0x13,0x00,0x00,0x00,0x20,0xdc,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0xdb,0x00,0x00,0x25,0x00,0x00,0x00,0x28,0xdb,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0xdb,0x00,0x00,0x25,0x00,0x00,0x00,0x5c,0xdb,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x7c,0xdb,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x80,0xdb,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0xdb,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0xdb,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9f,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0xdb,0x00,0x00,0x25,0x00,0x00,0x00,0xf4,0xdb,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0xdc,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xa6,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x40,0xdc,0x00,0x00,0x13,0x00,0x00,0x00,0xcc,0xdc,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x11,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa8,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x78,0xdc,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0xdc,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xa3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0xdc,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xa7,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xec,0xdc,0x00,0x00,0x13,0x00,0x00,0x00,0x28,0xde,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x01,0x00,0x00,0x3c,0x03,0x00,0x00,0xb8,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x88,0xdd,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xf8,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0xdd,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x6b,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xc0,0xdd,0x00,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9d,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb8,0xdd,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x03,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xe6,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0xde,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xa8,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0e,0x04,0x00,0x00,0x75,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xa9,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x60,0xde,0x00,0x00,0x13,0x00,0x00,0x00,0x3c,0xdf,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x98,0xde,0x00,0x00,0x59,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x9c,0xde,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xb8,0xde,0x00,0x00,0x61,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0xde,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x2c,0x04,0x00,0x00,0x3f,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe8,0xde,0x00,0x00,0x59,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0xde,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x08,0xdf,0x00,0x00,0x61,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x0c,0xdf,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0x13,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0x34,0xdf,0x00,0x00,0x26,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xaa,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x0b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xa0,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x80,0xdf,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x84,0xdf,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xa1,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xbc,0xdf,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0xdf,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0xad,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xfc,0xdf,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0x9f,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x3c,0xe0,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0xe0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x60,0xe0,0x00,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0xe0,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x80,0xe0,0x00,0x00,0x6e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x84,0xe0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0xab,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xa8,0xe0,0x00,0x00,0x13,0x00,0x00,0x00,0xbc,0xe7,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x17,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0xc8,0xe0,0x00,0x00,0x13,0x00,0x00,0x00,0x5c,0xe2,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x01,0x00,0x00,0x0b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x35,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x54,0xe1,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x14,0xe1,0x00,0x00,0x23,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0xe1,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0e,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0xe1,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x38,0xe2,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x0b,0x04,0x00,0x00,0x10,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xb8,0xe1,0x00,0x00,0x5b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0xe1,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xd8,0xe1,0x00,0x00,0x23,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0xe1,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0e,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0xe2,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0xe2,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0x30,0xe2,0x00,0x00,0x63,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x54,0xe2,0x00,0x00,0x77,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x74,0xe2,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0xe4,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb8,0xe2,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0xe2,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xd8,0xe2,0x00,0x00,0x13,0x00,0x00,0x00,0x3c,0xe4,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x2c,0x03,0x00,0x00,0x3b,0x00,0x00,0x00,0x20,0x03,0x02,0x00,0x20,0x02,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0xe3,0x00,0x00,0x25,0x00,0x00,0x00,0x24,0xe3,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x54,0xe3,0x00,0x00,0x65,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0xe3,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x74,0xe3,0x00,0x00,0x59,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x78,0xe3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xa8,0xe3,0x00,0x00,0x59,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xe3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xcc,0xe3,0x00,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0xe3,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xec,0xe3,0x00,0x00,0x61,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf0,0xe3,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x02,0x00,0x00,0x2f,0x04,0x00,0x00,0x3b,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x3c,0x00,0x00,0x00,0x32,0x04,0x04,0x03,0x2f,0x04,0x00,0x00,0x3c,0x00,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x3c,0x00,0x00,0x00,0x33,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0xe4,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0xe4,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0xe4,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x2c,0x04,0x00,0x00,0xab,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xc4,0xe4,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc8,0xe4,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xe8,0xe4,0x00,0x00,0x13,0x00,0x00,0x00,0xa8,0xe7,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x35,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x0c,0xe7,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x58,0xe5,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x4c,0xe5,0x00,0x00,0x25,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x5c,0xe5,0x00,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x5c,0xe5,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x78,0xe5,0x00,0x00,0x13,0x00,0x00,0x00,0xf8,0xe6,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x3d,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xbc,0xe5,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0xe5,0x00,0x00,0x05,0x04,0x00,0x00,0x3b,0x04,0x04,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x54,0xe6,0x00,0x00,0x01,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0xe6,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0xe6,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x3d,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x48,0xe6,0x00,0x00,0x42,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0xe6,0x00,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x58,0xe6,0x00,0x00,0x09,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x3d,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x98,0xe6,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x9c,0xe6,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0xe6,0x00,0x00,0x25,0x00,0x00,0x00,0xdc,0xe6,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x02,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0xe7,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0xe7,0x00,0x00,0x25,0x00,0x00,0x00,0x50,0xe7,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x88,0xe7,0x00,0x00,0x25,0x00,0x00,0x00,0x8c,0xe7,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x02,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0xe7,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xac,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xdc,0xe7,0x00,0x00,0x13,0x00,0x00,0x00,0x70,0xe9,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x20,0x03,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0xe8,0x00,0x00,0x25,0x00,0x00,0x00,0x24,0xe8,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xdc,0xe8,0x00,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0xe8,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0xe8,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xad,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xac,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa8,0xe8,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xe8,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd0,0xe8,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0xe8,0x00,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xe4,0xe8,0x00,0x00,0x0b,0x04,0x00,0x00,0xff,0xff,0xff,0xff,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0xe9,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0xe9,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x50,0xe9,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0xe9,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x42,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xad,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x90,0xe9,0x00,0x00,0x13,0x00,0x00,0x00,0x4c,0xea,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x3b,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xd4,0xe9,0x00,0x00,0x64,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc8,0xe9,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xd8,0xe9,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x03,0x02,0x00,0x2c,0x04,0x00,0x00,0x3c,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x00,0xea,0x00,0x00,0x59,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0xea,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x20,0xea,0x00,0x00,0x61,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x24,0xea,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0x44,0xea,0x00,0x00,0x26,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xae,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x6c,0xea,0x00,0x00,0x13,0x00,0x00,0x00,0x4c,0xeb,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1a,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0x8c,0xea,0x00,0x00,0x13,0x00,0x00,0x00,0x1c,0xeb,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x35,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x14,0xeb,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xdc,0xea,0x00,0x00,0x94,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0xea,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xe0,0xea,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x32,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0xeb,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x44,0xeb,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xaf,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x6c,0xeb,0x00,0x00,0x13,0x00,0x00,0x00,0x04,0xed,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0x8c,0xeb,0x00,0x00,0x13,0x00,0x00,0x00,0x14,0xec,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1b,0x01,0x00,0x00,0x26,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x0c,0xec,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x33,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0xeb,0x00,0x00,0x25,0x00,0x00,0x00,0xe8,0xeb,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xf8,0xeb,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x50,0xec,0x00,0x00,0x65,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0xec,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x54,0xec,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x03,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x7c,0xec,0x00,0x00,0x65,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x80,0xec,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xaf,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0xec,0x00,0x00,0x25,0x00,0x00,0x00,0xa8,0xec,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x33,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0xd0,0xec,0x00,0x00,0x25,0x00,0x00,0x00,0xd4,0xec,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x24,0x00,0x00,0x00,0xfc,0xec,0x00,0x00,0x63,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xb0,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x24,0xed,0x00,0x00,0x13,0x00,0x00,0x00,0x28,0xf1,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0x44,0xed,0x00,0x00,0x13,0x00,0x00,0x00,0x50,0xee,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1f,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x6c,0xed,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x90,0xed,0x00,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x94,0xed,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x24,0xee,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0xed,0x00,0x00,0x25,0x00,0x00,0x00,0xcc,0xed,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xdc,0xed,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9a,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0xee,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0xee,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0xee,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x68,0xee,0x00,0x00,0x13,0x00,0x00,0x00,0xe8,0xef,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1e,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x90,0xee,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xb4,0xee,0x00,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0xee,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xf0,0xee,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe8,0xee,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x14,0xef,0x00,0x00,0x80,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0xef,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xac,0xef,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x54,0xef,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0xef,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x84,0xef,0x00,0x00,0x59,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0xef,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0xa4,0xef,0x00,0x00,0x63,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x1d,0x01,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0xef,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x14,0xf0,0x00,0x00,0x66,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0xf0,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x20,0xf1,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x28,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x50,0xf0,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0xf0,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0xf0,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0xf0,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x98,0xf0,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x99,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc8,0xf0,0x00,0x00,0x25,0x00,0x00,0x00,0xcc,0xf0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xb0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf8,0xf0,0x00,0x00,0x25,0x00,0x00,0x00,0xfc,0xf0,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0x18,0xf1,0x00,0x00,0x63,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xb1,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x48,0xf1,0x00,0x00,0x13,0x00,0x00,0x00,0x5c,0xfd,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x25,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0x68,0xf1,0x00,0x00,0x13,0x00,0x00,0x00,0xd8,0xf2,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x94,0xf1,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xb8,0xf1,0x00,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0xf1,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xf4,0xf1,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0xf1,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x18,0xf2,0x00,0x00,0x80,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0xf2,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x9c,0xf2,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0xf2,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0xf2,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x64,0xf2,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x88,0xf2,0x00,0x00,0x94,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x8c,0xf2,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x32,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x1d,0x01,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd0,0xf2,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xf0,0xf2,0x00,0x00,0x13,0x00,0x00,0x00,0x74,0xf3,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0xf3,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0xf3,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x3c,0xf3,0x00,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x60,0xf3,0x00,0x00,0x94,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0xf3,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x32,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x8c,0xf3,0x00,0x00,0x13,0x00,0x00,0x00,0xa4,0xf4,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0xac,0xf3,0x00,0x00,0x13,0x00,0x00,0x00,0x68,0xf4,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xd4,0xf3,0x00,0x00,0x27,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0xf4,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0xf4,0x00,0x00,0x05,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x1c,0xf4,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0xf4,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x32,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0xf4,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x9c,0xf4,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xbc,0xf4,0x00,0x00,0x13,0x00,0x00,0x00,0x3c,0xf6,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xe4,0xf4,0x00,0x00,0x27,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0xf5,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0xf5,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xa8,0xf5,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x5c,0xf5,0x00,0x00,0x3c,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x60,0xf5,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa0,0xf5,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0xf5,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0xf5,0x00,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xf4,0xf5,0x00,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x32,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2b,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x34,0xf6,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x54,0xf6,0x00,0x00,0x13,0x00,0x00,0x00,0x34,0xfc,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x21,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x80,0xf6,0x00,0x00,0x13,0x00,0x00,0x00,0x10,0xfc,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xb4,0xf6,0x00,0x00,0x66,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0xf6,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x08,0xfc,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0xe4,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0xf4,0xf6,0x00,0x00,0x13,0x00,0x00,0x00,0x54,0xfb,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x18,0xf7,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0xb3,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x48,0xf7,0x00,0x00,0x13,0x00,0x00,0x00,0x40,0xfb,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x6c,0xf7,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0x6e,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0xa0,0xf7,0x00,0x00,0x13,0x00,0x00,0x00,0x2c,0xfb,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xc4,0xf7,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0x73,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0xf8,0xf7,0x00,0x00,0x13,0x00,0x00,0x00,0x18,0xfb,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x1c,0xf8,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0x7c,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x50,0xf8,0x00,0x00,0x13,0x00,0x00,0x00,0x04,0xfb,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x74,0xf8,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0x7e,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0xa8,0xf8,0x00,0x00,0x13,0x00,0x00,0x00,0xf0,0xfa,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xcc,0xf8,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0xdf,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x00,0xf9,0x00,0x00,0x13,0x00,0x00,0x00,0xdc,0xfa,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x24,0xf9,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0xbc,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x58,0xf9,0x00,0x00,0x13,0x00,0x00,0x00,0xc8,0xfa,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x7c,0xf9,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0xe6,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0xb0,0xf9,0x00,0x00,0x13,0x00,0x00,0x00,0xb4,0xfa,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xd4,0xf9,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x08,0xfa,0x00,0x00,0x13,0x00,0x00,0x00,0xa0,0xfa,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x2c,0xfa,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x04,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0x01,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x60,0xfa,0x00,0x00,0x13,0x00,0x00,0x00,0x8c,0xfa,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x84,0xfa,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x98,0xfa,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0xfa,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc0,0xfa,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd4,0xfa,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe8,0xfa,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0xfa,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0xfb,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0xfb,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0xfb,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0xfb,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0xfb,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0xfb,0x00,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa0,0xfb,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0xfb,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xcc,0xfb,0x00,0x00,0x3b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0xfb,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x00,0x00,0x24,0x00,0x00,0x00,0xf8,0xfb,0x00,0x00,0x13,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x17,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0xfc,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x29,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0xfc,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0xfc,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x84,0xfc,0x00,0x00,0x38,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0xfc,0x00,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xa4,0xfc,0x00,0x00,0x13,0x00,0x00,0x00,0x48,0xfd,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0x39,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0xfc,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0xfd,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2f,0x04,0x00,0x00,0x39,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0xfd,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x54,0xfd,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xb2,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x7c,0xfd,0x00,0x00,0x13,0x00,0x00,0x00,0x84,0x0d,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x29,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xa8,0xfd,0x00,0x00,0x3f,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0xfd,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0xcc,0xfd,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0xff,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x18,0xfe,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x0c,0xfe,0x00,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x1c,0xfe,0x00,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x1c,0xfe,0x00,0x00,0x0a,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x04,0xff,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xa9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x54,0xfe,0x00,0x00,0x25,0x00,0x00,0x00,0x58,0xfe,0x00,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xd0,0xfe,0x00,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0xfe,0x00,0x00,0x25,0x00,0x00,0x00,0x90,0xfe,0x00,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xc4,0xfe,0x00,0x00,0x42,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd4,0xfe,0x00,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xd4,0xfe,0x00,0x00,0x09,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0xfe,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x24,0xff,0x00,0x00,0x13,0x00,0x00,0x00,0x48,0x01,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x01,0x00,0x00,0x3c,0x03,0x00,0x00,0x96,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x78,0xff,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x0b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x70,0xff,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x95,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xb4,0xff,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x94,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xf0,0xff,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x93,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x2c,0x00,0x01,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x92,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x68,0x00,0x01,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x91,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xd4,0x00,0x01,0x00,0x20,0x01,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x00,0x01,0x00,0x25,0x00,0x00,0x00,0xb8,0x00,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x8d,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x40,0x01,0x01,0x00,0x20,0x01,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0x01,0x01,0x00,0x25,0x00,0x00,0x00,0x24,0x01,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x60,0x01,0x01,0x00,0x13,0x00,0x00,0x00,0x58,0x0a,0x01,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x3c,0x03,0x00,0x00,0xf7,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xc0,0x01,0x01,0x00,0x3c,0x03,0x00,0x00,0xf7,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xb4,0x01,0x01,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xc4,0x01,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xc4,0x01,0x01,0x00,0x0a,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x58,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x25,0x00,0x00,0x00,0x04,0x02,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0x02,0x01,0x00,0x25,0x00,0x00,0x00,0x3c,0x02,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0xfc,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x74,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xa8,0x02,0x01,0x00,0x3c,0x03,0x00,0x00,0x74,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x9c,0x02,0x01,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xac,0x02,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xac,0x02,0x01,0x00,0x0a,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x40,0x03,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe8,0x02,0x01,0x00,0x25,0x00,0x00,0x00,0xec,0x02,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0x03,0x01,0x00,0x25,0x00,0x00,0x00,0x24,0x03,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0xfd,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x6c,0x03,0x01,0x00,0x25,0x00,0x00,0x00,0x70,0x03,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x34,0x04,0x01,0x00,0x3c,0x03,0x00,0x00,0xa8,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x28,0x04,0x01,0x00,0x01,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xcc,0x03,0x01,0x00,0x25,0x00,0x00,0x00,0xc0,0x03,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xd0,0x03,0x01,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0x03,0x01,0x00,0x25,0x00,0x00,0x00,0x00,0x04,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x1c,0x04,0x01,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x38,0x04,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x38,0x04,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x38,0x04,0x01,0x00,0x0a,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x38,0x05,0x01,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x04,0x01,0x00,0x25,0x00,0x00,0x00,0x84,0x04,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xb0,0x04,0x01,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x04,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xb4,0x04,0x01,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0x04,0x01,0x00,0x25,0x00,0x00,0x00,0xe4,0x04,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x05,0x01,0x00,0x25,0x00,0x00,0x00,0x1c,0x05,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0xfe,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x05,0x01,0x00,0x25,0x00,0x00,0x00,0x68,0x05,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x2c,0x06,0x01,0x00,0x3c,0x03,0x00,0x00,0x62,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x20,0x06,0x01,0x00,0x01,0x02,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0x05,0x01,0x00,0x25,0x00,0x00,0x00,0xb8,0x05,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xc8,0x05,0x01,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0x05,0x01,0x00,0x25,0x00,0x00,0x00,0xf8,0x05,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x14,0x06,0x01,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x30,0x06,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x30,0x06,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x30,0x06,0x01,0x00,0x0a,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x68,0x07,0x01,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x78,0x06,0x01,0x00,0x25,0x00,0x00,0x00,0x7c,0x06,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xa8,0x06,0x01,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x9c,0x06,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xac,0x06,0x01,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0x06,0x01,0x00,0x25,0x00,0x00,0x00,0xdc,0x06,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x07,0x01,0x00,0x25,0x00,0x00,0x00,0x14,0x07,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x07,0x01,0x00,0x25,0x00,0x00,0x00,0x4c,0x07,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0xff,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x3c,0x03,0x00,0x00,0xb0,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x08,0x09,0x01,0x00,0x01,0x02,0x00,0x00,0x3c,0x03,0x00,0x00,0x6a,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0x07,0x01,0x00,0x25,0x00,0x00,0x00,0xc0,0x07,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xfc,0x08,0x01,0x00,0x3c,0x03,0x00,0x00,0xdf,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xf0,0x08,0x01,0x00,0x20,0x02,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x08,0x01,0x00,0x25,0x00,0x00,0x00,0x1c,0x08,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x44,0x08,0x01,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x48,0x08,0x01,0x00,0x05,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xe4,0x08,0x01,0x00,0x3c,0x03,0x00,0x00,0xe2,0x00,0x00,0x00,0x20,0x03,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x88,0x08,0x01,0x00,0x25,0x00,0x00,0x00,0x8c,0x08,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xb4,0x08,0x01,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb8,0x08,0x01,0x00,0x05,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x02,0x03,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xd8,0x08,0x01,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0x09,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0x09,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0x09,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0x09,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x0c,0x09,0x01,0x00,0x0a,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xa4,0x09,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0x09,0x01,0x00,0x25,0x00,0x00,0x00,0x50,0x09,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0x09,0x01,0x00,0x25,0x00,0x00,0x00,0x88,0x09,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0xe4,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xf4,0x09,0x01,0x00,0x3c,0x03,0x00,0x00,0xe5,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xe8,0x09,0x01,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xf8,0x09,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xf8,0x09,0x01,0x00,0x0a,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x50,0x0a,0x01,0x00,0x20,0x01,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0x0a,0x01,0x00,0x25,0x00,0x00,0x00,0x34,0x0a,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x01,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x70,0x0a,0x01,0x00,0x13,0x00,0x00,0x00,0x28,0x0d,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x20,0x0b,0x01,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x14,0x0b,0x01,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x08,0x0b,0x01,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0x0a,0x01,0x00,0x25,0x00,0x00,0x00,0xe4,0x0a,0x01,0x00,0x05,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xfc,0x0a,0x01,0x00,0x09,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0x0b,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0x0b,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0x0b,0x01,0x00,0x0a,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x24,0x0b,0x01,0x00,0x0a,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xc0,0x0c,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x5c,0x0b,0x01,0x00,0x25,0x00,0x00,0x00,0x60,0x0b,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0x0b,0x01,0x00,0x25,0x00,0x00,0x00,0x98,0x0b,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xb4,0x0b,0x01,0x00,0x13,0x00,0x00,0x00,0xac,0x0c,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x50,0x0c,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x0b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x25,0x00,0x00,0x00,0x04,0x0c,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x18,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0x0c,0x01,0x00,0x25,0x00,0x00,0x00,0x2c,0x0c,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x3c,0x0c,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x90,0x0c,0x01,0x00,0x25,0x00,0x00,0x00,0x84,0x0c,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x94,0x0c,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb8,0x0c,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x20,0x0d,0x01,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0x0d,0x01,0x00,0x25,0x00,0x00,0x00,0xfc,0x0c,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x0c,0x0d,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x28,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x54,0x0d,0x01,0x00,0x25,0x00,0x00,0x00,0x58,0x0d,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2a,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x7c,0x0d,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xb3,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xa4,0x0d,0x01,0x00,0x13,0x00,0x00,0x00,0x94,0x13,0x01,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2a,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x72,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd4,0x0d,0x01,0x00,0x25,0x00,0x00,0x00,0xd8,0x0d,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xaa,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x0e,0x01,0x00,0x25,0x00,0x00,0x00,0x14,0x0e,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x3c,0x0e,0x01,0x00,0x2e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x30,0x0e,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x40,0x0e,0x01,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x39,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xfc,0x0e,0x01,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xfb,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0x0e,0x01,0x00,0x25,0x00,0x00,0x00,0xc8,0x0e,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x0e,0x01,0x00,0x25,0x00,0x00,0x00,0x80,0x10,0x01,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x80,0x10,0x01,0x00,0x27,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x14,0x0f,0x01,0x00,0x26,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x80,0x10,0x01,0x00,0x20,0x02,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x74,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x74,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x0f,0x01,0x00,0x25,0x00,0x00,0x00,0xa8,0x0f,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xf7,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xf7,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x50,0x10,0x01,0x00,0x25,0x00,0x00,0x00,0x54,0x10,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xa4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x7c,0x10,0x01,0x00,0x25,0x00,0x00,0x00,0x80,0x10,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x10,0x01,0x00,0x25,0x00,0x00,0x00,0xa8,0x10,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xc4,0x10,0x01,0x00,0x13,0x00,0x00,0x00,0x80,0x13,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xf4,0x10,0x01,0x00,0x13,0x00,0x00,0x00,0xd4,0x11,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x3b,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x20,0x11,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x2c,0x04,0x00,0x00,0xab,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x50,0x11,0x01,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0x11,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x88,0x11,0x01,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xac,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x11,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x3c,0x03,0x00,0x00,0x42,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xcc,0x11,0x01,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xad,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0x11,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0x11,0x01,0x00,0x25,0x00,0x00,0x00,0xf8,0x11,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0x12,0x01,0x00,0x25,0x00,0x00,0x00,0x34,0x12,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb2,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x6c,0x12,0x01,0x00,0x25,0x00,0x00,0x00,0x70,0x12,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x98,0x12,0x01,0x00,0x13,0x00,0x00,0x00,0x10,0x13,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x04,0x13,0x01,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb1,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0x12,0x01,0x00,0x25,0x00,0x00,0x00,0xe4,0x12,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0xfc,0x12,0x01,0x00,0x61,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x3b,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x3c,0x13,0x01,0x00,0x25,0x00,0x00,0x00,0x30,0x13,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x40,0x13,0x01,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x68,0x13,0x01,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0x13,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2f,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0x13,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xb4,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xb4,0x13,0x01,0x00,0x13,0x00,0x00,0x00,0xec,0x13,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe4,0x13,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xb5,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x0c,0x14,0x01,0x00,0x13,0x00,0x00,0x00,0x44,0x14,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2c,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x0b,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x3c,0x14,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xb6,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x64,0x14,0x01,0x00,0x13,0x00,0x00,0x00,0x94,0x15,0x01,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2f,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x2e,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x20,0x02,0x00,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb6,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc0,0x14,0x01,0x00,0x25,0x00,0x00,0x00,0xc4,0x14,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xe0,0x14,0x01,0x00,0x5b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0x14,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0x2d,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x20,0x00,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb5,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x15,0x01,0x00,0x25,0x00,0x00,0x00,0x28,0x15,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x44,0x15,0x01,0x00,0x5b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x48,0x15,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x68,0x15,0x01,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0x15,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0x15,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xb7,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xb4,0x15,0x01,0x00,0x13,0x00,0x00,0x00,0xd0,0x17,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x04,0x00,0x00,0xfd,0xff,0xff,0xff,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xfc,0x15,0x01,0x00,0x58,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x16,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x20,0x16,0x01,0x00,0x13,0x00,0x00,0x00,0xbc,0x17,0x01,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0f,0x04,0x00,0x00,0x3c,0x16,0x01,0x00,0x14,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x7c,0x16,0x01,0x00,0x3a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x70,0x16,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x80,0x16,0x01,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x0b,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x32,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x35,0x04,0x04,0x03,0x02,0x01,0x00,0x00,0x15,0x00,0x00,0x00,0xb4,0x17,0x01,0x00,0x0b,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x32,0x04,0x04,0x03,0x2e,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x32,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x18,0x17,0x01,0x00,0x3b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x0c,0x17,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x1c,0x17,0x01,0x00,0x05,0x03,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x03,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x32,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x5c,0x17,0x01,0x00,0x3b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x60,0x17,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xa0,0x17,0x01,0x00,0x3b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x17,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc8,0x17,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xb8,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x01,0x02,0x00,0x00,0x08,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0xf8,0x17,0x01,0x00,0x13,0x00,0x00,0x00,0x9c,0x29,0x01,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0f,0x04,0x00,0x00,0x18,0x18,0x01,0x00,0x13,0x00,0x00,0x00,0xc0,0x19,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x48,0x01,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xa8,0x18,0x01,0x00,0x20,0x01,0x02,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x74,0x18,0x01,0x00,0x25,0x00,0x00,0x00,0x78,0x18,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x02,0x01,0x00,0x00,0x24,0x00,0x00,0x00,0xa0,0x18,0x01,0x00,0x11,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe0,0x18,0x01,0x00,0x25,0x00,0x00,0x00,0xe4,0x18,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x00,0x19,0x01,0x00,0x13,0x00,0x00,0x00,0xac,0x19,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0x19,0x01,0x00,0x25,0x00,0x00,0x00,0x4c,0x19,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x5c,0x19,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x98,0x19,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x9c,0x19,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb8,0x19,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xd8,0x19,0x01,0x00,0x13,0x00,0x00,0x00,0xb0,0x1c,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x00,0x1a,0x01,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x28,0x1a,0x01,0x00,0x66,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0x1a,0x01,0x00,0x05,0x04,0x00,0x00,0x3b,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x03,0x00,0x00,0x4c,0x1a,0x01,0x00,0x13,0x00,0x00,0x00,0x08,0x1b,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x70,0x1a,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xa0,0x1a,0x01,0x00,0x65,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x1a,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x35,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xc8,0x1a,0x01,0x00,0x13,0x00,0x00,0x00,0xf4,0x1a,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xec,0x1a,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x1b,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x1b,0x01,0x00,0x25,0x00,0x00,0x00,0x1c,0x1b,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x54,0x1b,0x01,0x00,0x3c,0x04,0x00,0x00,0x46,0x01,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0x1b,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x88,0x1b,0x01,0x00,0x25,0x00,0x00,0x00,0x7c,0x1b,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x8c,0x1b,0x01,0x00,0x05,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x45,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x78,0x1c,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x13,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd0,0x1b,0x01,0x00,0x25,0x00,0x00,0x00,0xd4,0x1b,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x1c,0x01,0x00,0x25,0x00,0x00,0x00,0xf8,0x1b,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x08,0x1c,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x20,0x02,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0x1c,0x01,0x00,0x25,0x00,0x00,0x00,0x3c,0x1c,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x64,0x1c,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x1c,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x44,0x01,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa8,0x1c,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xc8,0x1c,0x01,0x00,0x13,0x00,0x00,0x00,0x2c,0x1e,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x43,0x01,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x28,0x1d,0x01,0x00,0x3c,0x04,0x00,0x00,0x42,0x01,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x20,0x1d,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x5c,0x1d,0x01,0x00,0x25,0x00,0x00,0x00,0x60,0x1d,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x7c,0x1d,0x01,0x00,0x13,0x00,0x00,0x00,0x18,0x1e,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xac,0x1d,0x01,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x41,0x01,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe8,0x1d,0x01,0x00,0x25,0x00,0x00,0x00,0xec,0x1d,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xb7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x1e,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x1e,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x44,0x1e,0x01,0x00,0x13,0x00,0x00,0x00,0x5c,0x1f,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x40,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x28,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x32,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0x1e,0x01,0x00,0x25,0x00,0x00,0x00,0x98,0x1e,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xb4,0x1e,0x01,0x00,0x13,0x00,0x00,0x00,0x48,0x1f,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xe8,0x1e,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0x1f,0x01,0x00,0x25,0x00,0x00,0x00,0x24,0x1f,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x34,0x1f,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x54,0x1f,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x74,0x1f,0x01,0x00,0x13,0x00,0x00,0x00,0xdc,0x1f,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3f,0x01,0x00,0x00,0x0b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x35,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xd4,0x1f,0x01,0x00,0x3c,0x04,0x00,0x00,0x3e,0x01,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb7,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xcc,0x1f,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xf4,0x1f,0x01,0x00,0x13,0x00,0x00,0x00,0x58,0x21,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3d,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x28,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x32,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x20,0x01,0x00,0x25,0x00,0x00,0x00,0x4c,0x20,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x70,0x20,0x01,0x00,0x25,0x00,0x00,0x00,0x74,0x20,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x90,0x20,0x01,0x00,0x6e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x94,0x20,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xb0,0x20,0x01,0x00,0x13,0x00,0x00,0x00,0x44,0x21,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xe4,0x20,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0x21,0x01,0x00,0x25,0x00,0x00,0x00,0x20,0x21,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x30,0x21,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x50,0x21,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x70,0x21,0x01,0x00,0x13,0x00,0x00,0x00,0xac,0x22,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3c,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x28,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x32,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0x21,0x01,0x00,0x25,0x00,0x00,0x00,0xc8,0x21,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xe4,0x21,0x01,0x00,0x12,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe8,0x21,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x04,0x22,0x01,0x00,0x13,0x00,0x00,0x00,0x98,0x22,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x38,0x22,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x22,0x01,0x00,0x25,0x00,0x00,0x00,0x74,0x22,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x84,0x22,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x22,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x3b,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xec,0x22,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf0,0x22,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x3a,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x28,0x23,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0x23,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x39,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x68,0x23,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x6c,0x23,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x38,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xa8,0x23,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xac,0x23,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x37,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe8,0x23,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0x23,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x0f,0x04,0x00,0x00,0x0c,0x24,0x01,0x00,0x13,0x00,0x00,0x00,0x6c,0x24,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0x65,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x24,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0x36,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x90,0x24,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x94,0x24,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x0f,0x04,0x00,0x00,0xb4,0x24,0x01,0x00,0x13,0x00,0x00,0x00,0x14,0x25,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0x67,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0x25,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0x35,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x38,0x25,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x25,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x0f,0x04,0x00,0x00,0x5c,0x25,0x01,0x00,0x13,0x00,0x00,0x00,0xbc,0x25,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0x5f,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x25,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0x34,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe0,0x25,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0x25,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x04,0x26,0x01,0x00,0x13,0x00,0x00,0x00,0x64,0x26,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x03,0x04,0x00,0x3c,0x04,0x00,0x00,0x61,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x5c,0x26,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0x33,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x88,0x26,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x8c,0x26,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xac,0x26,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb0,0x26,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xcc,0x26,0x01,0x00,0x6e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0x26,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x07,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0xf0,0x26,0x01,0x00,0x13,0x00,0x00,0x00,0x64,0x27,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x32,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x24,0x27,0x01,0x00,0x09,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x28,0x27,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x58,0x27,0x01,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x50,0x27,0x01,0x00,0x6c,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x78,0x27,0x01,0x00,0x14,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x27,0x01,0x00,0x25,0x00,0x00,0x00,0xa8,0x27,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x28,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x50,0x29,0x01,0x00,0x20,0x01,0x02,0x00,0x28,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xf4,0x27,0x01,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf8,0x27,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x88,0x28,0x01,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x01,0x02,0x00,0x00,0x28,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x68,0x28,0x01,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x5c,0x28,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x6c,0x28,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x28,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xc8,0x28,0x01,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x08,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc0,0x28,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0x29,0x01,0x00,0x25,0x00,0x00,0x00,0xfc,0x28,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x0c,0x29,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x08,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x3c,0x29,0x01,0x00,0x25,0x00,0x00,0x00,0x40,0x29,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x0b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x70,0x29,0x01,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x31,0x01,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x94,0x29,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x29,0x01,0x00,0x25,0x00,0x00,0x00,0xb0,0x29,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0xb9,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xd4,0x29,0x01,0x00,0x13,0x00,0x00,0x00,0x84,0x2c,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4a,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x0c,0x2a,0x01,0x00,0x5a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0x2a,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x03,0x00,0x00,0x2c,0x2a,0x01,0x00,0x13,0x00,0x00,0x00,0xe0,0x2a,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x50,0x2a,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x49,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x80,0x2a,0x01,0x00,0x60,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x84,0x2a,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xa0,0x2a,0x01,0x00,0x13,0x00,0x00,0x00,0xcc,0x2a,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xc4,0x2a,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0x2a,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x2a,0x01,0x00,0x25,0x00,0x00,0x00,0xf4,0x2a,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xb8,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x2b,0x01,0x00,0x25,0x00,0x00,0x00,0x1c,0x2b,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x38,0x2b,0x01,0x00,0x13,0x00,0x00,0x00,0x70,0x2c,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0f,0x04,0x00,0x00,0x58,0x2b,0x01,0x00,0x13,0x00,0x00,0x00,0x08,0x2c,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x2c,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x2b,0x01,0x00,0x25,0x00,0x00,0x00,0xb8,0x2b,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe8,0x2b,0x01,0x00,0x25,0x00,0x00,0x00,0xdc,0x2b,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xec,0x2b,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x48,0x2c,0x01,0x00,0x25,0x00,0x00,0x00,0x4c,0x2c,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0x2c,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x7c,0x2c,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xba,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xa4,0x2c,0x01,0x00,0x13,0x00,0x00,0x00,0x48,0x2e,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4b,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb8,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x2c,0x01,0x00,0x25,0x00,0x00,0x00,0xe0,0x2c,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xfc,0x2c,0x01,0x00,0x13,0x00,0x00,0x00,0x34,0x2e,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0f,0x04,0x00,0x00,0x1c,0x2d,0x01,0x00,0x13,0x00,0x00,0x00,0xcc,0x2d,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xc4,0x2d,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x78,0x2d,0x01,0x00,0x25,0x00,0x00,0x00,0x7c,0x2d,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x2d,0x01,0x00,0x25,0x00,0x00,0x00,0xa0,0x2d,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xb0,0x2d,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0x2e,0x01,0x00,0x25,0x00,0x00,0x00,0x10,0x2e,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x2c,0x2e,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0x2e,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xbb,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x68,0x2e,0x01,0x00,0x13,0x00,0x00,0x00,0x00,0x34,0x01,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x4c,0x01,0x00,0x00,0x28,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x2f,0x04,0x00,0x00,0x3e,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xaa,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x2e,0x01,0x00,0x25,0x00,0x00,0x00,0xb8,0x2e,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2f,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x08,0x04,0x00,0x00,0x2f,0x04,0x00,0x00,0x3b,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x04,0x00,0x00,0x3c,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x2f,0x01,0x00,0x3f,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0x2f,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2f,0x04,0x00,0x00,0x3d,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x2c,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x38,0x2f,0x01,0x00,0x2e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x2f,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2f,0x04,0x00,0x00,0x39,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x28,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x78,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x84,0x2f,0x01,0x00,0x25,0x00,0x00,0x00,0x88,0x2f,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x09,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x28,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x74,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x2f,0x01,0x00,0x25,0x00,0x00,0x00,0xe0,0x2f,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xf9,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0x30,0x01,0x00,0x25,0x00,0x00,0x00,0x3c,0x30,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xb4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x64,0x30,0x01,0x00,0x25,0x00,0x00,0x00,0x68,0x30,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x8c,0x30,0x01,0x00,0x13,0x00,0x00,0x00,0x38,0x31,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x0a,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x7e,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0x31,0x01,0x00,0x25,0x00,0x00,0x00,0x0c,0x31,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xb4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x30,0x31,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x17,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0x31,0x01,0x00,0x25,0x00,0x00,0x00,0x5c,0x31,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x09,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xf8,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x9c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x31,0x01,0x00,0x25,0x00,0x00,0x00,0xe0,0x31,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2c,0x03,0x00,0x00,0xb4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0x32,0x01,0x00,0x25,0x00,0x00,0x00,0x0c,0x32,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x38,0x32,0x01,0x00,0x2e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x32,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x03,0x00,0x00,0x58,0x32,0x01,0x00,0x13,0x00,0x00,0x00,0x9c,0x33,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xae,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x8c,0x32,0x01,0x00,0x25,0x00,0x00,0x00,0x90,0x32,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x01,0x02,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xaa,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd8,0x32,0x01,0x00,0x25,0x00,0x00,0x00,0xdc,0x32,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xf8,0x32,0x01,0x00,0x2e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xfc,0x32,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x28,0x33,0x01,0x00,0x36,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2c,0x33,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xaa,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x60,0x33,0x01,0x00,0x25,0x00,0x00,0x00,0x64,0x33,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x84,0x33,0x01,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0x33,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2f,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x33,0x01,0x00,0x25,0x00,0x00,0x00,0xb0,0x33,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x08,0x03,0x00,0x00,0x08,0x04,0x00,0x00,0x04,0x03,0x04,0x03,0x28,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x04,0x03,0x04,0x03,0x2c,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xf8,0x33,0x01,0x00,0x12,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xbc,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x20,0x34,0x01,0x00,0x13,0x00,0x00,0x00,0xb8,0x36,0x01,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x51,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xbe,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x7c,0x34,0x01,0x00,0x25,0x00,0x00,0x00,0x80,0x34,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xb0,0x34,0x01,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x13,0x00,0x00,0x00,0xb4,0x34,0x01,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xbc,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd4,0x34,0x01,0x00,0x25,0x00,0x00,0x00,0xd8,0x34,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xf8,0x34,0x01,0x00,0x3b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xfc,0x34,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x18,0x35,0x01,0x00,0x13,0x00,0x00,0x00,0xa4,0x36,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x9c,0x35,0x01,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x64,0x35,0x01,0x00,0x9f,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x35,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0x50,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x90,0x35,0x01,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x35,0x01,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xa4,0x35,0x01,0x00,0x3c,0x04,0x00,0x00,0x3b,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0x4f,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x20,0x02,0x00,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xe0,0x35,0x01,0x00,0x2e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0x35,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x36,0x01,0x00,0x5b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0x36,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0x4e,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x40,0x36,0x01,0x00,0x7f,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0x36,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x3c,0x04,0x00,0x00,0x4d,0x01,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x70,0x36,0x01,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x74,0x36,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x24,0x00,0x00,0x00,0x9c,0x36,0x01,0x00,0x7e,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0x36,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xbd,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xd8,0x36,0x01,0x00,0x13,0x00,0x00,0x00,0xe0,0x38,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x52,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x3a,0x04,0x04,0x00,0x3b,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x24,0x37,0x01,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xba,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1c,0x37,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x64,0x37,0x01,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xba,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x5c,0x37,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x20,0x02,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2c,0x04,0x00,0x00,0xba,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x37,0x01,0x00,0x25,0x00,0x00,0x00,0xb0,0x37,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xcc,0x37,0x01,0x00,0x74,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0x37,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xf4,0x37,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf8,0x37,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x18,0x38,0x01,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x1c,0x38,0x01,0x00,0x05,0x04,0x00,0x00,0x07,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x38,0x38,0x01,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x38,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xba,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x74,0x38,0x01,0x00,0x25,0x00,0x00,0x00,0x78,0x38,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x94,0x38,0x01,0x00,0x64,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x98,0x38,0x01,0x00,0x05,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xb8,0x38,0x01,0x00,0x64,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0x38,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0xd8,0x38,0x01,0x00,0x63,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xbe,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x00,0x39,0x01,0x00,0x13,0x00,0x00,0x00,0xb4,0x39,0x01,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x54,0x01,0x00,0x00,0x08,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x20,0x02,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x53,0x01,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xbc,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x68,0x39,0x01,0x00,0x25,0x00,0x00,0x00,0x6c,0x39,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x94,0x39,0x01,0x00,0x62,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0x39,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x98,0x39,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x39,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xbf,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xd4,0x39,0x01,0x00,0x13,0x00,0x00,0x00,0xa8,0x3a,0x01,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x55,0x01,0x00,0x00,0x08,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x20,0x02,0x02,0x00,0x27,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xba,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x3a,0x01,0x00,0x25,0x00,0x00,0x00,0x28,0x3a,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xbc,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x5c,0x3a,0x01,0x00,0x25,0x00,0x00,0x00,0x60,0x3a,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x88,0x3a,0x01,0x00,0x62,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0x3a,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x8c,0x3a,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa0,0x3a,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xc0,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xc8,0x3a,0x01,0x00,0x13,0x00,0x00,0x00,0x30,0x3b,0x01,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0x01,0x00,0x00,0x08,0x03,0x00,0x00,0x08,0x04,0x00,0x00,0x04,0x03,0x04,0x03,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x14,0x3b,0x01,0x00,0x6e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x08,0x3b,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x18,0x3b,0x01,0x00,0x05,0x03,0x00,0x00,0x08,0x04,0x00,0x00,0x04,0x04,0x04,0x03,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xc1,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x01,0x02,0x00,0x00,0x07,0x03,0x02,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xba,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x4a,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x80,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x9d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x67,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x82,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x26,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x28,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x19,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x1b,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x0f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x11,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x0e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x10,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7b,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x32,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x34,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x81,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa6,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x23,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x5b,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x81,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x79,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x8b,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x75,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x85,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x10,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xa4,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x0e,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x72,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x82,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x64,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x80,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x11,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x7e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x9b,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x5a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7f,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x92,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd9,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x56,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7e,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x68,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7d,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x54,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7c,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x4e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x49,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x2d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x2f,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x1d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x1f,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x50,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7b,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x87,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xb6,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x85,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xb1,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x58,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7a,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x3f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x79,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x91,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xd8,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x37,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x39,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xa1,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x09,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x63,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x69,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x18,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x78,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x8a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xc4,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x78,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x99,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x77,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x6d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x0a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x0c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x2c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x2e,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x41,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x3d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xbd,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x51,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x0b,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x97,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x76,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x47,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x75,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x30,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x32,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xc3,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x74,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x81,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x7f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x9c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x21,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x23,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x17,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x9c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x04,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x42,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x3e,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xc2,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x73,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x49,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x41,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x43,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x3f,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x6f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x80,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x1e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x20,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x72,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x18,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x1a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x07,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x09,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x5e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x4f,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x5d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x4c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x4d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x47,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x1b,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x1d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xaa,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x14,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x44,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x71,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x0d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x0f,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x27,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x2f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x31,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x4b,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x45,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x71,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x70,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x17,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x19,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x77,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x89,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xb5,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x2b,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xb2,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x25,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x89,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xb9,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x0c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x0e,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x9a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6f,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x8a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xbb,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x96,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xea,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x83,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xab,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x69,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x79,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x36,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x38,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xaf,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x1a,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xa6,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x10,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xa2,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x0a,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x9b,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6e,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x3c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6d,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xb8,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x30,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x5c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6c,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x76,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x86,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x20,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x22,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x84,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xaf,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xc1,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x56,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x33,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x35,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x22,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x24,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x7a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x97,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x2b,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x2d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6b,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xa5,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x0f,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x73,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x83,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x82,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xa9,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x38,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x3a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xb9,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x6a,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xb3,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x29,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xa8,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x12,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x93,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xda,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x46,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x69,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x2e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x30,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x39,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x68,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x88,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xb7,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xae,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x19,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x9f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x07,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x3b,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x67,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x0a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x8b,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xc0,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x8c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xc2,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x8e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xc4,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xb4,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x2a,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x57,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x66,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x65,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xbb,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x4b,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x7c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x64,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x63,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x86,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xb2,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x7d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x62,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x2a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x2c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x29,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x2b,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xbe,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x52,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x60,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x57,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x6b,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x61,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xbf,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x54,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x90,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x60,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x51,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x5f,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x35,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x37,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x27,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x29,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xb1,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x20,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xab,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x5e,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x45,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x5d,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x3d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x5c,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xa0,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x08,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x65,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x72,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x4a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x43,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x3e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x5b,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x8d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xc3,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x1c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x1e,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xac,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x17,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x31,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x33,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x1f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x21,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x0b,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x0d,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x28,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x2a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xc0,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x55,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x61,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x5e,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x53,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x4b,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x98,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xf4,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x55,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x5a,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x62,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x60,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x95,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xde,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x94,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xdb,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x59,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x59,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x24,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x26,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xbc,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x4c,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xad,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x18,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x5f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x53,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x66,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x76,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x6e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x7f,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x7b,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x98,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x8f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0xc5,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xb7,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x2f,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xa9,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x58,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x9e,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x06,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x40,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x3c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xb0,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x1c,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xa7,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x11,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x52,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x4a,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x1a,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x1c,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x4f,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x57,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x4c,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x46,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x74,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x84,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xb6,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x2c,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x9d,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x05,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0xa3,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x0b,0x01,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x48,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x40,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x03,0x04,0x03,0x01,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x34,0x00,0x00,0x00,0x04,0x03,0x04,0x03,0x3c,0x04,0x00,0x00,0x36,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x3c,0x5a,0x01,0x00,0x6e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x30,0x5a,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x40,0x5a,0x01,0x00,0x05,0x03,0x00,0x00,0x08,0x04,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0xc2,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x74,0x5a,0x01,0x00,0x13,0x00,0x00,0x00,0xc4,0x5c,0x01,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x74,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0x94,0x5a,0x01,0x00,0x13,0x00,0x00,0x00,0x38,0x5b,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x84,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xbc,0x5a,0x01,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xec,0x5a,0x01,0x00,0x72,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe0,0x5a,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xf0,0x5a,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x5b,0x01,0x00,0x25,0x00,0x00,0x00,0x28,0x5b,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x50,0x5b,0x01,0x00,0x13,0x00,0x00,0x00,0x38,0x5c,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x83,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x39,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x78,0x5b,0x01,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xa0,0x5b,0x01,0x00,0x0a,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x5b,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0xe8,0x5b,0x01,0x00,0x26,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xdc,0x5b,0x01,0x00,0x73,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0x5b,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xf0,0x5b,0x01,0x00,0x05,0x03,0x00,0x00,0x13,0x00,0x00,0x00,0xf0,0x5b,0x01,0x00,0x26,0x04,0x00,0x00,0x38,0x03,0x04,0x00,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x5c,0x01,0x00,0x25,0x00,0x00,0x00,0x28,0x5c,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x2c,0x04,0x00,0x00,0xc2,0x00,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x78,0x5c,0x01,0x00,0x25,0x00,0x00,0x00,0x6c,0x5c,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x7c,0x5c,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x00,0x00,0x2c,0x04,0x00,0x00,0xc2,0x00,0x00,0x00,0x37,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0xb0,0x5c,0x01,0x00,0x25,0x00,0x00,0x00,0xb4,0x5c,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x02,0x03,0x00,0x00,0x04,0x04,0x04,0x03,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xc3,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0xe4,0x5c,0x01,0x00,0x13,0x00,0x00,0x00,0x74,0x67,0x01,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x78,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xc3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0x5d,0x01,0x00,0x25,0x00,0x00,0x00,0x18,0x5d,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x0f,0x04,0x00,0x00,0x38,0x5d,0x01,0x00,0x13,0x00,0x00,0x00,0xc0,0x5d,0x01,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0x94,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x78,0x5d,0x01,0x00,0x95,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x7c,0x5d,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x9c,0x5d,0x01,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa0,0x5d,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0xb8,0x5d,0x01,0x00,0x54,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0xd8,0x5d,0x01,0x00,0x13,0x00,0x00,0x00,0x48,0x64,0x01,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4b,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x93,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x0c,0x5e,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x10,0x5e,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x24,0x5e,0x01,0x00,0x13,0x00,0x00,0x00,0x18,0x64,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x92,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x50,0x5e,0x01,0x00,0x91,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0x5e,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x94,0x5e,0x01,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x98,0x5e,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xd8,0x5e,0x01,0x00,0x2e,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xcc,0x5e,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xdc,0x5e,0x01,0x00,0x05,0x03,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x04,0x04,0x03,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xfc,0x5e,0x01,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x27,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x91,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x48,0x5f,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x90,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x38,0x5f,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x5f,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x28,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x8f,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xcc,0x5f,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x8e,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x84,0x5f,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x88,0x5f,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xc3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xac,0x5f,0x01,0x00,0x25,0x00,0x00,0x00,0xb0,0x5f,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x19,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x28,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x8d,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x4c,0x61,0x01,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0x60,0x01,0x00,0x25,0x00,0x00,0x00,0x0c,0x60,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x8c,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x34,0x60,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x38,0x60,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x8b,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x60,0x60,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x64,0x60,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x50,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x8c,0x60,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x90,0x60,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x8a,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xb8,0x60,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xbc,0x60,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x89,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe4,0x60,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe8,0x60,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x88,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x10,0x61,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0x61,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x87,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x3c,0x61,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0x61,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0f,0x04,0x00,0x00,0x60,0x61,0x01,0x00,0x13,0x00,0x00,0x00,0x08,0x63,0x01,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb8,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x9c,0x61,0x01,0x00,0x25,0x00,0x00,0x00,0xa0,0x61,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0xbc,0x61,0x01,0x00,0x13,0x00,0x00,0x00,0xf4,0x62,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x0f,0x04,0x00,0x00,0xdc,0x61,0x01,0x00,0x13,0x00,0x00,0x00,0x8c,0x62,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x84,0x62,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x38,0x62,0x01,0x00,0x25,0x00,0x00,0x00,0x3c,0x62,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x2b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x6c,0x62,0x01,0x00,0x25,0x00,0x00,0x00,0x60,0x62,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0x70,0x62,0x01,0x00,0x05,0x03,0x00,0x00,0x21,0x02,0x01,0x00,0x23,0x04,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x0b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xb9,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xcc,0x62,0x01,0x00,0x25,0x00,0x00,0x00,0xd0,0x62,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0xec,0x62,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x63,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x28,0x63,0x01,0x00,0x25,0x00,0x00,0x00,0x2c,0x63,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x48,0x63,0x01,0x00,0x13,0x00,0x00,0x00,0x04,0x64,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x31,0x01,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x90,0x63,0x01,0x00,0x25,0x00,0x00,0x00,0x94,0x63,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xfc,0x63,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x86,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xc4,0x63,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc8,0x63,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf4,0x63,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x64,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x3b,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x40,0x64,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x27,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x6c,0x64,0x01,0x00,0x25,0x00,0x00,0x00,0x70,0x64,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x04,0x00,0x00,0x84,0x64,0x01,0x00,0x13,0x00,0x00,0x00,0x50,0x67,0x01,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xb4,0x64,0x01,0x00,0x25,0x00,0x00,0x00,0xb8,0x64,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2d,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x2c,0x67,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x65,0x01,0x00,0x25,0x00,0x00,0x00,0x04,0x65,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x40,0x65,0x01,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x34,0x65,0x01,0x00,0x25,0x00,0x00,0x00,0x08,0x67,0x01,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0x08,0x67,0x01,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x0f,0x04,0x00,0x00,0x5c,0x65,0x01,0x00,0x13,0x00,0x00,0x00,0xe4,0x66,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x0f,0x04,0x00,0x00,0x80,0x65,0x01,0x00,0x13,0x00,0x00,0x00,0xd0,0x65,0x01,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x18,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xbf,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc8,0x65,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xf0,0x65,0x01,0x00,0x25,0x00,0x00,0x00,0xf4,0x65,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x0f,0x03,0x00,0x00,0x10,0x66,0x01,0x00,0x13,0x00,0x00,0x00,0xd0,0x66,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x4c,0x66,0x01,0x00,0x25,0x00,0x00,0x00,0x50,0x66,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x15,0x00,0x00,0x00,0x8c,0x66,0x01,0x00,0x26,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x66,0x01,0x00,0x25,0x00,0x00,0x00,0xb0,0x66,0x01,0x00,0x05,0x04,0x00,0x00,0x13,0x00,0x00,0x00,0xb0,0x66,0x01,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xac,0x66,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xb0,0x66,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xc8,0x66,0x01,0x00,0x55,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x66,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x17,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x67,0x01,0x00,0x25,0x00,0x00,0x00,0x08,0x67,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x08,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x67,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0x85,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x48,0x67,0x01,0x00,0x54,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x29,0x03,0x00,0x00,0x12,0x00,0x00,0x00,0x6c,0x67,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2d,0x04,0x00,0x00,0xc4,0x00,0x00,0x00,0x21,0x01,0x02,0x00,0x20,0x02,0x01,0x00,0x09,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x05,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x00,0x68,0x01,0x00,0x13,0x00,0x00,0x00,0x4c,0x74,0x01,0x00,0x16,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x01,0x02,0x00,0x20,0x02,0x02,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x30,0x68,0x01,0x00,0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x34,0x68,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x50,0x68,0x01,0x00,0x3d,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x54,0x68,0x01,0x00,0x05,0x04,0x00,0x00,0x38,0x04,0x04,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x0f,0x04,0x00,0x00,0x74,0x68,0x01,0x00,0x13,0x00,0x00,0x00,0x54,0x6e,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x2b,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x3b,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xa8,0x68,0x01,0x00,0x26,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x3b,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0xcc,0x68,0x01,0x00,0x26,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x2b,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x3b,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x10,0x69,0x01,0x00,0x26,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x08,0x69,0x01,0x00,0xa3,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xb5,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x3c,0x69,0x01,0x00,0x13,0x00,0x00,0x00,0xcc,0x69,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x60,0x69,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xb4,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x8c,0x69,0x01,0x00,0x13,0x00,0x00,0x00,0xb8,0x69,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xb0,0x69,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0x69,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xdc,0x69,0x01,0x00,0x25,0x00,0x00,0x00,0xe0,0x69,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x08,0x6a,0x01,0x00,0x0a,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xb3,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x48,0x6a,0x01,0x00,0x0a,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x07,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xb2,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x74,0x6a,0x01,0x00,0x13,0x00,0x00,0x00,0x04,0x6b,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x98,0x6a,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xb1,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0xc4,0x6a,0x01,0x00,0x13,0x00,0x00,0x00,0xf0,0x6a,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xe8,0x6a,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xfc,0x6a,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0x6b,0x01,0x00,0x25,0x00,0x00,0x00,0x18,0x6b,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x34,0x6b,0x01,0x00,0x0a,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xb0,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x60,0x6b,0x01,0x00,0x13,0x00,0x00,0x00,0xf0,0x6b,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x84,0x6b,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xaf,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0xb0,0x6b,0x01,0x00,0x13,0x00,0x00,0x00,0xdc,0x6b,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0xd4,0x6b,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe8,0x6b,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x6c,0x01,0x00,0x25,0x00,0x00,0x00,0x04,0x6c,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x20,0x6c,0x01,0x00,0x09,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xae,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x58,0x6c,0x01,0x00,0x09,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x50,0x6c,0x01,0x00,0x9e,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xad,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0x80,0x6c,0x01,0x00,0x0a,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xac,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xb8,0x6c,0x01,0x00,0x09,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xb0,0x6c,0x01,0x00,0xa1,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xab,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x15,0x00,0x00,0x00,0xf0,0x6c,0x01,0x00,0x09,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe8,0x6c,0x01,0x00,0xa0,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x26,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0xaa,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x1c,0x6d,0x01,0x00,0x13,0x00,0x00,0x00,0xac,0x6d,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x40,0x6d,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x04,0x00,0x00,0xa9,0x01,0x00,0x00,0x36,0x04,0x04,0x03,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,0x6c,0x6d,0x01,0x00,0x13,0x00,0x00,0x00,0x98,0x6d,0x01,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x26,0x04,0x00,0x00,0x15,0x00,0x00,0x00,0x90,0x6d,0x01,0x00,0x26,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x6d,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xbc,0x6d,0x01,0x00,0x25,0x00,0x00,0x00,0xc0,0x6d,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0xdc,0x6d,0x01,0x00,0x09,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x2e,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x10,0x6e,0x01,0x00,0x11,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x14,0x6e,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x23,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x3c,0x6e,0x01,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x40,0x6e,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x02,0x00,0x00,0x2e,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x14,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0x17,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x74,0x6e,0x01,0x00,0x25,0x00,0x00,0x00,0x78,0x6e,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x2a,0x04,0x00,0x00,0x05,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x04,0x6f,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x3c,0x04,0x00,0x00,0xa8,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0xbc,0x6e,0x01,0x00,0x95,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0x6e,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xe0,0x6e,0x01,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe4,0x6e,0x01,0x00,0x05,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x21,0x02,0x01,0x00,0x24,0x00,0x00,0x00,0xfc,0x6e,0x01,0x00,0x54,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2a,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x24,0x72,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0xa7,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x38,0x6f,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x3c,0x6f,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0xa6,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x64,0x6f,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x68,0x6f,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0xa5,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x90,0x6f,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x94,0x6f,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0xa4,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xbc,0x6f,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc0,0x6f,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0xa3,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xe8,0x6f,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xec,0x6f,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0xa2,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x14,0x70,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x18,0x70,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0xa1,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x40,0x70,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x44,0x70,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0xa0,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x6c,0x70,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x70,0x70,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x9f,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x98,0x70,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x9c,0x70,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x9e,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xc4,0x70,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xc8,0x70,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x9d,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xf0,0x70,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xf4,0x70,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x9c,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x1c,0x71,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x20,0x71,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x9b,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x48,0x71,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x71,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x9a,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x74,0x71,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x78,0x71,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x99,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xa0,0x71,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xa4,0x71,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x98,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xcc,0x71,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xd0,0x71,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x20,0x01,0x02,0x00,0x3c,0x04,0x00,0x00,0x97,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0xf8,0x71,0x01,0x00,0x54,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xfc,0x71,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x02,0x01,0x00,0x3c,0x04,0x00,0x00,0x96,0x01,0x00,0x00,0x03,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x1c,0x72,0x01,0x00,0x54,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x48,0x72,0x01,0x00,0x01,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x4c,0x72,0x01,0x00,0x05,0x04,0x00,0x00,0x3b,0x04,0x04,0x00,0x21,0x02,0x01,0x00,0x15,0x00,0x00,0x00,0x30,0x73,0x01,0x00,0x20,0x01,0x02,0x00,0x01,0x02,0x00,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xc3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x80,0x72,0x01,0x00,0x25,0x00,0x00,0x00,0x84,0x72,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x02,0x00,0x08,0x04,0x00,0x00,0x03,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xbb,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xc4,0x72,0x01,0x00,0x25,0x00,0x00,0x00,0xc8,0x72,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x02,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0xf4,0x72,0x01,0x00,0x63,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xe8,0x72,0x01,0x00,0x07,0x03,0x04,0x00,0x13,0x00,0x00,0x00,0xf8,0x72,0x01,0x00,0x05,0x03,0x00,0x00,0x3c,0x04,0x00,0x00,0x48,0x00,0x00,0x00,0x04,0x04,0x04,0x03,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x01,0x00,0x2c,0x03,0x00,0x00,0xbf,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x28,0x73,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x26,0x04,0x00,0x00,0x3b,0x04,0x04,0x00,0x15,0x00,0x00,0x00,0x60,0x73,0x01,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xc4,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x58,0x73,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x2a,0x04,0x00,0x00,0x06,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0xf0,0x73,0x01,0x00,0x01,0x01,0x00,0x00,0x2a,0x04,0x00,0x00,0x07,0x00,0x00,0x00,0x30,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xc1,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xa4,0x73,0x01,0x00,0x25,0x00,0x00,0x00,0xa8,0x73,0x01,0x00,0x05,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x29,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x27,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xbd,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xe8,0x73,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x20,0x01,0x02,0x00,0x08,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xc3,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x10,0x74,0x01,0x00,0x25,0x00,0x00,0x00,0x14,0x74,0x01,0x00,0x05,0x04,0x00,0x00,0x30,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x31,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x2c,0x03,0x00,0x00,0xc0,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x44,0x74,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x14,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x5c,0x74,0x01,0x00,0x25,0x00,0x00,0x00,0x60,0x74,0x01,0x00,0x05,0x04,0x00,0x00,0x21,0x01,0x02,0x00,0x14,0x00,0x00,0x00,0xb6,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x63,0x61,0x74,0x63,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x4e,0x6f,0x20,0x63,0x61,0x74,0x63,0x68,0x2c,0x20,0x70,0x6c,0x65,0x61,0x73,0x65,0x20,0x69,0x6e,0x73,0x65,0x72,0x74,0x20,0x63,0x6f,0x69,0x6e,0x20,0x61,0x6e,0x64,0x20,0x70,0x6c,0x61,0x79,0x20,0x61,0x67,0x61,0x69,0x6e,0x2e,0x0a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x74,0x68,0x72,0x6f,0x77,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x45,0x52,0x52,0x4f,0x52,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x65,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x65,0x72,0x72,0x6f,0x72,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x2d,0x2d,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x65,0x72,0x72,0x6f,0x72,0x2d,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x77,0x65,0x72,0x72,0x6f,0x72,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x63,0x61,0x61,0x72,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x63,0x61,0x64,0x72,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x63,0x64,0x61,0x72,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x63,0x64,0x64,0x72,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x63,0x61,0x61,0x61,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x63,0x61,0x61,0x64,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x63,0x61,0x64,0x61,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x63,0x64,0x61,0x61,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x63,0x61,0x64,0x64,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x63,0x64,0x61,0x64,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x63,0x64,0x64,0x61,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x63,0x64,0x64,0x64,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x63,0x61,0x64,0x64,0x64,0x72,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x63,0x61,0x64,0x61,0x64,0x72,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x6d,0x61,0x70,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x66,0x6f,0x72,0x2d,0x65,0x61,0x63,0x68,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,0x76,0x61,0x6c,0x75,0x65,0x73,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x74,0x68,0x72,0x65,0x61,0x64,0x2d,0x73,0x77,0x69,0x74,0x63,0x68,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x73,0x70,0x61,0x77,0x6e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6a,0x6f,0x69,0x6e,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x73,0x6c,0x65,0x65,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x73,0x70,0x61,0x77,0x6e,0x2d,0x70,0x72,0x6f,0x63,0x65,0x73,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x6a,0x6f,0x69,0x6e,0x2d,0x70,0x72,0x6f,0x63,0x65,0x73,0x73,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x73,0x65,0x6e,0x64,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x74,0x72,0x79,0x2d,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x66,0x75,0x74,0x75,0x72,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x74,0x6f,0x75,0x63,0x68,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x6d,0x61,0x70,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x6d,0x61,0x70,0x2d,0x66,0x72,0x6f,0x6d,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x66,0x6f,0x72,0x2d,0x65,0x61,0x63,0x68,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x72,0x65,0x64,0x75,0x63,0x65,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x72,0x65,0x64,0x75,0x63,0x65,0x2d,0x66,0x72,0x6f,0x6d,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x6d,0x61,0x70,0x2d,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x66,0x6f,0x72,0x2d,0x65,0x61,0x63,0x68,0x2d,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x01,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x72,0x65,0x64,0x75,0x63,0x65,0x2d,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x72,0x65,0x64,0x75,0x63,0x65,0x2d,0x63,0x68,0x75,0x6e,0x6b,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x63,0x68,0x75,0x6e,0x6b,0x2d,0x66,0x75,0x74,0x75,0x72,0x65,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x63,0x68,0x75,0x6e,0x6b,0x2d,0x74,0x6f,0x75,0x63,0x68,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x63,0x68,0x75,0x6e,0x6b,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x65,0x6e,0x64,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x65,0x6e,0x64,0x3f,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x6d,0x61,0x6b,0x65,0x2d,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x66,0x6f,0x72,0x2d,0x65,0x61,0x63,0x68,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x3e,0x6c,0x69,0x73,0x74,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x6c,0x69,0x73,0x74,0x2d,0x74,0x61,0x67,0x67,0x65,0x64,0x3f,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x6c,0x69,0x73,0x74,0x2d,0x75,0x6e,0x69,0x6f,0x6e,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x6c,0x69,0x73,0x74,0x2d,0x64,0x69,0x66,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x61,0x74,0x6f,0x6d,0x69,0x63,0x3f,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x73,0x65,0x74,0x2d,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x73,0x65,0x74,0x2d,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x00,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x64,0x65,0x66,0x69,0x6e,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x3f,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x2d,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x2d,0x76,0x61,0x6c,0x75,0x65,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x62,0x65,0x67,0x69,0x6e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x62,0x65,0x67,0x69,0x6e,0x3f,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x69,0x66,0x2d,0x61,0x6c,0x74,0x65,0x72,0x6e,0x61,0x74,0x69,0x76,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x3f,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x6c,0x61,0x73,0x74,0x3f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x69,0x66,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x61,0x6e,0x64,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x6e,0x64,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x6c,0x65,0x74,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6f,0x72,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6f,0x72,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x62,0x6f,0x64,0x79,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x69,0x6e,0x69,0x74,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6c,0x65,0x74,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x74,0x6d,0x70,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6c,0x6f,0x6f,0x70,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x65,0x6c,0x73,0x65,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x65,0x6c,0x73,0x65,0x3f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x64,0x61,0x74,0x75,0x6d,0x73,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x70,0x72,0x65,0x64,0x69,0x63,0x61,0x74,0x65,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x63,0x6f,0x6e,0x64,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x71,0x75,0x61,0x73,0x69,0x71,0x75,0x6f,0x74,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x71,0x75,0x61,0x73,0x69,0x71,0x75,0x6f,0x74,0x65,0x3f,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x71,0x75,0x6f,0x74,0x65,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x63,0x6f,0x6e,0x73,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x2d,0x71,0x75,0x61,0x73,0x69,0x71,0x75,0x6f,0x74,0x65,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x2d,0x73,0x70,0x6c,0x69,0x63,0x69,0x6e,0x67,0x01,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x2d,0x73,0x70,0x6c,0x69,0x63,0x69,0x6e,0x67,0x3f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x3f,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x71,0x75,0x61,0x73,0x69,0x71,0x75,0x6f,0x74,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x70,0x72,0x6f,0x63,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6e,0x65,0x78,0x74,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x61,0x72,0x67,0x6c,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x76,0x61,0x6c,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x63,0x61,0x6c,0x6c,0x5f,0x63,0x63,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x74,0x61,0x72,0x67,0x65,0x74,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x63,0x61,0x6c,0x6c,0x5f,0x63,0x63,0x5f,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x63,0x61,0x6c,0x6c,0x2f,0x63,0x63,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x63,0x61,0x6c,0x6c,0x5f,0x65,0x63,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x63,0x61,0x6c,0x6c,0x5f,0x65,0x63,0x5f,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x63,0x61,0x6c,0x6c,0x2f,0x65,0x63,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x65,0x6e,0x76,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x63,0x6f,0x6e,0x74,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x61,0x72,0x67,0x6c,0x5f,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,0x76,0x61,0x6c,0x75,0x65,0x73,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x5f,0x72,0x65,0x73,0x75,0x6d,0x65,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x72,0x65,0x73,0x75,0x6d,0x65,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x5f,0x79,0x69,0x65,0x6c,0x64,0x00,0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x79,0x69,0x65,0x6c,0x64,0x00,0x01,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x01,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x72,0x65,0x73,0x65,0x74,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x6d,0x61,0x6b,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x65,0x6e,0x76,0x2d,0x64,0x65,0x66,0x69,0x6e,0x69,0x74,0x69,0x6f,0x6e,0x2d,0x73,0x69,0x7a,0x65,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x65,0x6e,0x76,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x65,0x6e,0x76,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x43,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x74,0x79,0x70,0x65,0x20,0x6f,0x66,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x3a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x65,0x6e,0x76,0x2d,0x65,0x78,0x74,0x65,0x6e,0x64,0x00,0x00,0x01,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x65,0x6e,0x76,0x2d,0x65,0x78,0x74,0x65,0x6e,0x64,0x2d,0x64,0x65,0x66,0x69,0x6e,0x69,0x74,0x69,0x6f,0x6e,0x73,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x65,0x6e,0x76,0x2d,0x66,0x72,0x61,0x6d,0x65,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x73,0x65,0x74,0x31,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x67,0x65,0x74,0x31,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x73,0x65,0x74,0x5f,0x74,0x6f,0x70,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x67,0x65,0x74,0x5f,0x74,0x6f,0x70,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x73,0x65,0x74,0x30,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x67,0x65,0x74,0x30,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x67,0x65,0x74,0x30,0x5f,0x33,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x67,0x65,0x74,0x30,0x5f,0x32,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x67,0x65,0x74,0x30,0x5f,0x31,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x67,0x65,0x74,0x30,0x5f,0x30,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x67,0x65,0x74,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x65,0x6e,0x76,0x2d,0x61,0x63,0x63,0x65,0x73,0x73,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x62,0x69,0x66,0x3f,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3a,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x43,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x74,0x79,0x70,0x65,0x3a,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x62,0x65,0x67,0x69,0x6e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x73,0x65,0x71,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x49,0x6e,0x74,0x65,0x72,0x6e,0x61,0x6c,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x20,0x74,0x79,0x70,0x65,0x3a,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x62,0x69,0x67,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x73,0x6d,0x61,0x6c,0x6c,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x66,0x61,0x6c,0x73,0x65,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x74,0x72,0x75,0x65,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x74,0x6f,0x6d,0x69,0x63,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x6c,0x69,0x73,0x74,0x2d,0x3e,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6c,0x69,0x73,0x74,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x6c,0x69,0x73,0x74,0x2d,0x3e,0x76,0x65,0x63,0x74,0x6f,0x72,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x76,0x65,0x63,0x74,0x6f,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x43,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x71,0x75,0x6f,0x74,0x65,0x20,0x74,0x79,0x70,0x65,0x3a,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x71,0x75,0x6f,0x74,0x65,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x62,0x69,0x66,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x6c,0x61,0x6d,0x62,0x64,0x61,0x5f,0x65,0x6e,0x74,0x72,0x79,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x6c,0x61,0x6d,0x62,0x64,0x61,0x5f,0x65,0x6e,0x64,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6e,0x61,0x6d,0x65,0x64,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,0x61,0x72,0x67,0x73,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,0x62,0x6f,0x64,0x79,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x73,0x65,0x74,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x73,0x65,0x74,0x21,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x62,0x72,0x61,0x6e,0x63,0x68,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x69,0x66,0x5f,0x74,0x72,0x75,0x65,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x69,0x66,0x5f,0x66,0x61,0x6c,0x73,0x65,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x69,0x66,0x5f,0x65,0x6e,0x64,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x69,0x66,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x6c,0x69,0x73,0x74,0x2d,0x63,0x6f,0x70,0x79,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x79,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x79,0x2d,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x73,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x63,0x61,0x6c,0x6c,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x70,0x6c,0x75,0x73,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x6d,0x69,0x6e,0x75,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6c,0x65,0x73,0x73,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x65,0x71,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x65,0x71,0x3f,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x63,0x61,0x72,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x63,0x64,0x72,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x6e,0x75,0x6c,0x6c,0x3f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x6e,0x75,0x6c,0x6c,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x70,0x61,0x69,0x72,0x3f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x70,0x61,0x69,0x72,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x6e,0x6f,0x74,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x3f,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x2d,0x6c,0x6f,0x6f,0x70,0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x73,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x61,0x72,0x67,0x5f,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x61,0x72,0x67,0x00,0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x62,0x72,0x61,0x6e,0x63,0x68,0x5f,0x62,0x69,0x66,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x61,0x70,0x70,0x6c,0x79,0x5f,0x70,0x72,0x69,0x6d,0x69,0x74,0x69,0x76,0x65,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x61,0x70,0x70,0x6c,0x79,0x5f,0x65,0x6e,0x64,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x61,0x70,0x70,0x6c,0x79,0x5f,0x62,0x69,0x66,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x62,0x69,0x66,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x61,0x70,0x70,0x6c,0x79,0x5f,0x6c,0x61,0x6d,0x62,0x64,0x61,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x67,0x6f,0x74,0x6f,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x70,0x72,0x6f,0x63,0x5f,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x49,0x6e,0x74,0x65,0x72,0x6e,0x61,0x6c,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x52,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x69,0x6e,0x6b,0x61,0x67,0x65,0x20,0x6e,0x6f,0x74,0x20,0x76,0x61,0x6c,0x3a,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x00,0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x63,0x6f,0x6e,0x64,0x01,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x00,0x00,0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,0x65,0x73,0x63,0x61,0x70,0x65,0x2d,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x72,0x65,0x73,0x75,0x6d,0x65,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x79,0x69,0x65,0x6c,0x64,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x00,0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x73,0x65,0x74,0x21,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x61,0x70,0x70,0x6c,0x79,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x65,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x65,0x2d,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x49,0x6c,0x6c,0x65,0x67,0x61,0x6c,0x20,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x3a,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x65,0x78,0x69,0x74,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x73,0x61,0x76,0x65,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6a,0x75,0x6d,0x70,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x65,0x6e,0x76,0x5f,0x65,0x78,0x74,0x65,0x6e,0x64,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x6c,0x6f,0x61,0x64,0x5f,0x65,0x6e,0x76,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x73,0x61,0x76,0x65,0x32,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x32,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x67,0x65,0x74,0x5f,0x6c,0x69,0x73,0x74,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x67,0x65,0x74,0x5f,0x63,0x6f,0x6e,0x73,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x63,0x61,0x6c,0x6c,0x5f,0x62,0x69,0x66,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x63,0x61,0x6c,0x6c,0x5f,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x61,0x73,0x73,0x69,0x67,0x6e,0x5f,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x49,0x6c,0x6c,0x65,0x67,0x61,0x6c,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x3a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x6d,0x61,0x6b,0x65,0x2d,0x73,0x65,0x71,0x01,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x65,0x6d,0x70,0x74,0x79,0x2d,0x73,0x65,0x71,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x73,0x74,0x6d,0x74,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x6e,0x65,0x65,0x64,0x65,0x64,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x6e,0x65,0x65,0x64,0x73,0x3f,0x00,0x00,0x01,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x73,0x3f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x61,0x70,0x70,0x65,0x6e,0x64,0x2d,0x73,0x65,0x71,0x2d,0x6c,0x69,0x73,0x74,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x61,0x70,0x70,0x65,0x6e,0x64,0x2d,0x74,0x77,0x6f,0x2d,0x73,0x65,0x71,0x73,0x00,0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x61,0x70,0x70,0x65,0x6e,0x64,0x2d,0x73,0x65,0x71,0x73,0x00,0x01,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x2d,0x73,0x65,0x71,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x74,0x61,0x63,0x6b,0x2d,0x6f,0x6e,0x2d,0x73,0x65,0x71,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x6c,0x69,0x6e,0x6b,0x61,0x67,0x65,0x2d,0x65,0x6e,0x64,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x6c,0x69,0x6e,0x6b,0x61,0x67,0x65,0x2d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x53,0x68,0x6f,0x65,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x68,0x65,0x61,0x64,0x65,0x72,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x61,0x64,0x64,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x2d,0x62,0x79,0x74,0x65,0x73,0x00,0x00,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x73,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x7a,0x65,0x72,0x6f,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x70,0x61,0x64,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x3a,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x72,0x65,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x6e,0x75,0x6d,0x62,0x65,0x72,0x2d,0x6f,0x66,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x73,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x2d,0x6c,0x65,0x6e,0x67,0x74,0x68,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x2d,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x73,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x66,0x75,0x73,0x65,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x6c,0x6f,0x63,0x61,0x6c,0x2d,0x67,0x65,0x74,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x66,0x69,0x6e,0x64,0x2d,0x74,0x61,0x72,0x67,0x65,0x74,0x73,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x74,0x6f,0x6b,0x65,0x6e,0x2d,0x72,0x6f,0x77,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x74,0x6f,0x6b,0x65,0x6e,0x2d,0x63,0x6f,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3a,0x20,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x65,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x72,0x65,0x61,0x64,0x2d,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x55,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x2e,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x74,0x6f,0x6b,0x65,0x6e,0x2d,0x61,0x74,0x6f,0x6d,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2c,0x40,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x25,0x28,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x23,0x28,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x6c,0x65,0x66,0x74,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x2d,0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x55,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x60,0x29,0x27,0x2e,0x00,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x70,0x61,0x72,0x65,0x6e,0x74,0x68,0x65,0x73,0x69,0x73,0x2d,0x72,0x69,0x67,0x68,0x74,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x70,0x61,0x72,0x65,0x6e,0x74,0x68,0x65,0x73,0x69,0x73,0x2d,0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x55,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x64,0x6f,0x74,0x74,0x65,0x64,0x20,0x70,0x61,0x69,0x72,0x2e,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x55,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x60,0x2e,0x27,0x20,0x6f,0x75,0x74,0x73,0x69,0x64,0x65,0x20,0x6c,0x69,0x73,0x74,0x2e,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x74,0x6f,0x6b,0x65,0x6e,0x2d,0x64,0x6f,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x4d,0x61,0x70,0x70,0x69,0x6e,0x67,0x20,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x20,0x6e,0x6f,0x74,0x20,0x73,0x65,0x70,0x61,0x72,0x61,0x74,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x60,0x3a,0x27,0x2e,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x49,0x6e,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x20,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x2e,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x2d,0x72,0x65,0x62,0x75,0x69,0x6c,0x64,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x73,0x70,0x65,0x63,0x69,0x61,0x6c,0x2d,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x43,0x6f,0x75,0x6c,0x64,0x6e,0x27,0x74,0x20,0x72,0x65,0x61,0x64,0x20,0x66,0x69,0x6c,0x65,0x3a,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x72,0x65,0x61,0x64,0x2d,0x66,0x69,0x6c,0x65,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x72,0x65,0x61,0x64,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x63,0x68,0x61,0x72,0x20,0x62,0x6f,0x6f,0x74,0x73,0x74,0x72,0x61,0x70,0x5f,0x63,0x6f,0x64,0x65,0x5b,0x5d,0x20,0x3d,0x0a,0x7b,0x20,0x00,0x00,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x20,0x7d,0x3b,0x0a,0x0a,0x49,0x4e,0x54,0x20,0x62,0x6f,0x6f,0x74,0x73,0x74,0x72,0x61,0x70,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3b,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x2d,0x64,0x75,0x6d,0x70,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x2d,0x72,0x65,0x61,0x64,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x28,0x65,0x76,0x61,0x6c,0x29,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x65,0x76,0x61,0x6c,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6c,0x6f,0x61,0x64,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x65,0x6d,0x70,0x74,0x79,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x62,0x65,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x64,0x79,0x00,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x3f,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,0x62,0x6f,0x64,0x79,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x2d,0x73,0x6c,0x6f,0x74,0x73,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x76,0x65,0x63,0x74,0x6f,0x72,0x3f,0x00,0x01,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x2d,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x69,0x66,0x2d,0x63,0x6f,0x6e,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x73,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x73,0x74,0x61,0x74,0x65,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x54,0x52,0x41,0x50,0x2d,0x43,0x41,0x54,0x43,0x48,0x2d,0x53,0x54,0x41,0x43,0x4b,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x65,0x6e,0x76,0x2d,0x6c,0x6f,0x6f,0x6b,0x75,0x70,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x2d,0x76,0x61,0x6c,0x75,0x65,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x61,0x70,0x70,0x6c,0x79,0x2d,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x73,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x74,0x68,0x65,0x2d,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x70,0x63,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x71,0x75,0x6f,0x74,0x65,0x64,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x70,0x61,0x72,0x65,0x6e,0x74,0x68,0x65,0x73,0x69,0x66,0x79,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x54,0x52,0x41,0x50,0x2d,0x45,0x52,0x52,0x4f,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x72,0x65,0x73,0x74,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x2d,0x63,0x6f,0x75,0x6e,0x74,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x61,0x6c,0x6c,0x2d,0x72,0x65,0x67,0x73,0x2d,0x6f,0x6c,0x64,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,0x3f,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x74,0x68,0x65,0x2d,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x00,0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x69,0x6e,0x74,0x65,0x72,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x2d,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x69,0x6e,0x74,0x65,0x72,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x73,0x70,0x65,0x63,0x69,0x61,0x6c,0x2d,0x66,0x6f,0x72,0x6d,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x2d,0x63,0x6f,0x64,0x65,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x72,0x65,0x70,0x6c,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x62,0x79,0x74,0x65,0x63,0x6f,0x64,0x65,0x2d,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x3f,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x69,0x66,0x2d,0x70,0x72,0x65,0x64,0x69,0x63,0x61,0x74,0x65,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,0x76,0x61,0x6c,0x75,0x65,0x73,0x2d,0x63,0x6f,0x6e,0x73,0x75,0x6d,0x65,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x61,0x70,0x70,0x6c,0x79,0x2d,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2d,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x73,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x63,0x61,0x6c,0x6c,0x2f,0x63,0x63,0x2d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x65,0x78,0x70,0x2d,0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,0x76,0x61,0x6c,0x75,0x65,0x73,0x2d,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x72,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x63,0x6f,0x70,0x79,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x01,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x63,0x6f,0x70,0x79,0x2d,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x54,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,0x20,0x63,0x6c,0x6f,0x73,0x65,0x64,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3e,0x3e,0x20,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x20,0x20,0x5e,0x44,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x78,0x69,0x74,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x20,0x20,0x2e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x41,0x62,0x6f,0x72,0x74,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x69,0x6e,0x70,0x75,0x74,0x20,0x62,0x61,0x74,0x63,0x68,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x20,0x20,0x6e,0x65,0x77,0x20,0x20,0x20,0x20,0x20,0x20,0x43,0x6c,0x65,0x61,0x72,0x20,0x61,0x6c,0x6c,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x20,0x20,0x68,0x65,0x6c,0x70,0x20,0x20,0x20,0x20,0x20,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x74,0x68,0x69,0x73,0x20,0x74,0x65,0x78,0x74,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x6f,0x72,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x2e,0x20,0x20,0x54,0x68,0x65,0x72,0x65,0x20,0x61,0x72,0x65,0x20,0x61,0x6c,0x73,0x6f,0x20,0x73,0x6f,0x6d,0x65,0x20,0x65,0x78,0x74,0x72,0x61,0x20,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x3a,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x54,0x68,0x69,0x73,0x20,0x69,0x73,0x20,0x61,0x6e,0x20,0x69,0x6e,0x74,0x65,0x72,0x61,0x63,0x74,0x69,0x76,0x65,0x20,0x74,0x6f,0x6f,0x6c,0x20,0x69,0x6e,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x79,0x6f,0x75,0x20,0x63,0x61,0x6e,0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x61,0x6e,0x79,0x20,0x53,0x68,0x6f,0x65,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x0a,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x68,0x65,0x6c,0x70,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x45,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x20,0x66,0x6c,0x75,0x73,0x68,0x65,0x64,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6e,0x65,0x77,0x0a,0x00,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x49,0x6e,0x70,0x75,0x74,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x6c,0x75,0x73,0x68,0x65,0x64,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2e,0x0a,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x75,0x6e,0x74,0x69,0x6c,0x2d,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3e,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x20,0x72,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x20,0x53,0x68,0x6f,0x65,0x20,0x69,0x6e,0x63,0x72,0x65,0x6d,0x65,0x6e,0x74,0x61,0x6c,0x20,0x66,0x72,0x6f,0x6e,0x74,0x65,0x6e,0x64,0x2e,0x0a,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x2d,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x61,0x6c,0x73,0x6f,0x20,0x62,0x79,0x20,0x61,0x20,0x73,0x68,0x6f,0x65,0x20,0x62,0x75,0x69,0x6c,0x74,0x20,0x77,0x69,0x74,0x68,0x20,0x6e,0x61,0x74,0x69,0x76,0x65,0x20,0x63,0x6f,0x64,0x65,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x53,0x63,0x72,0x69,0x70,0x74,0x73,0x20,0x74,0x68,0x61,0x74,0x20,0x61,0x72,0x65,0x20,0x6c,0x6f,0x61,0x64,0x65,0x64,0x2c,0x20,0x6f,0x72,0x20,0x72,0x75,0x6e,0x20,0x62,0x79,0x20,0x73,0x68,0x6f,0x65,0x20,0x5b,0x73,0x63,0x72,0x69,0x70,0x74,0x5d,0x2c,0x20,0x61,0x72,0x65,0x20,0x69,0x6e,0x74,0x65,0x72,0x70,0x72,0x65,0x74,0x65,0x64,0x2c,0x0a,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x20,0x20,0x73,0x68,0x6f,0x65,0x20,0x2d,0x2d,0x61,0x6f,0x74,0x20,0x62,0x6f,0x6f,0x74,0x73,0x74,0x72,0x61,0x70,0x2e,0x68,0x20,0x69,0x6e,0x69,0x74,0x2e,0x73,0x68,0x6f,0x65,0x20,0x73,0x63,0x72,0x69,0x70,0x74,0x2e,0x73,0x68,0x6f,0x65,0x0a,0x0a,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x72,0x75,0x6e,0x73,0x20,0x69,0x6e,0x73,0x74,0x65,0x61,0x64,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x20,0x6c,0x69,0x6e,0x65,0x3a,0x0a,0x0a,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x67,0x69,0x76,0x65,0x6e,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x69,0x6e,0x69,0x74,0x2e,0x73,0x68,0x6f,0x65,0x20,0x69,0x73,0x20,0x64,0x75,0x6d,0x70,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x6f,0x63,0x65,0x64,0x75,0x72,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x2c,0x20,0x61,0x6e,0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x0a,0x41,0x20,0x64,0x75,0x6d,0x70,0x65,0x64,0x20,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x68,0x61,0x73,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x6f,0x63,0x65,0x64,0x75,0x72,0x65,0x73,0x20,0x69,0x74,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x73,0x2e,0x20,0x20,0x41,0x20,0x73,0x63,0x72,0x69,0x70,0x74,0x0a,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x0a,0x57,0x68,0x65,0x6e,0x20,0x6e,0x6f,0x20,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x69,0x73,0x20,0x67,0x69,0x76,0x65,0x6e,0x2c,0x20,0x53,0x68,0x6f,0x65,0x20,0x77,0x69,0x6c,0x6c,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x69,0x6e,0x20,0x69,0x6e,0x74,0x65,0x72,0x61,0x63,0x74,0x69,0x76,0x65,0x20,0x6d,0x6f,0x64,0x65,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x20,0x20,0x2d,0x76,0x2c,0x20,0x2d,0x2d,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x65,0x78,0x69,0x74,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x2d,0x2d,0x74,0x72,0x61,0x63,0x65,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x54,0x72,0x61,0x63,0x65,0x20,0x65,0x61,0x63,0x68,0x20,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x75,0x6e,0x2e,0x0a,0x00,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x2d,0x2d,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x2d,0x6f,0x70,0x63,0x6f,0x64,0x65,0x73,0x20,0x43,0x6f,0x75,0x6e,0x74,0x20,0x61,0x6e,0x64,0x20,0x74,0x69,0x6d,0x65,0x20,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2c,0x20,0x72,0x65,0x70,0x6f,0x72,0x74,0x65,0x64,0x20,0x61,0x74,0x20,0x65,0x78,0x69,0x74,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x2d,0x2d,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x20,0x3c,0x66,0x69,0x6c,0x65,0x3e,0x20,0x20,0x53,0x61,0x6d,0x70,0x6c,0x65,0x20,0x70,0x72,0x6f,0x63,0x65,0x64,0x75,0x72,0x65,0x73,0x2c,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x69,0x6c,0x65,0x20,0x61,0x74,0x20,0x65,0x78,0x69,0x74,0x2e,0x0a,0x00,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x2d,0x2d,0x6a,0x69,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x43,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x66,0x72,0x65,0x71,0x75,0x65,0x6e,0x74,0x6c,0x79,0x20,0x75,0x73,0x65,0x64,0x20,0x70,0x72,0x6f,0x63,0x65,0x64,0x75,0x72,0x65,0x73,0x20,0x74,0x6f,0x20,0x6e,0x61,0x74,0x69,0x76,0x65,0x20,0x63,0x6f,0x64,0x65,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x20,0x20,0x2d,0x68,0x2c,0x20,0x2d,0x2d,0x68,0x65,0x6c,0x70,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x74,0x68,0x69,0x73,0x20,0x68,0x65,0x6c,0x70,0x20,0x61,0x6e,0x64,0x20,0x65,0x78,0x69,0x74,0x2e,0x0a,0x00,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x20,0x20,0x2d,0x65,0x2c,0x20,0x2d,0x2d,0x65,0x78,0x65,0x63,0x75,0x74,0x65,0x20,0x3c,0x63,0x6d,0x64,0x3e,0x20,0x20,0x20,0x52,0x75,0x6e,0x20,0x74,0x68,0x65,0x20,0x67,0x69,0x76,0x65,0x6e,0x20,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x20,0x69,0x6e,0x73,0x74,0x65,0x61,0x64,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x73,0x63,0x72,0x69,0x70,0x74,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x20,0x20,0x2d,0x64,0x2c,0x20,0x2d,0x2d,0x64,0x75,0x6d,0x70,0x20,0x3c,0x66,0x69,0x6c,0x65,0x3e,0x20,0x20,0x20,0x20,0x20,0x44,0x75,0x6d,0x70,0x73,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x20,0x61,0x73,0x20,0x61,0x20,0x43,0x20,0x66,0x69,0x6c,0x65,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x2d,0x2d,0x61,0x6f,0x74,0x20,0x3c,0x66,0x69,0x6c,0x65,0x3e,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x75,0x6d,0x70,0x73,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x20,0x61,0x73,0x20,0x61,0x20,0x43,0x20,0x66,0x69,0x6c,0x65,0x20,0x6f,0x66,0x20,0x6e,0x61,0x74,0x69,0x76,0x65,0x20,0x63,0x6f,0x64,0x65,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x3a,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x55,0x73,0x61,0x67,0x65,0x3a,0x20,0x73,0x68,0x6f,0x65,0x20,0x5b,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x5d,0x20,0x5b,0x73,0x63,0x72,0x69,0x70,0x74,0x5d,0x0a,0x0a,0x00,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x2e,0x20,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x31,0x39,0x39,0x39,0x20,0x46,0x72,0x65,0x64,0x72,0x69,0x6b,0x20,0x4e,0x6f,0x72,0x69,0x6e,0x67,0x2e,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x2d,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2d,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x2d,0x2d,0x74,0x72,0x61,0x63,0x65,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x2d,0x2d,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x2d,0x6f,0x70,0x63,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x2d,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x2d,0x2d,0x6a,0x69,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x2d,0x2d,0x68,0x65,0x6c,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2d,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x2d,0x2d,0x65,0x78,0x65,0x63,0x75,0x74,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2d,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x2d,0x2d,0x61,0x6f,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x2d,0x2d,0x64,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2d,0x64,0x00,0x00 };
 
-INT bootstrap_size = 81497;
+INT bootstrap_size = 105712;
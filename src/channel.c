@@ -0,0 +1,240 @@
+/* channel.c
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the channel module.  A channel carries copies of values from
+ * processes that send to processes that receive, see copy.c.  It is a
+ * bounded ring of cells, each of which has a sequence number that tells
+ * whether it is free to send to or holds a message to receive.  Senders
+ * and receivers claim their next cell by compare-and-swap on a position
+ * of their own, so any number of each go on without locks.
+ *
+ * A channel is not in any heap, so it can be in all processes at once.
+ * It lives as long as the first process, which all others are spawned
+ * from.
+ */
+
+#define MODULE_DEBUG 0
+#define MODULE_NAME  "channel"
+
+#include "types.h"
+
+#include "args.h"
+#include "bif.h"
+#include "channel.h"
+#include "copy.h"
+#include "err.h"
+#include "mem.h"
+#include "pair.h"
+#include "process.h"
+#include "thread.h"
+
+/* The largest channel asked for. */
+#define CHANNEL_MAX_SIZE (1 << 20)
+
+#ifdef __GNUC__
+#define CHANNEL_CAS(p, old, new) __sync_bool_compare_and_swap(p, old, new)
+#define CHANNEL_BARRIER()        __sync_synchronize()
+#else
+/* Processes only run one at a time without the atomic builtins. */
+#define CHANNEL_CAS(p, old, new) (*(p) == (old) ? (*(p) = (new), 1) : 0)
+#define CHANNEL_BARRIER()
+#endif /* __GNUC__ */
+
+void channel_destroy(struct channel *channels)
+{
+  struct channel *channel, *next;
+  UINT i;
+
+  for(channel = channels; channel; channel = next)
+  {
+    next = channel->next;
+
+    /* Messages never received are those from the receive position
+       up to the send position. */
+    for(i = channel->receive; i != channel->send; i++)
+    {
+      copy_destroy(channel->cells[i & channel->mask].message);
+      mem_free(channel->cells[i & channel->mask].message);
+    }
+
+    mem_free(channel->cells);
+    mem_free(channel);
+  }
+}
+
+/* Returns the cell to send to at the position, or zero when the channel
+   is full.  The message is sent when the sequence of the cell is set to
+   the position after it. */
+static struct channel_cell *channel_claim(struct channel *channel,
+					  UINT *position)
+{
+  struct channel_cell *cell;
+  INT difference;
+  UINT p;
+
+  p = channel->send;
+  for(;;)
+  {
+    cell = &channel->cells[p & channel->mask];
+    difference = (INT)(cell->sequence - p);
+    CHANNEL_BARRIER();
+
+    if(difference < 0)
+      return 0;
+
+    if(difference == 0 && CHANNEL_CAS(&channel->send, p, p + 1))
+    {
+      *position = p;
+      return cell;
+    }
+
+    /* Another sender got there first. */
+    p = channel->send;
+  }
+}
+
+/* Returns the next message, or zero when the channel is empty. */
+static struct copy *channel_take(struct channel *channel)
+{
+  struct channel_cell *cell;
+  struct copy *message;
+  INT difference;
+  UINT p;
+
+  p = channel->receive;
+  for(;;)
+  {
+    cell = &channel->cells[p & channel->mask];
+    difference = (INT)(cell->sequence - (p + 1));
+    CHANNEL_BARRIER();
+
+    if(difference < 0)
+      return 0;
+
+    if(difference == 0 && CHANNEL_CAS(&channel->receive, p, p + 1))
+    {
+      message = cell->message;
+      CHANNEL_BARRIER();
+
+      /* The cell is free to send to when the senders have gone round. */
+      cell->sequence = p + channel->mask + 1;
+      return message;
+    }
+
+    /* Another receiver got there first. */
+    p = channel->receive;
+  }
+}
+
+/* Returns a list of the next value of the channel, copied into the
+   process, or false when it is empty. */
+static INT channel_receive(struct process *process, struct channel *channel,
+			   struct svalue *result)
+{
+  struct svalue undefined, nil;
+  struct copy *message;
+
+  if(!(message = channel_take(channel)))
+    return 0;
+
+  /* The list is made first, so that the value is held by it while the
+     rest of the copy is allocated. */
+  undefined.type = T_UNDEFINED;
+  nil.type = T_NIL;
+  result->u.pair = pair_cons(process, &undefined, &nil);
+  result->type = T_PAIR;
+
+  copy_in(process, message, &CAR(result->u.pair));
+  copy_destroy(message);
+  mem_free(message);
+  return 1;
+}
+
+/* Returns a new channel for the given number of messages. */
+BIF_DECLARE(bif_make_channel)
+{
+  struct channel *channel, *next;
+  INT size;
+  UINT i;
+
+  ARGS_GET((process, "make-channel", args, "?%i", &size));
+
+  if(size < 0 || CHANNEL_MAX_SIZE < size)
+    ARGS_ERROR((process, "make-channel", "Size out of range."));
+
+  channel = mem_allocate_zeroed(sizeof(struct channel));
+
+  /* There are at least two cells, as a sequence tells a full cell from
+     a free one by the position it is one more than. */
+  channel->mask = 1;
+  while(channel->mask + 1 < (UINT)(size ? size : CHANNEL_SIZE))
+    channel->mask = 2*channel->mask + 1;
+
+  channel->cells = mem_allocate(sizeof(struct channel_cell) *
+				(channel->mask + 1));
+  for(i = 0; i <= channel->mask; i++)
+  {
+    channel->cells[i].sequence = i;
+    channel->cells[i].message = 0;
+  }
+
+  do
+    channel->next = next = process->root->channels;
+  while(!CHANNEL_CAS(&process->root->channels, next, channel));
+
+  BIF_RESULT_CHANNEL(channel);
+}
+
+/* Sends a copy of the value and returns true, or returns false after
+   the running thread starts to wait when the channel is full. */
+BIF_DECLARE(bif_channel_send)
+{
+  struct channel_cell *cell;
+  struct channel *channel;
+  struct svalue *value;
+  UINT position;
+
+  ARGS_GET((process, "channel-send", args, "%C%*", &channel, &value));
+
+  if(!(cell = channel_claim(channel, &position)))
+  {
+    thread_sleep(process, CHANNEL_POLL);
+    BIF_RESULT_FALSE();
+    return;
+  }
+
+  cell->message = mem_allocate(sizeof(struct copy));
+  copy_out(cell->message, value, 1);
+  CHANNEL_BARRIER();
+  cell->sequence = position + 1;
+
+  BIF_RESULT_TRUE();
+}
+
+/* Returns a list of the next value, or false after the running thread
+   starts to wait when the channel is empty. */
+BIF_DECLARE(bif_channel_receive)
+{
+  struct channel *channel;
+
+  ARGS_GET((process, "channel-receive", args, "%C", &channel));
+
+  if(!channel_receive(process, channel, result))
+  {
+    thread_sleep(process, CHANNEL_POLL);
+    BIF_RESULT_FALSE();
+  }
+}
+
+/* Returns a list of the next value, or false when the channel is
+   empty. */
+BIF_DECLARE(bif_channel_try_receive)
+{
+  struct channel *channel;
+
+  ARGS_GET((process, "channel-try-receive", args, "%C", &channel));
+
+  if(!channel_receive(process, channel, result))
+    BIF_RESULT_FALSE();
+}
@@ -0,0 +1,56 @@
+/* channel.h
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the channel module.
+ */
+
+#ifndef __CHANNEL_H__
+#define __CHANNEL_H__
+
+#include "types.h"
+
+#include "bif.h"
+#include "copy.h"
+
+/* Messages a channel holds unless another size is asked for.  Sizes
+   are rounded up to a power of two. */
+#define CHANNEL_SIZE 64
+
+/* Seconds a thread waits before it tries a full or empty channel
+   again. */
+#define CHANNEL_POLL 0.0001
+
+/* Keeps the positions of senders and receivers on cache lines of their
+   own. */
+#define CHANNEL_CACHE_LINE 64
+
+struct channel_cell
+{
+  volatile UINT sequence;
+  struct copy *message;
+};
+
+/* A bounded queue of messages that any number of processes send to and
+   receive from without locks, see channel.c. */
+struct channel
+{
+  struct channel *next;
+  UINT mask;
+  struct channel_cell *cells;
+
+  char pad_send[CHANNEL_CACHE_LINE];
+  volatile UINT send;
+  char pad_receive[CHANNEL_CACHE_LINE];
+  volatile UINT receive;
+  char pad_end[CHANNEL_CACHE_LINE];
+};
+
+void channel_destroy(struct channel *channels);
+
+BIF_DECLARE(bif_make_channel);
+BIF_DECLARE(bif_channel_send);
+BIF_DECLARE(bif_channel_receive);
+BIF_DECLARE(bif_channel_try_receive);
+
+#endif /* __CHANNEL_H__ */
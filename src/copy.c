@@ -0,0 +1,524 @@
+/* copy.c
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the copy module.  Values are copied between processes, which
+ * have heaps of their own, in two steps.  The values and everything
+ * they refer to are first copied out of one process into a struct copy,
+ * which belongs to none, and then into another.  Shared and circular
+ * structure is kept, and strings are interned again as they are copied
+ * in.  BIFs and channels are the same in all processes, and are copied
+ * like numbers.
+ *
+ * Values that refer to no objects are copied without any tables, and
+ * strings are looked up by the hash they had, so that those the other
+ * process already has, such as the symbols of the program, are found
+ * without being allocated or hashed again.
+ *
+ * A procedure refers to the top-level frame of its program, and so to
+ * every top-level variable.  Only the variables that the code of the
+ * labels copied reads or sets are copied, and the others are left
+ * undefined in the copy of the frame, so that a procedure does not take
+ * large values it never uses with it.  The compiler only reaches such
+ * variables by get_top and set_top, see program_top_slots.
+ */
+
+#define MODULE_DEBUG 0
+#define MODULE_NAME  "copy"
+
+#include "types.h"
+
+#include "big.h"
+#include "copy.h"
+#include "err.h"
+#include "map.h"
+#include "mem.h"
+#include "pair.h"
+#include "process.h"
+#include "program.h"
+#include "str.h"
+#include "vec.h"
+
+#define COPY_INITIAL_SIZE 64
+
+#define COPY_HASH(object, size)                                            \
+        ((INT)(((unsigned long)(object) >> 3) & ((size) - 1)))
+
+/* Returns the index of the object copied from, or -1. */
+static INT copy_find(struct copy *copy, void *object)
+{
+  INT h, i;
+
+  if(!copy->hash)
+    return -1;
+
+  h = COPY_HASH(object, copy->hash_size);
+  while((i = copy->hash[h]))
+  {
+    if(copy->objects[i-1].object == object)
+      return i-1;
+    h = (h + 1) & (copy->hash_size - 1);
+  }
+
+  return -1;
+}
+
+static void copy_remember(struct copy *copy, INT i)
+{
+  INT h;
+
+  h = COPY_HASH(copy->objects[i].object, copy->hash_size);
+  while(copy->hash[h])
+    h = (h + 1) & (copy->hash_size - 1);
+  copy->hash[h] = i+1;
+}
+
+/* Returns the index of n new values. */
+static INT copy_reserve(struct copy *copy, INT n)
+{
+  INT i;
+
+  if(copy->values_size < copy->values_used + n)
+  {
+    while(copy->values_size < copy->values_used + n)
+      copy->values_size = MAX(2 * copy->values_size, COPY_INITIAL_SIZE);
+    copy->values = mem_reallocate(copy->values,
+				  sizeof(struct svalue) * copy->values_size);
+  }
+
+  i = copy->values_used;
+  copy->values_used += n;
+  return i;
+}
+
+/* Returns the index of the object the value refers to, which is added
+   unless it already is there, or -1 when it refers to none. */
+static INT copy_object(struct copy *copy, struct svalue *value)
+{
+  struct copy_object *object;
+  void *from;
+  INT type, i;
+
+  switch(value->type)
+  {
+  case T_PAIR:
+  case T_LAMBDA:
+  case T_CONTINUATION:
+    from = value->u.pair;
+    type = T_PAIR;
+    break;
+
+  case T_LABEL:
+  case T_VECTOR:
+  case T_VALUES:
+    from = value->u.vec;
+    type = T_VECTOR;
+    break;
+
+  case T_STRING:
+  case T_SYMBOL:
+    from = value->u.str;
+    type = T_STRING;
+    break;
+
+  case T_MAPPING:
+    from = value->u.map;
+    type = T_MAPPING;
+    break;
+
+#ifdef USE_BIG_INTEGERS
+  case T_BIG_INTEGER:
+    from = value->u.big;
+    type = T_BIG_INTEGER;
+    break;
+#endif /* USE_BIG_INTEGERS */
+
+  default:
+    return -1;
+  }
+
+  if((i = copy_find(copy, from)) >= 0)
+    return i;
+
+  if(copy->objects_used == copy->objects_size)
+  {
+    copy->objects_size = MAX(2 * copy->objects_size, COPY_INITIAL_SIZE);
+    copy->objects = mem_reallocate(copy->objects, sizeof(struct copy_object) *
+				   copy->objects_size);
+
+    /* Keep the table at most half full. */
+    if(copy->hash)
+      mem_free(copy->hash);
+    copy->hash_size = 2 * copy->objects_size;
+    copy->hash = mem_allocate_zeroed(sizeof(INT) * copy->hash_size);
+    for(i = 0; i < copy->objects_used; i++)
+      copy_remember(copy, i);
+  }
+
+  i = copy->objects_used++;
+  object = &copy->objects[i];
+  object->type = type;
+  object->object = from;
+  object->shift = 0;
+  object->s = 0;
+  object->partial = 0;
+
+  switch(type)
+  {
+  case T_PAIR:
+    object->length = 2;
+    break;
+
+  case T_VECTOR:
+    object->length = value->u.vec->length;
+    break;
+
+  case T_MAPPING:
+    object->length = 2 * value->u.map->used;
+    break;
+
+  case T_STRING:
+  {
+    struct str *str = value->u.str;
+    INT size = str->length << str->shift;
+
+    object->length = str->length;
+    object->shift = str->shift;
+    object->hash = str->hash;
+    object->s = mem_allocate_zeroed(size + 1);
+    mem_copy(object->s, str->s, size);
+    break;
+  }
+
+#ifdef USE_BIG_INTEGERS
+  case T_BIG_INTEGER:
+    object->s = mem_allocate_zeroed(mpz_sizeinbase(value->u.big->u.integer,
+						   16) + 2);
+    mpz_get_str(object->s, 16, value->u.big->u.integer);
+    object->length = 0;
+    break;
+#endif /* USE_BIG_INTEGERS */
+  }
+
+  object->values = copy_reserve(copy, object->length);
+  copy_remember(copy, i);
+
+  return i;
+}
+
+static void copy_label(struct copy *copy, struct svalue *label);
+
+/* Copies the value out into the given slot. */
+static void copy_value(struct copy *copy, struct svalue *value, INT slot)
+{
+  INT i;
+
+  i = copy_object(copy, value);
+  copy->values[slot] = *value;
+  if(i >= 0)
+    copy->values[slot].u.integer = i;
+
+  if(value->type == T_LABEL)
+    copy_label(copy, value);
+}
+
+/* Returns the index of the program of the label in the copy, which is
+   added unless it already is there.  Its top-level frame is added as
+   well, with every slot undefined, unless it was copied in full before
+   the program was come to or the code is not verified.  Programs that
+   are loaded into the same environment share the frame. */
+static INT copy_program(struct copy *copy, struct svalue *label)
+{
+  struct copy_program *program;
+  struct svalue *env;
+  struct str *code;
+  INT i, j, k;
+
+  for(i = 0; i < copy->programs_used; i++)
+    if(copy->programs[i].program == label->u.vec)
+      return i;
+
+  if(copy->programs_used == copy->programs_size)
+  {
+    copy->programs_size = MAX(2 * copy->programs_size, 4);
+    copy->programs = mem_reallocate(copy->programs,
+				    sizeof(struct copy_program) *
+				    copy->programs_size);
+  }
+
+  i = copy->programs_used++;
+  program = &copy->programs[i];
+  program->program = label->u.vec;
+  program->frame = -1;
+  code = label->u.vec->v[PROGRAM_CODE].u.str;
+  program->reached =
+    mem_allocate_zeroed(((INT *)code->s)[2]/BYTECODE_WORD + 1);
+
+  /* Code that is not verified is not looked through. */
+  env = &label->u.vec->v[PROGRAM_ENV];
+  if(label->u.vec->v[PROGRAM_CODE].aux == PROGRAM_VERIFIED &&
+     IS_PAIR(*env) && IS_VECTOR(CDR(env->u.pair)))
+  {
+    k = copy->objects_used;
+    if((j = copy_object(copy, &CDR(env->u.pair))) == k)
+    {
+      copy->objects[j].partial = 1;
+      for(k = 0; k < copy->objects[j].length; k++)
+	copy->values[copy->objects[j].values + k].type = T_UNDEFINED;
+    }
+    if(copy->objects[j].partial)
+      copy->programs[i].frame = j;
+  }
+
+  return i;
+}
+
+/* Copies the top-level variables that the code at the label, and the
+   procedures it makes, read or set. */
+static void copy_label(struct copy *copy, struct svalue *label)
+{
+  struct vec *frame;
+  INT i, j, n, values, size, *slots;
+
+  i = copy_program(copy, label);
+  if(copy->programs[i].frame < 0)
+    return;
+
+  slots = 0;
+  size = 0;
+  n = program_top_slots(label->u.vec->v[PROGRAM_CODE].u.str, label->aux,
+			copy->programs[i].reached, &slots, &size);
+
+  frame = CDR(label->u.vec->v[PROGRAM_ENV].u.pair).u.vec;
+  values = copy->objects[copy->programs[i].frame].values;
+  for(j = 0; j < n; j++)
+    if(slots[j] < frame->length)
+      copy_value(copy, &frame->v[slots[j]], values + slots[j]);
+
+  if(slots)
+    mem_free(slots);
+}
+
+/* Copies n values, and everything they refer to, out of their process.
+   Objects are copied breadth first, so long lists need no C stack. */
+void copy_out(struct copy *copy, struct svalue *values, INT n)
+{
+  struct map_entry *entry;
+  struct map *map;
+  struct vec *vec;
+  INT i, j, k;
+
+  copy->objects_size = copy->objects_used = 0;
+  copy->objects = 0;
+
+  copy->values_size = copy->values_used = 0;
+  copy->values = 0;
+
+  copy->hash_size = 0;
+  copy->hash = 0;
+
+  copy->programs_size = copy->programs_used = 0;
+  copy->programs = 0;
+
+  copy->roots = n;
+  copy_reserve(copy, n);
+  for(i = 0; i < n; i++)
+    copy_value(copy, &values[i], i);
+
+  for(i = 0; i < copy->objects_used; i++)
+    switch(copy->objects[i].type)
+    {
+    case T_PAIR:
+      copy_value(copy, &CAR((struct pair *)copy->objects[i].object),
+		 copy->objects[i].values);
+      copy_value(copy, &CDR((struct pair *)copy->objects[i].object),
+		 copy->objects[i].values + 1);
+      break;
+
+    case T_VECTOR:
+      /* The slots of a top-level frame are copied by copy_label. */
+      if(copy->objects[i].partial)
+	break;
+      vec = copy->objects[i].object;
+      for(j = 0; j < vec->length; j++)
+	copy_value(copy, &vec->v[j], copy->objects[i].values + j);
+      break;
+
+    case T_MAPPING:
+      map = copy->objects[i].object;
+      k = copy->objects[i].values;
+      for(j = 0; j < map->hash_size; j++)
+	for(entry = map->table->hash[j]; entry; entry = entry->next)
+	{
+	  copy_value(copy, &entry->key, k++);
+	  copy_value(copy, &entry->value, k++);
+	}
+      break;
+    }
+
+  /* The objects copied from may go away from now on. */
+  if(copy->hash)
+    mem_free(copy->hash);
+  copy->hash = 0;
+
+  for(i = 0; i < copy->programs_used; i++)
+    mem_free(copy->programs[i].reached);
+  if(copy->programs)
+    mem_free(copy->programs);
+  copy->programs = 0;
+  copy->programs_size = copy->programs_used = 0;
+}
+
+/* Copies the value in the given slot into the process. */
+static void copy_in_value(struct copy *copy, INT slot, struct svalue *value)
+{
+  *value = copy->values[slot];
+
+  switch(value->type)
+  {
+  case T_PAIR:
+  case T_LAMBDA:
+  case T_CONTINUATION:
+    value->u.pair = copy->objects[value->u.integer].object;
+    break;
+
+  case T_LABEL:
+  case T_VECTOR:
+  case T_VALUES:
+    value->u.vec = copy->objects[value->u.integer].object;
+    break;
+
+  case T_STRING:
+  case T_SYMBOL:
+    value->u.str = copy->objects[value->u.integer].object;
+    break;
+
+  case T_MAPPING:
+    value->u.map = copy->objects[value->u.integer].object;
+    break;
+
+#ifdef USE_BIG_INTEGERS
+  case T_BIG_INTEGER:
+    value->u.big = copy->objects[value->u.integer].object;
+    break;
+#endif /* USE_BIG_INTEGERS */
+
+  case T_ESCAPE:
+    value->u.integer += copy->escapes;
+    break;
+  }
+}
+
+/* Copies the values into the process.  The copy can only be copied in
+   once. */
+void copy_in(struct process *process, struct copy *copy,
+	     struct svalue *values)
+{
+  struct copy_object *object;
+  struct svalue undefined, key, value;
+  struct vec *vec;
+  INT i, j;
+
+  /* All objects are allocated before they are filled in, so that they
+     can refer to each other.  Nothing refers to them until then, so
+     room is made for the pairs first, as consing may otherwise collect
+     the objects allocated before. */
+  for(i = j = 0; i < copy->objects_used; i++)
+    if(copy->objects[i].type == T_PAIR)
+      j++;
+  pair_reserve(process, j);
+
+  /* Escapes and their marks are numbered by the process they were made
+     in, so those copied in are moved past the numbers of this one. */
+  for(i = j = 0; i < copy->values_used; i++)
+    if(copy->values[i].type == T_ESCAPE)
+      j = MAX(j, copy->values[i].u.integer);
+  copy->escapes = process->escape_count;
+  process->escape_count += j;
+
+  undefined.type = T_UNDEFINED;
+  for(i = 0; i < copy->objects_used; i++)
+  {
+    object = &copy->objects[i];
+    switch(object->type)
+    {
+    case T_PAIR:
+      object->object = pair_cons(process, &undefined, &undefined);
+      break;
+
+    case T_VECTOR:
+      object->object = vec_allocate(&process->vec_heap, object->length);
+      break;
+
+    case T_STRING:
+      object->object = str_allocate_hashed(&process->str_heap, object->s,
+					   object->length, object->shift,
+					   object->hash);
+      break;
+
+    case T_MAPPING:
+      object->object = map_allocate(&process->map_heap);
+      break;
+
+#ifdef USE_BIG_INTEGERS
+    case T_BIG_INTEGER:
+      object->object = big_allocate_integer_text(&process->big_heap,
+						 object->s, 16);
+      break;
+#endif /* USE_BIG_INTEGERS */
+    }
+  }
+
+  for(i = 0; i < copy->objects_used; i++)
+  {
+    object = &copy->objects[i];
+    switch(object->type)
+    {
+    case T_PAIR:
+      copy_in_value(copy, object->values,
+		    &CAR((struct pair *)object->object));
+      copy_in_value(copy, object->values + 1,
+		    &CDR((struct pair *)object->object));
+      break;
+
+    case T_VECTOR:
+      vec = object->object;
+      for(j = 0; j < object->length; j++)
+	copy_in_value(copy, object->values + j, &vec->v[j]);
+      break;
+    }
+  }
+
+  /* Keys are hashed as they are set, so mappings are filled in once
+     everything else is. */
+  for(i = 0; i < copy->objects_used; i++)
+  {
+    object = &copy->objects[i];
+    if(object->type == T_MAPPING)
+      for(j = 0; j < object->length; j += 2)
+      {
+	copy_in_value(copy, object->values + j, &key);
+	copy_in_value(copy, object->values + j + 1, &value);
+	map_set(object->object, &key, &value);
+      }
+  }
+
+  for(i = 0; i < copy->roots; i++)
+    copy_in_value(copy, i, &values[i]);
+}
+
+void copy_destroy(struct copy *copy)
+{
+  INT i;
+
+  for(i = 0; i < copy->objects_used; i++)
+    if(copy->objects[i].s)
+      mem_free(copy->objects[i].s);
+
+  if(copy->hash)
+    mem_free(copy->hash);
+  if(copy->objects)
+    mem_free(copy->objects);
+  if(copy->values)
+    mem_free(copy->values);
+}
@@ -0,0 +1,70 @@
+/* copy.h
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the copy module.
+ */
+
+#ifndef __COPY_H__
+#define __COPY_H__
+
+#include "types.h"
+
+/* An object in a copy.  Pairs and vectors have their values at the
+   given index, mappings their keys and values in turn, and strings and
+   big integers their characters.  Strings keep their hash as well. */
+struct copy_object
+{
+  INT type;
+  INT length, shift, hash;
+  INT values;
+  char *s;
+
+  /* One for the top-level frame of a program, of which only the slots
+     in use are copied, see copy_label. */
+  INT partial;
+
+  /* The object copied from, and then the object copied to. */
+  void *object;
+};
+
+/* A program that labels in a copy refer to, with the index of its
+   top-level frame, or -1, and the words of its code that have been
+   looked through for the top-level variables in use. */
+struct copy_program
+{
+  struct vec *program;
+  INT frame;
+  UBYTE *reached;
+};
+
+/* A copy of values and all they refer to, which belongs to no process.
+   Values that refer to objects have their index instead of a pointer.
+   The first roots values are those copied. */
+struct copy
+{
+  INT roots;
+
+  INT objects_size, objects_used;
+  struct copy_object *objects;
+
+  INT values_size, values_used;
+  struct svalue *values;
+
+  INT hash_size;
+  INT *hash;
+
+  /* Only while copying out. */
+  INT programs_size, programs_used;
+  struct copy_program *programs;
+
+  /* Only while copying in, what the numbers of escapes are moved by. */
+  INT escapes;
+};
+
+void copy_out(struct copy *copy, struct svalue *values, INT n);
+void copy_in(struct process *process, struct copy *copy,
+	     struct svalue *values);
+void copy_destroy(struct copy *copy);
+
+#endif /* __COPY_H__ */
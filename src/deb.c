@@ -88,3 +88,19 @@ BIF_DECLARE(bif_debug_pairs)
   BIF_MAP_TEXT_WITH_SMALL_INTEGER(map, "memory-used",
 				  pair_debug_memory_used(&process->pair_heap));
 }
+
+/* Traces each instruction run by the kernel while the flag is true.
+   Native code is not traced. */
+BIF_DECLARE(bif_debug_trace)
+{
+  struct svalue *on;
+
+  ARGS_GET((process, "debug-trace", args, "%*", &on));
+
+  if(IS_FALSE(*on))
+    process->instrument &= ~INSTRUMENT_TRACE;
+  else
+    process->instrument |= INSTRUMENT_TRACE;
+  
+  BIF_RESULT_UNDEFINED();
+}
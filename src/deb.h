@@ -12,3 +12,4 @@
 BIF_DECLARE(bif_debug_objects);
 BIF_DECLARE(bif_debug_memory);
 BIF_DECLARE(bif_debug_pairs);
+BIF_DECLARE(bif_debug_trace);
@@ -263,6 +263,22 @@ void err_display(struct process *process, struct svalue *value)
     err_printf("#bif");
     break;
     
+  case T_CHANNEL:
+    err_printf("#channel");
+    break;
+    
+  case T_FUTURE:
+    err_printf("#future");
+    break;
+    
+  case T_ESCAPE:
+    err_printf("#escape");
+    break;
+    
+  case T_VALUES:
+    err_printf("#values");
+    break;
+    
   case T_SYMBOL:
     err_print_symbol(value->u.str);
     break;
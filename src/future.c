@@ -0,0 +1,456 @@
+/* future.c
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the future module.  A future is a call that a worker may run
+ * in parallel with the process that made it.  The first process has a
+ * fixed pool of workers, one for each processor, which are processes of
+ * their own.  Each has a deque of futures, and runs those it made
+ * itself from the bottom, last first, and steals those of others from
+ * the top when it has none.  Futures made by other processes are dealt
+ * to the workers in turn.
+ *
+ * A worker gets a copy of the call, and leaves a copy of its value, see
+ * copy.c.  The process that made a future calls it itself when it
+ * touches the future before a worker has started to run it, so a
+ * future costs little more than a call unless it is stolen.  Whoever
+ * starts to run a future first does so by compare-and-swap of its
+ * state.
+ */
+
+#define MODULE_DEBUG 0
+#define MODULE_NAME  "future"
+
+#include "types.h"
+
+#include "args.h"
+#include "bif.h"
+#include "copy.h"
+#include "err.h"
+#include "future.h"
+#include "kernel.h"
+#include "mem.h"
+#include "pair.h"
+#include "process.h"
+#include "thread.h"
+
+#ifdef PROCESS_PARALLEL
+#include <unistd.h>
+#endif /* PROCESS_PARALLEL */
+
+#define FUTURE_TABLE_SIZE 16
+#define FUTURE_DEQUE_SIZE 16
+
+#define FUTURE_HASH(future, size)                                          \
+        ((INT)(((unsigned long)(future) >> 4) & ((size) - 1)))
+
+#ifdef __GNUC__
+#define FUTURE_CAS(p, old, new) __sync_bool_compare_and_swap(p, old, new)
+#define FUTURE_ADD(p, n)        __sync_add_and_fetch(p, n)
+#define FUTURE_BARRIER()        __sync_synchronize()
+#else
+/* Processes only run one at a time without the atomic builtins. */
+#define FUTURE_CAS(p, old, new) (*(p) == (old) ? (*(p) = (new), 1) : 0)
+#define FUTURE_ADD(p, n)        (*(p) += (n))
+#define FUTURE_BARRIER()
+#endif /* __GNUC__ */
+
+/* Drops a reference to the future, which is freed with the last.  The
+   call is only left when no one ever ran it, and the value only when
+   no one touched it. */
+static void future_release(struct future *future)
+{
+  if(FUTURE_ADD(&future->references, -1))
+    return;
+
+  if(future->state == FUTURE_PENDING)
+    copy_destroy(&future->call);
+  if(future->state == FUTURE_DONE)
+    copy_destroy(&future->result);
+  mem_free(future);
+}
+
+/* Returns one when the future is for the caller to run, as no one else
+   has started to.  The copy of the call is not needed by anyone else
+   from then on. */
+static INT future_claim(struct future *future)
+{
+  return FUTURE_CAS(&future->state, FUTURE_PENDING, FUTURE_RUNNING);
+}
+
+/* Returns the slot of the future in the table of the process, or zero
+   when the process did not make it or has already touched it. */
+static struct future **future_find(struct process *process,
+				   struct future *future)
+{
+  struct future **slot;
+
+  if(!process->futures)
+    return 0;
+
+  for(slot = &process->futures[FUTURE_HASH(future, process->futures_size)];
+      *slot; slot = &(*slot)->chain)
+    if(*slot == future)
+      return slot;
+
+  return 0;
+}
+
+static void future_remember(struct process *process, struct future *future)
+{
+  struct future **futures, *next;
+  INT size, h, i;
+
+  if(process->futures_size <= process->futures_used)
+  {
+    size = MAX(2 * process->futures_size, FUTURE_TABLE_SIZE);
+    futures = mem_allocate_zeroed(sizeof(struct future *) * size);
+    for(i = 0; i < process->futures_size; i++)
+      for(; process->futures[i]; process->futures[i] = next)
+      {
+	next = process->futures[i]->chain;
+	h = FUTURE_HASH(process->futures[i], size);
+	process->futures[i]->chain = futures[h];
+	futures[h] = process->futures[i];
+      }
+
+    if(process->futures)
+      mem_free(process->futures);
+    process->futures = futures;
+    process->futures_size = size;
+  }
+
+  h = FUTURE_HASH(future, process->futures_size);
+  future->chain = process->futures[h];
+  process->futures[h] = future;
+  process->futures_used++;
+}
+
+/* Drops the futures the process made and never touched.  Those no
+   worker has started to run never will be. */
+void future_forget(struct process *process)
+{
+  struct future *future;
+  INT i;
+
+  for(i = 0; i < process->futures_size; i++)
+    while((future = process->futures[i]))
+    {
+      process->futures[i] = future->chain;
+      if(future_claim(future))
+	copy_destroy(&future->call);
+      future_release(future);
+    }
+
+  if(process->futures)
+    mem_free(process->futures);
+  process->futures = 0;
+  process->futures_size = process->futures_used = 0;
+}
+
+#ifdef PROCESS_PARALLEL
+static void deque_create(struct deque *deque)
+{
+  deque->mask = FUTURE_DEQUE_SIZE - 1;
+  deque->top = deque->bottom = 0;
+  deque->futures = mem_allocate(sizeof(struct future *) *
+				FUTURE_DEQUE_SIZE);
+  pthread_mutex_init(&deque->lock, 0);
+}
+
+static void deque_destroy(struct deque *deque)
+{
+  pthread_mutex_destroy(&deque->lock);
+  mem_free(deque->futures);
+}
+
+/* Adds the future to the bottom of the deque. */
+static void deque_push(struct deque *deque, struct future *future)
+{
+  struct future **futures;
+  UINT mask, i;
+
+  pthread_mutex_lock(&deque->lock);
+
+  if(deque->mask < deque->bottom - deque->top)
+  {
+    mask = 2*deque->mask + 1;
+    futures = mem_allocate(sizeof(struct future *) * (mask + 1));
+    for(i = deque->top; i != deque->bottom; i++)
+      futures[i & mask] = deque->futures[i & deque->mask];
+    mem_free(deque->futures);
+    deque->futures = futures;
+    deque->mask = mask;
+  }
+  deque->futures[deque->bottom++ & deque->mask] = future;
+
+  pthread_mutex_unlock(&deque->lock);
+}
+
+/* Returns the future at the bottom of the deque, or zero. */
+static struct future *deque_pop(struct deque *deque)
+{
+  struct future *future = 0;
+
+  pthread_mutex_lock(&deque->lock);
+  if(deque->top != deque->bottom)
+    future = deque->futures[--deque->bottom & deque->mask];
+  pthread_mutex_unlock(&deque->lock);
+
+  return future;
+}
+
+/* Returns the future at the top of the deque, or zero. */
+static struct future *deque_steal(struct deque *deque)
+{
+  struct future *future = 0;
+
+  pthread_mutex_lock(&deque->lock);
+  if(deque->top != deque->bottom)
+    future = deque->futures[deque->top++ & deque->mask];
+  pthread_mutex_unlock(&deque->lock);
+
+  return future;
+}
+
+/* Returns the next future for the worker to run, its own or one stolen
+   from the others, or zero when there is none. */
+static struct future *pool_take(struct worker *worker)
+{
+  struct pool *pool = worker->pool;
+  struct future *future;
+  INT i;
+
+  future = deque_pop(&worker->deque);
+  for(i = 1; !future && i < pool->size; i++)
+    future = deque_steal(&pool->workers[(worker->id + i) %
+					pool->size].deque);
+
+  if(future)
+    FUTURE_ADD(&pool->pending, -1);
+  return future;
+}
+
+/* Runs the call of the future on the worker, and leaves a copy of its
+   value. */
+static void future_run(struct worker *worker, struct future *future)
+{
+  struct process *process = worker->process;
+
+  process_call(process, &future->call);
+  copy_destroy(&future->call);
+  kernel(process);
+  copy_out(&future->result, &process->reg[REGISTER_VAL], 1);
+
+  FUTURE_BARRIER();
+  future->state = FUTURE_DONE;
+}
+
+static void *pool_work(void *data)
+{
+  struct worker *worker = data;
+  struct future *future;
+  double idle;
+
+  mem_count(&worker->process->allocations);
+  idle = FUTURE_IDLE;
+  while(!worker->pool->stop)
+  {
+    if(!(future = pool_take(worker)))
+    {
+      thread_wait(idle);
+      idle = MIN(2*idle, FUTURE_IDLE_MAX);
+      continue;
+    }
+    idle = FUTURE_IDLE;
+
+    /* The process that made it may have touched it already. */
+    if(future_claim(future))
+      future_run(worker, future);
+    future_release(future);
+  }
+
+  return 0;
+}
+
+/* Returns the pool of the first process, which is started by whichever
+   process first makes a future. */
+static struct pool *pool_create(struct process *process)
+{
+  struct worker *worker;
+  struct pool *pool;
+  INT i;
+
+  pool = mem_allocate_zeroed(sizeof(struct pool));
+  pool->size = MAX(1, MIN(sysconf(_SC_NPROCESSORS_ONLN),
+			  FUTURE_MAX_WORKERS));
+  pool->workers = mem_allocate_zeroed(sizeof(struct worker) * pool->size);
+
+  for(i = 0; i < pool->size; i++)
+  {
+    worker = &pool->workers[i];
+    worker->id = i;
+    worker->pool = pool;
+    worker->process = mem_allocate_zeroed(sizeof(struct process));
+    process_child(worker->process, process);
+    worker->process->pid = -1 - i;
+    worker->process->worker = worker;
+    deque_create(&worker->deque);
+  }
+
+  for(i = 0; i < pool->size; i++)
+    if(pthread_create(&pool->workers[i].thread, 0, pool_work,
+		      &pool->workers[i]))
+      err_fatal("Cannot create a thread for worker %d.", i);
+
+  if(!FUTURE_CAS(&process->root->pool, 0, pool))
+  {
+    /* Another process started one at the same time. */
+    pool_destroy(pool);
+    pool = process->root->pool;
+  }
+
+  return pool;
+}
+#endif /* PROCESS_PARALLEL */
+
+/* Waits for the workers to finish the futures they run, and drops
+   those they have not started. */
+void pool_destroy(struct pool *pool)
+{
+#ifdef PROCESS_PARALLEL
+  struct future *future;
+  struct worker *worker;
+  INT i;
+
+  pool->stop = 1;
+  for(i = 0; i < pool->size; i++)
+    pthread_join(pool->workers[i].thread, 0);
+
+  for(i = 0; i < pool->size; i++)
+  {
+    worker = &pool->workers[i];
+    while((future = deque_pop(&worker->deque)))
+      future_release(future);
+    deque_destroy(&worker->deque);
+  }
+
+  for(i = 0; i < pool->size; i++)
+  {
+    worker = &pool->workers[i];
+    mem_count_add(worker->process->allocations);
+    process_destroy(worker->process);
+    mem_free(worker->process);
+  }
+
+  mem_free(pool->workers);
+  mem_free(pool);
+#endif /* PROCESS_PARALLEL */
+}
+
+/* Returns a future of calling the given procedure without arguments.
+   It is queued for the workers while they have room for it. */
+BIF_DECLARE(bif_future_spawn)
+{
+  struct svalue *procedure;
+  struct future *future;
+#ifdef PROCESS_PARALLEL
+  struct pool *pool;
+  struct deque *deque;
+#endif /* PROCESS_PARALLEL */
+
+  ARGS_GET((process, "future-spawn", args, "%*", &procedure));
+
+  if(IS_NOT_LAMBDA(*procedure))
+    ARGS_ERROR((process, "future-spawn", "Procedure expected."));
+
+  future = mem_allocate_zeroed(sizeof(struct future));
+  future->state = FUTURE_PENDING;
+  future->references = 1;
+  future_remember(process, future);
+
+#ifdef PROCESS_PARALLEL
+  if(!(pool = process->root->pool))
+    pool = pool_create(process);
+
+  if(pool->pending < FUTURE_QUEUE * pool->size)
+  {
+    process_copy_call(process, procedure, &future->call);
+    future->references++;
+    FUTURE_ADD(&pool->pending, 1);
+
+    /* A worker runs its own futures first, as they are likely to be
+       touched soon. */
+    if(process->worker)
+      deque = &process->worker->deque;
+    else
+      deque = &pool->workers[FUTURE_ADD(&pool->next, 1) %
+			     pool->size].deque;
+    deque_push(deque, future);
+  }
+#endif /* PROCESS_PARALLEL */
+
+  BIF_RESULT_FUTURE(future);
+}
+
+/* Returns true when the process is to call the procedure of the future
+   itself, as no worker has started to, a list of a copy of the value a
+   worker returned, or false after the running thread starts to wait
+   for the worker.  A future can only be touched once, by the process
+   that made it. */
+BIF_DECLARE(bif_future_touch)
+{
+  struct future **slot, *future;
+  struct svalue undefined, nil;
+
+  ARGS_GET((process, "future-touch", args, "%F", &future));
+
+  if(!(slot = future_find(process, future)))
+    ARGS_ERROR((process, "future-touch",
+		"Future not made by this process, or already touched."));
+
+  if(future_claim(future))
+  {
+    copy_destroy(&future->call);
+    BIF_RESULT_TRUE();
+  }
+  else if(future->state == FUTURE_DONE)
+  {
+    /* The list holds the value while the rest of it is copied in. */
+    FUTURE_BARRIER();
+    undefined.type = T_UNDEFINED;
+    nil.type = T_NIL;
+    result->u.pair = pair_cons(process, &undefined, &nil);
+    result->type = T_PAIR;
+    copy_in(process, &future->result, &CAR(result->u.pair));
+  }
+  else
+  {
+    thread_sleep(process, FUTURE_POLL);
+    BIF_RESULT_FALSE();
+    return;
+  }
+
+  *slot = future->chain;
+  process->futures_used--;
+  future_release(future);
+}
+
+/* Returns the number of workers that futures are run by, which is zero
+   when they are all run as they are touched. */
+BIF_DECLARE(bif_future_workers)
+{
+#ifdef PROCESS_PARALLEL
+  struct pool *pool;
+#endif /* PROCESS_PARALLEL */
+
+  ARGS_GET((process, "future-workers", args, ""));
+
+#ifdef PROCESS_PARALLEL
+  if(!(pool = process->root->pool))
+    pool = pool_create(process);
+  BIF_RESULT_SMALL_INTEGER(pool->size);
+#else
+  BIF_RESULT_SMALL_INTEGER(0);
+#endif /* PROCESS_PARALLEL */
+}
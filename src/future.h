@@ -0,0 +1,97 @@
+/* future.h
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the future module.
+ */
+
+#ifndef __FUTURE_H__
+#define __FUTURE_H__
+
+#include "types.h"
+
+#include "bif.h"
+#include "copy.h"
+#include "process.h"
+
+#define FUTURE_PENDING 0
+#define FUTURE_RUNNING 1
+#define FUTURE_DONE    2
+
+/* The most workers a pool has, whatever the number of processors. */
+#define FUTURE_MAX_WORKERS 64
+
+/* Futures queued per worker at most.  Those made while the queues are
+   full are run when touched instead, without being copied. */
+#define FUTURE_QUEUE 4
+
+/* Seconds a thread waits before it looks at a future a worker runs
+   again. */
+#define FUTURE_POLL 0.0001
+
+/* Seconds an idle worker first waits before it looks for work again,
+   and at most, as it waits twice as long each time it finds none. */
+#define FUTURE_IDLE     0.00005
+#define FUTURE_IDLE_MAX 0.005
+
+/* A call made in one process that a worker may run in parallel, see
+   future.c.  It is kept until the process that made it has touched it,
+   and no worker has it in its deque. */
+struct future
+{
+  volatile INT state;
+  volatile INT references;
+
+  /* The call to run, and then a copy of the value it returned. */
+  struct copy call;
+  struct copy result;
+
+  /* The next future in the same slot of the table of the process that
+     made it. */
+  struct future *chain;
+};
+
+/* The futures a worker runs next, from the bottom, and that other
+   workers steal, from the top. */
+struct deque
+{
+  UINT mask, top, bottom;
+  struct future **futures;
+
+#ifdef PROCESS_PARALLEL
+  pthread_mutex_t lock;
+#endif /* PROCESS_PARALLEL */
+};
+
+struct worker
+{
+  INT id;
+  struct pool *pool;
+  struct process *process;
+  struct deque deque;
+
+#ifdef PROCESS_PARALLEL
+  pthread_t thread;
+#endif /* PROCESS_PARALLEL */
+};
+
+/* The fixed number of workers of the first process, which futures made
+   in any process are run by. */
+struct pool
+{
+  INT size;
+  struct worker *workers;
+
+  volatile INT stop;
+  volatile INT pending;
+  volatile UINT next;
+};
+
+void future_forget(struct process *process);
+void pool_destroy(struct pool *pool);
+
+BIF_DECLARE(bif_future_spawn);
+BIF_DECLARE(bif_future_touch);
+BIF_DECLARE(bif_future_workers);
+
+#endif /* __FUTURE_H__ */
@@ -84,6 +84,7 @@ static void mark(struct svalue *svalue)
     
   case T_LABEL:
   case T_VECTOR:
+  case T_VALUES:
     length = svalue->u.vec->length;
     VEC_MARK(svalue->u.vec);   /* The length of the vector is modified... */
     svalue = svalue->u.vec->v;
@@ -160,6 +161,7 @@ static void copy(struct pair_heap *heap, struct svalue *svalue)
     
   case T_LABEL:
   case T_VECTOR:
+  case T_VALUES:
     length = svalue->u.vec->length;
     VEC_MARK(svalue->u.vec);   /* The length of the vector is modified... */
     svalue = svalue->u.vec->v;
@@ -189,6 +191,34 @@ static void copy(struct pair_heap *heap, struct svalue *svalue)
   }
 }
 
+/* Applies f to the registers, stack, traps and program of a thread that
+   is not running, or to the value of one that is done. */
+#define THREAD_ROOTS(thread, f)                                            \
+        do {                                                               \
+          INT j_;                                                          \
+          if((thread)->state == THREAD_DONE)                               \
+            f(&(thread)->result);                                          \
+          else if((thread)->state != THREAD_FREE)                          \
+          {                                                                \
+            for(j_ = 0; j_ < N_REGISTERS; j_++)                            \
+              f(&(thread)->reg[j_]);                                       \
+            for(j_ = 0; j_ < N_TRAPS; j_++)                                \
+              f(&(thread)->trap[j_]);                                      \
+            for(j_ = 0; j_ < (thread)->stack.used; j_++)                   \
+              f(&(thread)->stack.s[j_]);                                   \
+            f(&(thread)->program);                                         \
+          }                                                                \
+        } while(0)
+
+#define MARK_ROOT(svalue)                                                  \
+        do {                                                               \
+          mark(svalue);                                                    \
+          UNMARK(svalue);                                                  \
+        } while(0)
+
+#define COPY_ROOT(svalue)                                                  \
+        copy(heap, svalue)
+
 void garb(struct process *process)
 {
   int i;
@@ -205,14 +235,38 @@ void garb(struct process *process)
     UNMARK(&process->trap[i]);
   }
   
-  mark(&process->stack);
-  UNMARK(&process->stack);
+  for(i = 0; i < process->stack.used; i++)
+  {
+    mark(&process->stack.s[i]);
+    UNMARK(&process->stack.s[i]);
+  }
 
   mark(&process->error);
   UNMARK(&process->error);
   
   mark(&process->program);
   UNMARK(&process->program);
+
+  mark(&process->native_code);
+  UNMARK(&process->native_code);
+
+  for(i = 0; i < process->jit.roots_used; i++)
+  {
+    mark(&process->jit.roots[i]);
+    UNMARK(&process->jit.roots[i]);
+  }
+
+  for(i = 0; i < process->threads.used; i++)
+    if(i != process->threads.current)
+      THREAD_ROOTS(&process->threads.threads[i], MARK_ROOT);
+
+  for(i = 0; i < process->profile.programs_used; i++)
+  {
+    mark(&process->profile.programs[i].program);
+    UNMARK(&process->profile.programs[i].program);
+    mark(&process->profile.programs[i].code);
+    UNMARK(&process->profile.programs[i].code);
+  }
   
   pair_sweep(&process->pair_heap);
   map_sweep(&process->map_heap);
@@ -247,9 +301,25 @@ void garb_and_reduce(struct process *process)
     for(i = 0; i < N_TRAPS; i++)
       copy(heap, &process->trap[i]);
     
-    copy(heap, &process->stack);
+    for(i = 0; i < process->stack.used; i++)
+      copy(heap, &process->stack.s[i]);
+    
     copy(heap, &process->error);
     copy(heap, &process->program);
+    copy(heap, &process->native_code);
+
+    for(i = 0; i < process->jit.roots_used; i++)
+      copy(heap, &process->jit.roots[i]);
+
+    for(i = 0; i < process->threads.used; i++)
+      if(i != process->threads.current)
+	THREAD_ROOTS(&process->threads.threads[i], COPY_ROOT);
+
+    for(i = 0; i < process->profile.programs_used; i++)
+    {
+      copy(heap, &process->profile.programs[i].program);
+      copy(heap, &process->profile.programs[i].code);
+    }
 
     for(i = 0; i < N_REGISTERS; i++)
       UNMARK(&process->reg[i]);
@@ -257,9 +327,25 @@ void garb_and_reduce(struct process *process)
     for(i = 0; i < N_TRAPS; i++)
       UNMARK(&process->trap[i]);
   
-    UNMARK(&process->stack);
+    for(i = 0; i < process->stack.used; i++)
+      UNMARK(&process->stack.s[i]);
+    
     UNMARK(&process->error);
     UNMARK(&process->program);
+    UNMARK(&process->native_code);
+
+    for(i = 0; i < process->jit.roots_used; i++)
+      UNMARK(&process->jit.roots[i]);
+
+    for(i = 0; i < process->threads.used; i++)
+      if(i != process->threads.current)
+	THREAD_ROOTS(&process->threads.threads[i], UNMARK);
+
+    for(i = 0; i < process->profile.programs_used; i++)
+    {
+      UNMARK(&process->profile.programs[i].program);
+      UNMARK(&process->profile.programs[i].code);
+    }
     
     map_sweep(&process->map_heap);
     str_sweep(&process->str_heap);
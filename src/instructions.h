@@ -20,8 +20,6 @@
 #define I_assign_true          	9
 #define I_assign_false         10
 #define I_assign_small_integer 11
-#define I_assign_string        12
-#define I_assign_symbol        13
 #define I_assign_bif           14
 #define I_assign_lambda        15
 #define I_assign_label         16
@@ -37,8 +35,58 @@
 #define I_env_extend           26
 #define I_assign_undefined     27
 #define I_assign_character     28
-#define I_assign_float         29
 #define I_load_env             30
-#define I_assign_big_integer   31
+
+/* Superinstructions, each fusing a sequence the compiler emits often. */
+#define I_save2                32
+#define I_restore2             33
+#define I_get_list             34
+#define I_get_cons             35
+#define I_call_bif             36
+#define I_call_lambda          37
+
+/* Variable access specialized on the frame and slot. */
+#define I_get0_0               38
+#define I_get0_1               39
+#define I_get0_2               40
+#define I_get0_3               41
+#define I_get0                 42
+#define I_get1                 43
+#define I_get_top              44
+#define I_set0                 45
+#define I_set1                 46
+#define I_set_top              47
+
+/* Arguments passed in a vector which becomes the callee's frame. */
+#define I_arg_first            48
+#define I_arg                  49
+
+/* Two-operand BIFs done inline on small integers. */
+#define I_plus                 50
+#define I_minus                51
+#define I_times                52
+#define I_less                 53
+#define I_eq                   54
+
+/* One-operand BIFs on pairs and truth values.  cons uses I_cons. */
+#define I_car                  55
+#define I_cdr                  56
+#define I_nullp                57
+#define I_pairp                58
+#define I_not                  59
+
+/* Literals materialized by load-program, see program.h. */
+#define I_assign_constant      60
+
+/* Calls with an escape procedure, see kernel_call_ec. */
+#define I_call_ec              61
+
+/* Resumes and leaves generators, see kernel_generator_resume. */
+#define I_generator_resume     62
+#define I_generator_yield      63
+
+/* Makes and gives multiple values, see kernel_values. */
+#define I_values               64
+#define I_argl_values          65
 
 #endif /* __INSTRUCTIONS_H__ */
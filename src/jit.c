@@ -0,0 +1,910 @@
+/* jit.c
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the native code compiler module.
+ */
+
+#define MODULE_DEBUG 0
+#define MODULE_NAME  "jit"
+
+#include <stddef.h>
+
+#include "types.h"
+
+#include "args.h"
+#include "bif.h"
+#include "err.h"
+#include "jit.h"
+#include "mem.h"
+#include "process.h"
+#include "program.h"
+#include "stack.h"
+#include "str.h"
+#include "vec.h"
+
+#include "instructions.h"
+
+#ifdef USE_JIT
+#include <sys/mman.h>
+#include <unistd.h>
+#endif /* USE_JIT */
+
+/* The table size is a power of two. */
+#define JIT_INITIAL_SIZE 64
+
+#define JIT_HASH(jit, pc)                                                  \
+        ((INT)(((unsigned long)(pc) / BYTECODE_WORD) & ((jit)->size - 1)))
+
+void jit_create(struct jit *jit)
+{
+  jit->enabled = 0;
+
+  jit->size = JIT_INITIAL_SIZE;
+  jit->entries = 0;
+  jit->hash = mem_allocate_zeroed(sizeof(struct jit_entry *) * jit->size);
+
+  jit->roots_size = 0;
+  jit->roots_used = 0;
+  jit->roots = 0;
+}
+
+void jit_destroy(struct jit *jit)
+{
+  struct jit_entry *entry, *next;
+  INT i;
+
+  for(i = 0; i < jit->size; i++)
+    for(entry = jit->hash[i]; entry; entry = next)
+    {
+      next = entry->next;
+#ifdef USE_JIT
+      if(entry->native)
+	munmap((void *)entry->native, entry->size);
+#endif /* USE_JIT */
+      mem_free(entry);
+    }
+
+  mem_free(jit->hash);
+  if(jit->roots)
+    mem_free(jit->roots);
+}
+
+static void jit_rehash(struct jit *jit)
+{
+  struct jit_entry **hash, *entry, *next;
+  INT size, i, h;
+
+  hash = jit->hash;
+  size = jit->size;
+
+  jit->size *= 2;
+  jit->hash = mem_allocate_zeroed(sizeof(struct jit_entry *) * jit->size);
+
+  for(i = 0; i < size; i++)
+    for(entry = hash[i]; entry; entry = next)
+    {
+      next = entry->next;
+      h = JIT_HASH(jit, entry->pc);
+      entry->next = jit->hash[h];
+      jit->hash[h] = entry;
+    }
+
+  mem_free(hash);
+}
+
+#ifdef USE_JIT
+
+/*
+ * The compiler translates the instructions reachable from the start of
+ * a lambda body one by one into x86-64 code working directly on the
+ * process structure, which is passed in rdi.  Only instructions that
+ * neither allocate nor call are translated, and then only their common
+ * cases.  Everything else makes the native code return the program
+ * counter of the instruction, so the kernel runs it as usual.  Nothing
+ * is changed before such an exit, which keeps the semantics exactly
+ * those of the kernel.  Branches within the translated instructions
+ * become native jumps.
+ */
+
+#define JIT_MAX_INSTRUCTIONS 1024
+
+#define RAX 0
+#define RCX 1
+#define RDX 2
+#define RDI 7
+
+#define CC_O  0x0
+#define CC_E  0x4
+#define CC_NE 0x5
+#define CC_L  0xc
+#define CC_LE 0xe
+#define CC_G  0xf
+#define JMP   -1
+
+#define OPCODE(pc)      ((INT)(pc)[0])
+#define REGISTER(pc, i) ((INT)(pc)[i])
+#define OPERAND(pc, i)  (((INT *)(pc))[i])
+
+#define DISP_U           ((INT)offsetof(struct svalue, u))
+#define DISP_CAR         ((INT)offsetof(struct pair, car))
+#define DISP_CDR         ((INT)offsetof(struct pair, cdr))
+#define DISP_LENGTH      ((INT)offsetof(struct vec, length))
+#define DISP_SLOT(n)                                                       \
+        ((INT)(offsetof(struct vec, v) + (n)*sizeof(struct svalue)))
+#define DISP_REG(r)                                                        \
+        ((INT)(offsetof(struct process, reg) + (r)*sizeof(struct svalue)))
+#define DISP_PROGRAM     ((INT)offsetof(struct process, program))
+#define DISP_STACK_SIZE                                                    \
+        ((INT)(offsetof(struct process, stack) + offsetof(struct stack, size)))
+#define DISP_STACK_USED                                                    \
+        ((INT)(offsetof(struct process, stack) + offsetof(struct stack, used)))
+#define DISP_STACK_S                                                       \
+        ((INT)(offsetof(struct process, stack) + offsetof(struct stack, s)))
+
+struct jit_state
+{
+  struct process *process;
+
+  /* The bytecode being translated. */
+  UBYTE *base;
+  INT length;
+
+  /* The native code being generated. */
+  UBYTE *code;
+  INT used, size;
+
+  /* Native positions of labels, -1 until bound.  Each bytecode word
+     that is jumped to, and each instruction that may exit, gets one. */
+  INT *labels;
+  INT n_labels, labels_size;
+  INT *bytecode_labels;
+  INT *exit_labels;
+
+  /* Positions of jump offsets to patch, and their labels. */
+  INT *fixups;
+  INT n_fixups, fixups_size;
+
+  /* Bytecode offsets still to translate. */
+  INT *work;
+  INT n_work;
+
+  INT instructions;
+  INT fallthrough;
+};
+
+static void emit_byte(struct jit_state *s, INT b)
+{
+  if(s->used == s->size)
+  {
+    s->size *= 2;
+    s->code = mem_reallocate(s->code, s->size);
+  }
+  s->code[s->used++] = b;
+}
+
+static void emit_int(struct jit_state *s, INT x)
+{
+  emit_byte(s, x & 0xff);
+  emit_byte(s, (x >> 8) & 0xff);
+  emit_byte(s, (x >> 16) & 0xff);
+  emit_byte(s, (x >> 24) & 0xff);
+}
+
+/* Operand [base+disp32] with r in the reg field. */
+static void emit_modrm(struct jit_state *s, INT r, INT base, INT disp)
+{
+  emit_byte(s, 0x80 | (r << 3) | base);
+  emit_int(s, disp);
+}
+
+/* mov r64, [base+disp] */
+static void emit_load(struct jit_state *s, INT r, INT base, INT disp)
+{
+  emit_byte(s, 0x48);
+  emit_byte(s, 0x8b);
+  emit_modrm(s, r, base, disp);
+}
+
+/* mov [base+disp], r64 */
+static void emit_store(struct jit_state *s, INT base, INT disp, INT r)
+{
+  emit_byte(s, 0x48);
+  emit_byte(s, 0x89);
+  emit_modrm(s, r, base, disp);
+}
+
+/* op r32, [base+disp] where op is one or two opcode bytes. */
+static void emit_op32(struct jit_state *s, INT op, INT r, INT base, INT disp)
+{
+  if(op > 0xff)
+    emit_byte(s, op >> 8);
+  emit_byte(s, op & 0xff);
+  emit_modrm(s, r, base, disp);
+}
+
+#define OP_ADD   0x03
+#define OP_SUB   0x2b
+#define OP_CMP   0x3b
+#define OP_LOAD  0x8b
+#define OP_STORE 0x89
+#define OP_IMUL  0x0faf
+#define OP_MOVZB 0x0fb6
+
+/* cmp byte [base+disp], type */
+static void emit_type_compare(struct jit_state *s, INT base, INT disp,
+			      INT type)
+{
+  emit_byte(s, 0x80);
+  emit_modrm(s, 7, base, disp);
+  emit_byte(s, type);
+}
+
+/* mov byte [base+disp], type */
+static void emit_type_set(struct jit_state *s, INT base, INT disp, INT type)
+{
+  emit_byte(s, 0xc6);
+  emit_modrm(s, 0, base, disp);
+  emit_byte(s, type);
+}
+
+/* mov dword [base+disp], x */
+static void emit_set32(struct jit_state *s, INT base, INT disp, INT x)
+{
+  emit_byte(s, 0xc7);
+  emit_modrm(s, 0, base, disp);
+  emit_int(s, x);
+}
+
+/* cmp dword [base+disp], x */
+static void emit_compare32(struct jit_state *s, INT base, INT disp, INT x)
+{
+  emit_byte(s, 0x81);
+  emit_modrm(s, 7, base, disp);
+  emit_int(s, x);
+}
+
+/* Copies an svalue through rax and rdx. */
+static void emit_copy(struct jit_state *s, INT base, INT disp,
+		      INT from_base, INT from_disp)
+{
+  emit_load(s, RAX, from_base, from_disp);
+  emit_load(s, RDX, from_base, from_disp + 8);
+  emit_store(s, base, disp, RAX);
+  emit_store(s, base, disp + 8, RDX);
+}
+
+/* mov rax, pc; ret */
+static void emit_return(struct jit_state *s, UBYTE *pc)
+{
+  unsigned long x = (unsigned long)pc;
+  INT i;
+
+  emit_byte(s, 0x48);
+  emit_byte(s, 0xb8);
+  for(i = 0; i < 8; i++)
+    emit_byte(s, (x >> 8*i) & 0xff);
+  emit_byte(s, 0xc3);
+}
+
+static INT new_label(struct jit_state *s)
+{
+  if(s->n_labels == s->labels_size)
+  {
+    s->labels_size *= 2;
+    s->labels = mem_reallocate(s->labels, sizeof(INT) * s->labels_size);
+  }
+  s->labels[s->n_labels] = -1;
+  return s->n_labels++;
+}
+
+static void bind_label(struct jit_state *s, INT label)
+{
+  s->labels[label] = s->used;
+}
+
+/* jcc or jmp rel32 to a label, patched when the code is complete. */
+static void emit_jump(struct jit_state *s, INT cc, INT label)
+{
+  if(cc == JMP)
+    emit_byte(s, 0xe9);
+  else
+  {
+    emit_byte(s, 0x0f);
+    emit_byte(s, 0x80 | cc);
+  }
+
+  if(s->n_fixups + 2 > s->fixups_size)
+  {
+    s->fixups_size *= 2;
+    s->fixups = mem_reallocate(s->fixups, sizeof(INT) * s->fixups_size);
+  }
+  s->fixups[s->n_fixups++] = s->used;
+  s->fixups[s->n_fixups++] = label;
+  emit_int(s, 0);
+}
+
+/* The label of the native code for the bytecode at offset o, which is
+   queued for translation the first time it is asked for. */
+static INT bytecode_label(struct jit_state *s, INT o)
+{
+  INT *label = &s->bytecode_labels[o / BYTECODE_WORD];
+
+  if(*label < 0)
+  {
+    *label = new_label(s);
+    s->work[s->n_work++] = o;
+  }
+  return *label;
+}
+
+/* The label of code returning to the kernel at the instruction at o. */
+static INT exit_label(struct jit_state *s, INT o)
+{
+  INT *label = &s->exit_labels[o / BYTECODE_WORD];
+
+  if(*label < 0)
+    *label = new_label(s);
+  return *label;
+}
+
+static INT valid_target(struct jit_state *s, INT o)
+{
+  return BYTECODE_HEADER_SIZE <= o && o < s->length &&
+    (o & (BYTECODE_WORD-1)) == 0;
+}
+
+/* Exits at o unless the vector in rcx has slot n. */
+static void emit_slot_check(struct jit_state *s, INT o, INT n)
+{
+  if(n < 0)
+  {
+    emit_jump(s, JMP, exit_label(s, o));
+    return;
+  }
+  emit_compare32(s, RCX, DISP_LENGTH, n);
+  emit_jump(s, CC_LE, exit_label(s, o));
+}
+
+/* Loads the frame vector of the current environment (depth 0), its
+   parent (depth 1) or the program (depth -1) into rcx.  Exits at o
+   unless the environments are pairs and the frame has slot n, as the
+   kernel checks them, see CHECK_SLOT. */
+static void emit_frame(struct jit_state *s, INT o, INT depth, INT n)
+{
+  INT exit = exit_label(s, o);
+
+  if(depth < 0)
+  {
+    emit_load(s, RCX, RDI, DISP_PROGRAM + DISP_U);
+    emit_type_compare(s, RCX, DISP_SLOT(PROGRAM_ENV), T_PAIR);
+    emit_jump(s, CC_NE, exit);
+    emit_load(s, RCX, RCX, DISP_SLOT(PROGRAM_ENV) + DISP_U);
+  }
+  else
+  {
+    emit_type_compare(s, RDI, DISP_REG(REGISTER_ENV), T_PAIR);
+    emit_jump(s, CC_NE, exit);
+    emit_load(s, RCX, RDI, DISP_REG(REGISTER_ENV) + DISP_U);
+    if(depth)
+    {
+      emit_type_compare(s, RCX, DISP_CAR, T_PAIR);
+      emit_jump(s, CC_NE, exit);
+      emit_load(s, RCX, RCX, DISP_CAR + DISP_U);
+    }
+  }
+  emit_type_compare(s, RCX, DISP_CDR, T_VECTOR);
+  emit_jump(s, CC_NE, exit);
+  emit_load(s, RCX, RCX, DISP_CDR + DISP_U);
+  emit_slot_check(s, o, n);
+}
+
+/* Loads the address of the top free stack slot into rcx. */
+static void emit_stack_slot(struct jit_state *s)
+{
+  emit_op32(s, OP_LOAD, RAX, RDI, DISP_STACK_USED);
+  emit_byte(s, 0x48);                             /* shl rax, 4 */
+  emit_byte(s, 0xc1);
+  emit_byte(s, 0xe0);
+  emit_byte(s, 4);
+  emit_load(s, RCX, RDI, DISP_STACK_S);
+  emit_byte(s, 0x48);                             /* add rcx, rax */
+  emit_byte(s, 0x01);
+  emit_byte(s, 0xc1);
+}
+
+/* Exits at o unless n more registers fit on the stack. */
+static void emit_stack_check(struct jit_state *s, INT o, INT n)
+{
+  emit_op32(s, OP_LOAD, RAX, RDI, DISP_STACK_USED);
+  emit_byte(s, 0x83);                             /* add eax, n */
+  emit_byte(s, 0xc0);
+  emit_byte(s, n);
+  emit_op32(s, OP_CMP, RAX, RDI, DISP_STACK_SIZE);
+  emit_jump(s, CC_G, exit_label(s, o));
+}
+
+static void emit_push(struct jit_state *s, INT reg)
+{
+  emit_stack_slot(s);
+  emit_copy(s, RCX, 0, RDI, DISP_REG(reg));
+  emit_byte(s, 0xff);                             /* inc dword used */
+  emit_modrm(s, 0, RDI, DISP_STACK_USED);
+}
+
+static void emit_pop(struct jit_state *s, INT reg)
+{
+  emit_byte(s, 0xff);                             /* dec dword used */
+  emit_modrm(s, 1, RDI, DISP_STACK_USED);
+  emit_stack_slot(s);
+  emit_copy(s, RDI, DISP_REG(reg), RCX, 0);
+}
+
+/* reg = test ? #t : #f, where the flags are already set by a compare. */
+static void emit_truth(struct jit_state *s, INT reg, INT cc)
+{
+  INT done = new_label(s);
+
+  emit_type_set(s, RDI, DISP_REG(reg), T_TRUE);
+  emit_jump(s, cc, done);
+  emit_type_set(s, RDI, DISP_REG(reg), T_FALSE);
+  bind_label(s, done);
+}
+
+static void emit_eq(struct jit_state *s, INT o, INT reg, INT reg2, INT reg3)
+{
+  static const INT integers[] = { T_SMALL_INTEGER, T_CHAR };
+  static const INT pointers[] = { T_PAIR, T_SYMBOL, T_STRING, T_LAMBDA,
+				  T_VECTOR, T_MAPPING, T_BIF };
+  static const INT constants[] = { T_NIL, T_TRUE, T_FALSE, T_UNDEFINED };
+  INT integer, pointer, yes, no, done;
+  UINT i;
+
+  integer = new_label(s);
+  pointer = new_label(s);
+  yes = new_label(s);
+  no = new_label(s);
+  done = new_label(s);
+
+  /* Different types are never eq?, as in svalue_eq. */
+  emit_op32(s, OP_MOVZB, RAX, RDI, DISP_REG(reg2));
+  emit_op32(s, OP_MOVZB, RDX, RDI, DISP_REG(reg3));
+  emit_byte(s, 0x39);                             /* cmp eax, edx */
+  emit_byte(s, 0xd0);
+  emit_jump(s, CC_NE, no);
+
+#define EQ_CASES(types, label)                                             \
+        for(i = 0; i < sizeof(types)/sizeof(types[0]); i++)               \
+        {                                                                  \
+          emit_byte(s, 0x3c);                     /* cmp al, type */       \
+          emit_byte(s, types[i]);                                          \
+          emit_jump(s, CC_E, label);                                       \
+        }
+
+  EQ_CASES(integers, integer);
+  EQ_CASES(pointers, pointer);
+  EQ_CASES(constants, yes);
+
+  /* Floats and big integers are left to the kernel. */
+  emit_jump(s, JMP, exit_label(s, o));
+
+  bind_label(s, integer);
+  emit_op32(s, OP_LOAD, RAX, RDI, DISP_REG(reg2) + DISP_U);
+  emit_op32(s, OP_CMP, RAX, RDI, DISP_REG(reg3) + DISP_U);
+  emit_jump(s, CC_NE, no);
+  emit_jump(s, JMP, yes);
+
+  bind_label(s, pointer);
+  emit_load(s, RAX, RDI, DISP_REG(reg2) + DISP_U);
+  emit_byte(s, 0x48);
+  emit_op32(s, OP_CMP, RAX, RDI, DISP_REG(reg3) + DISP_U);
+  emit_jump(s, CC_NE, no);
+
+  bind_label(s, yes);
+  emit_type_set(s, RDI, DISP_REG(reg), T_TRUE);
+  emit_jump(s, JMP, done);
+
+  bind_label(s, no);
+  emit_type_set(s, RDI, DISP_REG(reg), T_FALSE);
+  bind_label(s, done);
+}
+
+/* reg = reg2 op reg3 on small integers, exiting on anything else. */
+static void emit_arithmetic(struct jit_state *s, INT o, INT op,
+			    INT reg, INT reg2, INT reg3)
+{
+  INT exit = exit_label(s, o);
+
+  emit_type_compare(s, RDI, DISP_REG(reg2), T_SMALL_INTEGER);
+  emit_jump(s, CC_NE, exit);
+  emit_type_compare(s, RDI, DISP_REG(reg3), T_SMALL_INTEGER);
+  emit_jump(s, CC_NE, exit);
+  emit_op32(s, OP_LOAD, RAX, RDI, DISP_REG(reg2) + DISP_U);
+
+  if(op == OP_CMP)
+  {
+    emit_op32(s, OP_CMP, RAX, RDI, DISP_REG(reg3) + DISP_U);
+    emit_truth(s, reg, CC_L);
+    return;
+  }
+
+  emit_op32(s, op, RAX, RDI, DISP_REG(reg3) + DISP_U);
+  emit_jump(s, CC_O, exit);
+  emit_op32(s, OP_STORE, RAX, RDI, DISP_REG(reg) + DISP_U);
+  emit_type_set(s, RDI, DISP_REG(reg), T_SMALL_INTEGER);
+}
+
+/* Translates the instruction at offset o and returns its length in
+   bytes, or zero if it is left to the kernel. */
+static INT jit_instruction(struct jit_state *s, INT o)
+{
+  UBYTE *pc = s->base + o;
+  struct svalue *constants;
+  INT reg, reg2, reg3, n;
+
+  if(s->length < o + 3*BYTECODE_WORD)
+    return 0;
+
+  reg = REGISTER(pc, 1);
+  reg2 = REGISTER(pc, 2);
+  reg3 = REGISTER(pc, 3);
+  if(N_REGISTERS <= reg || N_REGISTERS <= reg2 || N_REGISTERS <= reg3)
+    return 0;
+
+  switch(OPCODE(pc))
+  {
+  case I_assign:
+    emit_copy(s, RDI, DISP_REG(reg), RDI, DISP_REG(reg2));
+    return BYTECODE_WORD;
+
+  case I_assign_nil:
+    emit_type_set(s, RDI, DISP_REG(reg), T_NIL);
+    return BYTECODE_WORD;
+
+  case I_assign_true:
+    emit_type_set(s, RDI, DISP_REG(reg), T_TRUE);
+    return BYTECODE_WORD;
+
+  case I_assign_false:
+    emit_type_set(s, RDI, DISP_REG(reg), T_FALSE);
+    return BYTECODE_WORD;
+
+  case I_assign_undefined:
+    emit_type_set(s, RDI, DISP_REG(reg), T_UNDEFINED);
+    return BYTECODE_WORD;
+
+  case I_assign_small_integer:
+  case I_assign_character:
+    emit_set32(s, RDI, DISP_REG(reg) + DISP_U, OPERAND(pc, 1));
+    emit_type_set(s, RDI, DISP_REG(reg),
+		  OPCODE(pc) == I_assign_character ? T_CHAR : T_SMALL_INTEGER);
+    return 2*BYTECODE_WORD;
+
+  case I_assign_constant:
+    n = OPERAND(pc, 1);
+    constants =
+      &s->process->program.u.vec->v[PROGRAM_CONSTANTS];
+    if(IS_NOT_VECTOR(*constants) || n < 0 || constants->u.vec->length <= n)
+      return 0;
+    emit_load(s, RCX, RDI, DISP_PROGRAM + DISP_U);
+    emit_load(s, RCX, RCX, DISP_SLOT(PROGRAM_CONSTANTS) + DISP_U);
+    emit_copy(s, RDI, DISP_REG(reg), RCX, DISP_SLOT(n));
+    return 2*BYTECODE_WORD;
+
+  case I_assign_label:
+    /* The label, as the aux field, shares the first word with the type. */
+    emit_set32(s, RDI, DISP_REG(REGISTER_CONT),
+	       (OPERAND(pc, 1) << 8) | T_LABEL);
+    emit_load(s, RAX, RDI, DISP_PROGRAM + DISP_U);
+    emit_store(s, RDI, DISP_REG(REGISTER_CONT) + DISP_U, RAX);
+    return 2*BYTECODE_WORD;
+
+  case I_get0_0:
+  case I_get0_1:
+  case I_get0_2:
+  case I_get0_3:
+    n = OPCODE(pc) - I_get0_0;
+    emit_frame(s, o, 0, n);
+    emit_copy(s, RDI, DISP_REG(reg), RCX, DISP_SLOT(n));
+    return BYTECODE_WORD;
+
+  case I_get0:
+  case I_get1:
+  case I_get_top:
+    n = OPERAND(pc, 1);
+    emit_frame(s, o, OPCODE(pc) == I_get_top ? -1 : OPCODE(pc) - I_get0, n);
+    emit_copy(s, RDI, DISP_REG(reg), RCX, DISP_SLOT(n));
+    return 2*BYTECODE_WORD;
+
+  case I_set0:
+  case I_set1:
+  case I_set_top:
+    n = OPERAND(pc, 1);
+    emit_frame(s, o, OPCODE(pc) == I_set_top ? -1 : OPCODE(pc) - I_set0, n);
+    emit_copy(s, RCX, DISP_SLOT(n), RDI, DISP_REG(reg));
+    emit_type_set(s, RDI, DISP_REG(reg), T_UNDEFINED);
+    return 2*BYTECODE_WORD;
+
+  case I_arg:
+    n = OPERAND(pc, 1);
+    emit_type_compare(s, RDI, DISP_REG(reg), T_VECTOR);
+    emit_jump(s, CC_NE, exit_label(s, o));
+    emit_load(s, RCX, RDI, DISP_REG(reg) + DISP_U);
+    emit_slot_check(s, o, n);
+    emit_copy(s, RCX, DISP_SLOT(n), RDI, DISP_REG(reg2));
+    return 2*BYTECODE_WORD;
+
+  case I_save:
+    emit_stack_check(s, o, 1);
+    emit_push(s, reg);
+    return BYTECODE_WORD;
+
+  case I_save2:
+    emit_stack_check(s, o, 2);
+    emit_push(s, reg);
+    emit_push(s, reg2);
+    return BYTECODE_WORD;
+
+  case I_restore:
+    emit_pop(s, reg);
+    return BYTECODE_WORD;
+
+  case I_restore2:
+    emit_pop(s, reg);
+    emit_pop(s, reg2);
+    return BYTECODE_WORD;
+
+  case I_plus:
+    emit_arithmetic(s, o, OP_ADD, reg, reg2, reg3);
+    return BYTECODE_WORD;
+
+  case I_minus:
+    emit_arithmetic(s, o, OP_SUB, reg, reg2, reg3);
+    return BYTECODE_WORD;
+
+  case I_times:
+    emit_arithmetic(s, o, OP_IMUL, reg, reg2, reg3);
+    return BYTECODE_WORD;
+
+  case I_less:
+    emit_arithmetic(s, o, OP_CMP, reg, reg2, reg3);
+    return BYTECODE_WORD;
+
+  case I_eq:
+    emit_eq(s, o, reg, reg2, reg3);
+    return BYTECODE_WORD;
+
+  case I_car:
+  case I_cdr:
+    emit_type_compare(s, RDI, DISP_REG(reg2), T_PAIR);
+    emit_jump(s, CC_NE, exit_label(s, o));
+    emit_load(s, RCX, RDI, DISP_REG(reg2) + DISP_U);
+    emit_copy(s, RDI, DISP_REG(reg), RCX,
+	      OPCODE(pc) == I_car ? DISP_CAR : DISP_CDR);
+    return BYTECODE_WORD;
+
+  case I_nullp:
+    emit_type_compare(s, RDI, DISP_REG(reg2), T_NIL);
+    emit_truth(s, reg, CC_E);
+    return BYTECODE_WORD;
+
+  case I_pairp:
+    emit_type_compare(s, RDI, DISP_REG(reg2), T_PAIR);
+    emit_truth(s, reg, CC_E);
+    return BYTECODE_WORD;
+
+  case I_not:
+    emit_type_compare(s, RDI, DISP_REG(reg2), T_FALSE);
+    emit_truth(s, reg, CC_E);
+    return BYTECODE_WORD;
+
+  case I_branch:
+  case I_branch_bif:
+    n = OPERAND(pc, 1);
+    if(!valid_target(s, n))
+      return 0;
+    if(OPCODE(pc) == I_branch)
+      emit_type_compare(s, RDI, DISP_REG(REGISTER_VAL), T_FALSE);
+    else
+      emit_type_compare(s, RDI, DISP_REG(REGISTER_PROC), T_BIF);
+    emit_jump(s, CC_E, bytecode_label(s, n));
+    return 2*BYTECODE_WORD;
+
+  case I_goto:
+    n = OPERAND(pc, 1);
+    if(!valid_target(s, n))
+      return 0;
+    emit_jump(s, JMP, bytecode_label(s, n));
+    s->fallthrough = 0;
+    return 2*BYTECODE_WORD;
+  }
+
+  return 0;
+}
+
+/* Translates from offset o on until an instruction that is left to the
+   kernel, or one that has been translated already. */
+static void jit_block(struct jit_state *s, INT o)
+{
+  INT length, *label;
+
+  bind_label(s, s->bytecode_labels[o / BYTECODE_WORD]);
+
+  for(;;)
+  {
+    s->fallthrough = 1;
+
+    if(JIT_MAX_INSTRUCTIONS <= s->instructions ||
+       !(length = jit_instruction(s, o)))
+    {
+      emit_return(s, s->base + o);
+      return;
+    }
+    s->instructions++;
+
+    if(!s->fallthrough)
+      return;
+
+    o += length;
+    label = &s->bytecode_labels[o / BYTECODE_WORD];
+    if(0 <= *label)
+    {
+      emit_jump(s, JMP, *label);
+      return;
+    }
+    *label = new_label(s);
+    bind_label(s, *label);
+  }
+}
+
+static void jit_root(struct jit *jit, struct svalue *code)
+{
+  INT i;
+
+  for(i = 0; i < jit->roots_used; i++)
+    if(jit->roots[i].u.str == code->u.str)
+      return;
+
+  if(jit->roots_used == jit->roots_size)
+  {
+    jit->roots_size = jit->roots_size ? 2*jit->roots_size : 8;
+    jit->roots = mem_reallocate(jit->roots,
+				sizeof(struct svalue) * jit->roots_size);
+  }
+  jit->roots[jit->roots_used++] = *code;
+}
+
+static void jit_compile(struct process *process, struct jit_entry *entry)
+{
+  struct svalue *code = &process->program.u.vec->v[PROGRAM_CODE];
+  struct jit_state state, *s = &state;
+  INT words, i, o, page;
+  void *memory;
+
+  s->process = process;
+  s->base = (UBYTE *)code->u.str->s;
+  s->length = code->u.str->length;
+
+  words = s->length / BYTECODE_WORD + 1;
+  s->used = 0;
+  s->size = 1024;
+  s->code = mem_allocate(s->size);
+  s->n_labels = 0;
+  s->labels_size = 64;
+  s->labels = mem_allocate(sizeof(INT) * s->labels_size);
+  s->bytecode_labels = mem_allocate(sizeof(INT) * words);
+  s->exit_labels = mem_allocate(sizeof(INT) * words);
+  for(i = 0; i < words; i++)
+    s->bytecode_labels[i] = s->exit_labels[i] = -1;
+  s->n_fixups = 0;
+  s->fixups_size = 64;
+  s->fixups = mem_allocate(sizeof(INT) * s->fixups_size);
+  s->work = mem_allocate(sizeof(INT) * words);
+  s->n_work = 0;
+  s->instructions = 0;
+
+  o = entry->pc - s->base;
+  bytecode_label(s, o);
+  while(s->n_work)
+    jit_block(s, s->work[--s->n_work]);
+
+  /* Code that returns to the kernel at once is not worth running. */
+  if(!s->instructions)
+    goto done;
+
+  for(i = 0; i < words; i++)
+    if(0 <= s->exit_labels[i])
+    {
+      bind_label(s, s->exit_labels[i]);
+      emit_return(s, s->base + i*BYTECODE_WORD);
+    }
+
+  for(i = 0; i < s->n_fixups; i += 2)
+  {
+    INT at = s->fixups[i], to = s->labels[s->fixups[i+1]];
+    INT rel = to - (at + 4);
+
+    s->code[at]   = rel & 0xff;
+    s->code[at+1] = (rel >> 8) & 0xff;
+    s->code[at+2] = (rel >> 16) & 0xff;
+    s->code[at+3] = (rel >> 24) & 0xff;
+  }
+
+  /* The code is written and then made executable, never both. */
+  page = sysconf(_SC_PAGESIZE);
+  entry->size = (s->used + page-1) / page * page;
+  memory = mmap(0, entry->size, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(memory == MAP_FAILED)
+    goto done;
+
+  mem_copy(memory, s->code, s->used);
+  if(mprotect(memory, entry->size, PROT_READ | PROT_EXEC))
+  {
+    munmap(memory, entry->size);
+    goto done;
+  }
+
+  DEB(("compiled %d instructions at %d into %d bytes",
+       s->instructions, o, s->used));
+
+  entry->native = (jit_f *)memory;
+  jit_root(&process->jit, code);
+
+ done:
+  mem_free(s->code);
+  mem_free(s->labels);
+  mem_free(s->bytecode_labels);
+  mem_free(s->exit_labels);
+  mem_free(s->fixups);
+  mem_free(s->work);
+}
+
+#endif /* USE_JIT */
+
+/* Counts an entry to the lambda body at pc, and returns its native code
+   if there is any. */
+jit_f *jit_enter(struct process *process, UBYTE *pc)
+{
+  struct jit *jit = &process->jit;
+  struct jit_entry *entry;
+  INT h;
+
+  h = JIT_HASH(jit, pc);
+  for(entry = jit->hash[h]; entry; entry = entry->next)
+    if(entry->pc == pc)
+    {
+#ifdef USE_JIT
+      if(entry->count < JIT_THRESHOLD && ++entry->count == JIT_THRESHOLD)
+	jit_compile(process, entry);
+#endif /* USE_JIT */
+      return entry->native;
+    }
+
+  entry = mem_allocate(sizeof(struct jit_entry));
+  entry->pc = pc;
+  entry->count = 1;
+  entry->native = 0;
+  entry->size = 0;
+  entry->next = jit->hash[h];
+  jit->hash[h] = entry;
+
+  if(2*jit->size < ++jit->entries)
+    jit_rehash(jit);
+
+  return 0;
+}
+
+BIF_DECLARE(bif_jit)
+{
+  struct svalue *on;
+
+  ARGS_GET((process, "jit", args, "%*", &on));
+
+#ifdef USE_JIT
+  process->jit.enabled = !IS_FALSE(*on);
+  BIF_RESULT_UNDEFINED();
+#else
+  ARGS_ERROR((process, "jit", "Not supported on this platform."));
+#endif /* USE_JIT */
+}
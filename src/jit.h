@@ -0,0 +1,61 @@
+/* jit.h
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the native code compiler module.
+ */
+
+#ifndef __JIT_H__
+#define __JIT_H__
+
+#include "types.h"
+
+#include "bif.h"
+
+/* Native code is generated for x86-64 only.  Define NO_JIT to leave it
+ * out altogether; the jit BIF then reports that it is unsupported.
+ */
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__unix__) &&      \
+    !defined(NO_JIT)
+#define USE_JIT
+#endif /* __GNUC__ && __x86_64__ && __unix__ && !NO_JIT */
+
+/* Lambda bodies entered this many times are compiled. */
+#define JIT_THRESHOLD 1000
+
+/* Native code runs from a bytecode program counter and returns the one
+   at which the kernel is to continue. */
+typedef UBYTE *(jit_f)(struct process *process);
+
+struct jit_entry
+{
+  UBYTE *pc;
+  INT count;
+
+  jit_f *native;
+  INT size;
+
+  struct jit_entry *next;
+};
+
+struct jit
+{
+  INT enabled;
+
+  INT size, entries;
+  struct jit_entry **hash;
+
+  /* The code strings of compiled programs.  They are collector roots,
+     so the bytecode the native code was made from is never reused. */
+  INT roots_size, roots_used;
+  struct svalue *roots;
+};
+
+void jit_create(struct jit *jit);
+void jit_destroy(struct jit *jit);
+
+jit_f *jit_enter(struct process *process, UBYTE *pc);
+
+BIF_DECLARE(bif_jit);
+
+#endif /* __JIT_H__ */
@@ -9,65 +9,93 @@
 
 #include "types.h"
 
+#include "args.h"
 #include "exit.h"
 #include "err.h"
 #include "mem.h"
 
 #include "invocation.h"
 #include "process.h"
+#include "program.h"
 #include "pair.h"
 #include "garb.h"
+#include "jit.h"
 #include "bif.h"
 #include "big.h"
+#include "stack.h"
 #include "str.h"
+#include "thread.h"
+#include "vec.h"
 
 #include "kernel.h"
 #include "lexer.h"
+#include "mat.h"
+#include "svalue.h"
 
 #include "instructions.h"
 
-#define NEXT goto next
+/* Use direct-threaded dispatch when the compiler can take the address
+ * of a label (GCC and compatibles).  Each instruction then ends with its
+ * own indirect jump through the dispatch table, which gives the branch
+ * predictor one jump site per instruction instead of a single shared
+ * one.  Define NO_THREADED_DISPATCH to use the portable switch instead.
+ */
+#if defined(__GNUC__) && !defined(NO_THREADED_DISPATCH)
+#define USE_THREADED_DISPATCH
+#endif /* __GNUC__ && !NO_THREADED_DISPATCH */
+
+#define N_INSTRUCTIONS 256
+
+/* Only the instrumented kernel variant has a hook before each
+   instruction. */
+#define INSTRUMENT                                                         \
+        if(KERNEL_INSTRUMENTED)                                            \
+          instrument(process, pc, instr)
+
+#ifdef USE_THREADED_DISPATCH
+
+#define INSTRUCTION(i) label_##i
+
+#define DISPATCH_LABEL(table, i)                                           \
+        (table)[i] = &&label_##i
 
-#define PEEK1(pc)                                                          \
-          ((INT)*(pc))
+#define NEXT                                                               \
+        do {                                                               \
+          instr = OPCODE(pc);                                              \
+          INSTRUMENT;                                                      \
+          goto *dispatch[instr];                                           \
+        } while(0)
 
-#define PEEK2(pc)                                                          \
-          (((INT)((UBYTE)(pc)[0])<< 8) |                                   \
-            (INT)((UBYTE)(pc)[1]))
+#else
 
-#define PEEK3(pc)                                                          \
-          (((INT)((UBYTE)(pc)[0])<<16) |                                   \
-           ((INT)((UBYTE)(pc)[1])<< 8) |                                   \
-            (INT)((UBYTE)(pc)[2]))
+#define INSTRUCTION(i) case i
 
-#define PEEK4(pc)                                                          \
-          (((INT)((UBYTE)(pc)[0])<<24) |                                   \
-           ((INT)((UBYTE)(pc)[1])<<16) |                                   \
-           ((INT)((UBYTE)(pc)[2])<< 8) |                                   \
-            (INT)((UBYTE)(pc)[3]))
+#define NEXT goto next
 
-#define FETCH1(pc) (*pc++)
+#endif /* USE_THREADED_DISPATCH */
 
-#define FETCH4(pc)                                                         \
-        (pc += 4,                                                          \
-         ((INT)((UBYTE)(pc)[-4])<<24) |                                    \
-         ((INT)((UBYTE)(pc)[-3])<<16) |                                    \
-         ((INT)((UBYTE)(pc)[-2])<< 8) |                                    \
-          (INT)((UBYTE)(pc)[-1]))
+/* Each instruction starts on a word boundary with a word holding the
+ * opcode and its register operands.  Any other operands follow as words
+ * in native byte order (see program.h), so they are read with a single
+ * load.  Instructions advance the program counter past themselves.
+ */
+#define OPCODE(pc)                                                         \
+        ((INT)(pc)[0])
 
-#define CONS(r, a, b)                                                      \
-        (r).u.pair = pair_cons(process, &(a), &(b));                       \
-        (r).type = T_PAIR
+#define REGISTER(pc, i)                                                    \
+        ((INT)(pc)[i])
 
-#define LIST(r, a)                                                         \
-        (r).u.pair = pair_list(process, &(a));                             \
-        (r).type = T_PAIR
+#define OPERAND(pc, i)                                                     \
+        (((INT*)(pc))[i])
 
-#define PROGRAM_NAME 0
-#define PROGRAM_CODE 1
+#define SKIP(pc, n)                                                        \
+        ((pc) += (n)*BYTECODE_WORD)
+
+#define SKIP_BYTES(pc, n)                                                  \
+        ((pc) += BYTECODE_ALIGN(n))
 
 #define GOTO(x)                                                            \
-        pc = x + (UBYTE*)process->program.u.vec->v[PROGRAM_CODE].u.str->s
+        pc = PROGRAM_PC(x)
 
 #define JUMP(r)                                                            \
         do {                                                               \
@@ -76,381 +104,628 @@
             goto quit;                                                     \
           process->program.u.vec = tmp.u.vec;                              \
           GOTO(tmp.aux);                                                   \
+          if(NATIVE_PROGRAM(process))                                      \
+            NATIVE(tmp.aux);                                               \
+          if(VARIANT_CHANGED)                                              \
+            VARIANT;                                                       \
+        } while(0)
+
+/* The process changes kernel variant at jumps, when it is to be
+   instrumented or not, or when the program it jumps to is verified or
+   not. */
+#define VARIANT_CHANGED                                                    \
+        (KERNEL_INSTRUMENTED ? !process->instrument :                      \
+         process->instrument || VERIFIED_PROGRAM(process) == KERNEL_CHECKED)
+
+/* Leaves the program to another kernel variant. */
+#define VARIANT                                                            \
+        do {                                                               \
+          process->pc = pc;                                                \
+          return 1;                                                        \
         } while(0)
 
-#define REG      process->reg[reg]
-#define REG2     process->reg[reg2]
-#define REG3     process->reg[reg3]
-#define REG_ARGL process->reg[REGISTER_ARGL]
-#define REG_CONT process->reg[REGISTER_CONT]
-#define REG_ENV  process->reg[REGISTER_ENV]
-#define REG_PROC process->reg[REGISTER_PROC]
-#define REG_VAL  process->reg[REGISTER_VAL]
-#define STACK    process->stack
-#define ERROR    process->error
-
-#define CHECK_MEMORY                                                       \
-        if(process->gc || process->pair_heap.reduce)                       \
-          garb_and_reduce(process)
-
-#define env_lookup(env, m, n)                                              \
-        while(m-- > 0)                                                     \
-          env = &CAR(env->u.pair);                                         \
-        env = &CDR(env->u.pair);                                           \
-        while(n-- > 0)                                                     \
-          env = &CDR(env->u.pair)
-
-static void env_get(struct svalue *result, INT m, INT n, struct svalue *env)
+/* Runs the native code of the program from offset l, and continues at
+   the program counter it returns. */
+#define NATIVE(l)                                                          \
+        do {                                                               \
+          if(!(pc = process->native(process, (l))))                        \
+            goto quit;                                                     \
+        } while(0)
+
+#define KERNEL_GOTO(l) GOTO(l)
+#define KERNEL_JUMP(r) JUMP(r)
+#define KERNEL_TRAP    goto trap
+#define KERNEL_QUIT    goto quit
+
+void kernel_env_get(struct svalue *result, INT m, INT n, struct svalue *env)
 {
-  env_lookup(env, m, n);
-  
-  *result = CAR(env->u.pair);
+  CHECK_ENV(*env);
+  while(m-- > 0)
+  {
+    env = &ENV_PARENT(*env);
+    CHECK_ENV(*env);
+  }
+
+  CHECK_SLOT(ENV_FRAME(*env), n);
+  *result = FRAME_SLOT(ENV_FRAME(*env), n);
 }
 
-static void env_set(struct svalue *value, INT m, INT n, struct svalue *env)
+void kernel_env_set(struct svalue *value, INT m, INT n, struct svalue *env)
 {
-  env_lookup(env, m, n);
+  CHECK_ENV(*env);
+  while(m-- > 0)
+  {
+    env = &ENV_PARENT(*env);
+    CHECK_ENV(*env);
+  }
 
-  CAR(env->u.pair) = *value;
+  CHECK_SLOT(ENV_FRAME(*env), n);
+  FRAME_SLOT(ENV_FRAME(*env), n) = *value;
 }
 
-static void env_extend(struct process *process, INT n, struct svalue *env)
+/* Makes room for at least n slots in the frame of env.  A program frame
+   is extended each time a program is loaded into it, so the frame grows
+   geometrically to make that amortized O(1) per slot. */
+void kernel_env_extend(struct process *process, INT n, struct svalue *env)
 {
-  struct svalue u;
+  struct svalue *frame;
+  struct vec *vec;
+  INT i, length;
+
+  frame = ENV_FRAME(*env);
+  length = IS_VECTOR(*frame) ? frame->u.vec->length : 0;
   
-  while(IS_PAIR(CDR(env->u.pair)))
-    env = &CDR(env->u.pair);
+  if(n <= length)
+    return;
+
+  vec = vec_allocate(&process->vec_heap, MAX(n, 2*length));
+  for(i = 0; i < length; i++)
+    vec->v[i] = frame->u.vec->v[i];
+
+  frame->u.vec = vec;
+  frame->type = T_VECTOR;
+}
 
-  u.type = T_UNDEFINED;
-  while(n-- > 0)
+/* Arguments are passed either as a list or, when the compiler cannot
+   tell that the procedure is a BIF, as a vector of the arguments.  BIFs
+   always get a list. */
+void kernel_args_to_list(struct process *process)
+{
+  struct svalue u, *list;
+  struct vec *vec;
+  INT i;
+
+  /* The list is kept on the stack while it is built. */
+  u.type = T_NIL;
+  STACK_PUSH(STACK, u);
+  list = &STACK->s[STACK->used-1];
+  
+  vec = REG_ARGL.u.vec;
+  for(i = vec->length-1; 0 <= i; i--)
   {
-    env = &CDR(env->u.pair);
-    LIST(*env, u);
+    CONS(*list, vec->v[i], *list);
   }
+
+  STACK_POP(STACK, REG_ARGL);
 }
 
-void kernel(struct process *process)
+/* Applies a BIF to the arguments a and b, or only a if b is null, for
+   the instructions that handle the common cases themselves.  The
+   argument list is kept on the stack while the BIF runs. */
+void kernel_apply_bif_to(struct process *process, bif_f *bif,
+			 struct svalue *result, struct svalue *a,
+			 struct svalue *b)
 {
-  UBYTE *pc;
-  INT instr, i, reg, reg2, reg3;
-
-  pc = process->pc;
+  struct svalue u, *list;
 
-  /* swap_in(process); */
-  
-  next:
-  
-  instr = FETCH1(pc);
-  
-  if(process->trace)
-    err_debug("instr [%p] = %d", pc, instr);
+  u.type = T_NIL;
+  STACK_PUSH(STACK, u);
+  list = &STACK->s[STACK->used-1];
+  if(b)
+  {
+    CONS(*list, *b, *list);
+  }
+  CONS(*list, *a, *list);
   
-  switch(instr)
+  bif(process, result, list);
+  STACK_POP(STACK, u);
+}
+
+/* Makes the environment of the lambda in proc applied to argl.  The
+   frame holds size slots, the arguments first.  A negative argument
+   count means the last argument slot takes the rest list. */
+void kernel_lambda(struct process *process, INT count, INT size)
+{
+  struct svalue *t, u;
+  struct vec *vec;
+  INT i, n;
+
+  n = count < 0 ? -count-1 : count;
+
+  u.type = T_NIL;
+  REG_ENV = CDR(REG_PROC.u.pair);
+  CONS(REG_ENV, REG_ENV, u);
+
+  if(IS_VECTOR(REG_ARGL))
   {
-  case I_exit:
-  quit:
-    /* err_display(&REG_VAL);
-       err_printf("\n"); */
-    
-    /* swap_out(process); */
-    return;
-    
-  case I_save:
-    reg = FETCH1(pc);
-    CONS(STACK, REG, STACK);
-    NEXT;
-    
-  case I_restore:
-    reg = FETCH1(pc);
-    REG = CAR(STACK.u.pair);
-    STACK = CDR(STACK.u.pair);
-    NEXT;
-    
-  case I_cons:
-    reg = FETCH1(pc);
-    reg2 = FETCH1(pc);
-    reg3 = FETCH1(pc);
-    CONS(REG, REG2, REG3);
-    NEXT;
-    
-  case I_list:
-    reg = FETCH1(pc);
-    reg2 = FETCH1(pc);
-    LIST(REG, REG2);
-    NEXT;
-    
-  case I_apply_bif:
-    CHECK_MEMORY;
-    reg = FETCH1(pc);
+    struct vec *args = REG_ARGL.u.vec;
 
-    if(IS_NOT_BIF(REG_PROC))
-      err_fatal("Application not BIF.");
-    
-    REG_PROC.u.bif(process, &REG, &REG_ARGL);
-    
-    if(ERROR.type != T_UNDEFINED)
+    if(count >= 0)
     {
-      struct svalue t;
-
-      t = process->trap[TRAP_ERROR];
-      
-      if(IS_CONTINUATION(t))
+      if(args->length != count)
+	err_fatal(args->length < count ? "Too few arguments to function." :
+		  "Too many arguments to function.");
+
+      /* The argument vector becomes the frame when it is large
+	 enough, otherwise it is copied to a larger one below.  A
+	 shared one is always copied, see stack_capture and
+	 kernel_values. */
+      if(size <= count && !args->shared)
       {
-	REG_VAL = ERROR;
-	ERROR.type = T_UNDEFINED;
-	
-	STACK = CAR(t.u.pair);
-	t = CDR(t.u.pair);
-	REG_PROC = CAR(t.u.pair);
-	t = CDR(t.u.pair);
-	REG_ENV = CAR(t.u.pair);
-	t = CDR(t.u.pair);
-	REG_CONT = CAR(t.u.pair);
-	t = CDR(t.u.pair);
-	REG_ARGL = CAR(t.u.pair);
-	t = CDR(t.u.pair);
-	JUMP(t);
-      } else
-	err_fatal("Trap vector %d is not a continuation.", 0);
-    }
-    NEXT;
-    
-  case I_apply_lambda:
-    CHECK_MEMORY;
-    if(IS_CONTINUATION(REG_PROC))
-    {
-      struct svalue t = REG_PROC, u = REG_ARGL;
-      STACK = CAR(t.u.pair);
-      t = CDR(t.u.pair);
-      REG_PROC = CAR(t.u.pair);
-      t = CDR(t.u.pair);
-      REG_ENV = CAR(t.u.pair);
-      t = CDR(t.u.pair);
-      REG_CONT = CAR(t.u.pair);
-      t = CDR(t.u.pair);
-      REG_ARGL = CAR(t.u.pair);
-      t = CDR(t.u.pair);
-      if(IS_NOT_PAIR(u))
-	err_fatal("Too few arguments to continuation.");
-      REG_VAL = CAR(u.u.pair);
-      if(IS_NOT_NIL(CDR(u.u.pair)))
-	err_fatal("Too many arguments to continuation.");
-      JUMP(t);
+	*ENV_FRAME(REG_ENV) = REG_ARGL;
+	return;
+      }
     }
-    else if(IS_LAMBDA(REG_PROC))
-    {
-      JUMP(CAR(REG_PROC.u.pair));
-    }
-    else
+    else if(args->length < n)
+      err_fatal("Too few arguments to function.");
+
+    vec = vec_allocate(&process->vec_heap, MAX(n + (count < 0), size));
+    ENV_FRAME(REG_ENV)->u.vec = vec;
+    ENV_FRAME(REG_ENV)->type = T_VECTOR;
+      
+    for(i = 0; i < n; i++)
+      vec->v[i] = args->v[i];
+
+    /* Only rest arguments are consed. */
+    if(count < 0)
     {
-      err_display(process, &REG_PROC);
-      err_fatal("Application not lambda.");
+      vec->v[n].type = T_NIL;
+      for(i = args->length-1; n <= i; i--)
+      {
+	CONS(vec->v[n], args->v[i], vec->v[n]);
+      }
     }
-    NEXT;
-
-  case I_assign:
-    reg = FETCH1(pc);
-    reg2 = FETCH1(pc);
-    REG = REG2;
-    NEXT;
-    
-  case I_assign_nil:
-    reg = FETCH1(pc);
-    REG.type = T_NIL;
-    NEXT;
-    
-  case I_assign_true:
-    reg = FETCH1(pc);
-    REG.type = T_TRUE;
-    NEXT;
-    
-  case I_assign_false:
-    reg = FETCH1(pc);
-    REG.type = T_FALSE;
-    NEXT;
-    
-  case I_assign_small_integer:
-    reg = FETCH1(pc);
-    for(i = reg2 = 0; i < (INT)sizeof(INT); i++)
-      reg2 = (reg2<<8) | (UBYTE)(*pc++);
-    REG.u.integer = reg2;
-    REG.type = T_SMALL_INTEGER;
-    NEXT;
-    
-#ifdef USE_BIG_INTEGERS
-  case I_assign_big_integer:
-    reg = FETCH1(pc);
-    reg2 = FETCH4(pc);
-    REG.u.big = big_allocate_integer_text(&process->big_heap, (char*)pc, 16);
-    pc += reg2;
-    REG.type = T_BIG_INTEGER;
-    NEXT;
-#endif /* USE_BIG_INTEGERS */
+    return;
+  }
     
-  case I_assign_float:
-    /* FIXME: Use "proper" encoding. */
+  if(size == 0)
   {
-    union
-    {
-      REAL r;
-      UBYTE b[sizeof(REAL)];
-    } u;
-    INT i;
-    
-    reg = FETCH1(pc);
-    for(i = 0; i < (INT)sizeof(REAL); i++)
-      u.b[i] = *pc++;
-    REG.u.real = u.r;
-    REG.type = T_REAL;
-    NEXT;
+    if(IS_NOT_NIL(REG_ARGL))
+      err_fatal("Too many arguments to function.");
+    return;
   }
     
-  case I_assign_character:
-    reg = FETCH1(pc);
-    reg2 = FETCH4(pc);
-    REG.u.integer = reg2;
-    REG.type = T_CHAR;
-    NEXT;
-    
-  case I_assign_string:
-    reg = FETCH1(pc);
-    reg2 = FETCH4(pc);
-    REG.u.str = str_allocate(&process->str_heap, (char*)pc, reg2);
-    REG.type = T_STRING;
-    pc += reg2;
-    NEXT;
-    
-  case I_assign_symbol:
-    reg = FETCH1(pc);
-    reg2 = FETCH4(pc);
-    REG.u.str = str_allocate(&process->str_heap, (char*)pc, reg2);
-    REG.type = T_SYMBOL;
-    pc += reg2;
-    NEXT;
-    
-  case I_assign_bif:
-    reg = FETCH1(pc);
-    reg2 = FETCH4(pc);
-    REG.u.bif = bifs[reg2].bif;
-    REG.type = T_BIF;
-    if(!REG.u.bif)
-      err_fatal("BIF %d not implemented.", reg2);
-    NEXT;
-    
-  case I_assign_lambda:
-    reg = FETCH4(pc);
-    reg2 = FETCH1(pc);
-    REG2.type = T_LABEL;
-    REG2.aux = reg;
-    REG2.u.vec = process->program.u.vec;
-    REG2.u.pair = pair_cons(process, &REG2, &REG_ENV);
-    REG2.type = T_LAMBDA;
-    NEXT;
-    
-  case I_assign_label:
-    reg = FETCH4(pc);
-    REG_CONT.aux = reg;
-    REG_CONT.u.vec = process->program.u.vec;
-    REG_CONT.type = T_LABEL;
-    NEXT;
-    
-  case I_assign_undefined:
-    reg = FETCH1(pc);
-    REG.type = T_UNDEFINED;
-    NEXT;
-    
-  case I_call_cc:
-    reg = FETCH4(pc);
-    REG_ARGL.type = T_LABEL;
-    REG_ARGL.aux = reg;
-    REG_ARGL.u.vec = process->program.u.vec;
-    CONS(REG_ARGL, REG_ARGL, REG_ARGL);
-    CONS(REG_ARGL, REG_CONT, REG_ARGL);
-    CONS(REG_ARGL, REG_ENV, REG_ARGL);
-    CONS(REG_ARGL, REG_PROC, REG_ARGL);
-    CONS(REG_ARGL, STACK, REG_ARGL);
-    REG_ARGL.type = T_CONTINUATION;
-    LIST(REG_ARGL, REG_ARGL);
-    NEXT;
-    
-  case I_branch_bif:
-    reg = FETCH4(pc);
-    if(IS_BIF(REG_PROC))
-      GOTO(reg);
-    NEXT;
-    
-  case I_goto:
-    reg = FETCH4(pc);
-    GOTO(reg);
-    NEXT;
-    
-  case I_jump:
-    JUMP(REG_CONT);
-    NEXT;
+  vec = vec_allocate(&process->vec_heap, MAX(n + (count < 0), size));
+
+  t = &REG_ARGL;
+  for(i = 0; i < n; i++)
+  {
+    if(IS_NOT_PAIR(*t))
+      err_fatal("Too few arguments to function.");
+    vec->v[i] = CAR(t->u.pair);
+    t = &CDR(t->u.pair);
+  }
     
-  case I_branch:
-    reg = FETCH4(pc);
-    if(IS_FALSE(REG_VAL))
-      GOTO(reg);
-    NEXT;
-
-  case I_lambda:
-    reg = FETCH4(pc);
-    REG_ENV = CDR(REG_PROC.u.pair);
-    if(reg < 0)
-    {
-      struct svalue *t = &REG_ARGL;
-      INT i = reg;
-      
-      while(++i)
-	t = &CDR(t->u.pair);
-      LIST(*t, *t);
-    }
-    else
+  if(count < 0)
+    vec->v[i] = *t;
+  else if(IS_NOT_NIL(*t))
+    err_fatal("Too many arguments to function.");
+
+  ENV_FRAME(REG_ENV)->u.vec = vec;
+  ENV_FRAME(REG_ENV)->type = T_VECTOR;
+}
+
+/* Restores the registers and the stack saved in the continuation k,
+   and gives the label it continues at. */
+static void continuation_reinstate(struct process *process, struct svalue k,
+				   struct svalue *label)
+{
+  stack_reinstate(STACK, &CAR(k.u.pair));
+  k = CDR(k.u.pair);
+  REG_PROC = CAR(k.u.pair);
+  k = CDR(k.u.pair);
+  REG_ENV = CAR(k.u.pair);
+  k = CDR(k.u.pair);
+  REG_CONT = CAR(k.u.pair);
+  k = CDR(k.u.pair);
+  REG_ARGL = CAR(k.u.pair);
+  *label = CDR(k.u.pair);
+}
+
+/*
+ * An escape procedure can only be called while the procedure it was
+ * given to runs.  The call_ec instruction pushes the label to continue
+ * at and a mark with the number of the escape procedure, which are
+ * popped at the label whether the procedure returns or escapes.  An
+ * escape looks for its mark from the top of the stack down, and cuts
+ * the stack off just above it, so it neither allocates nor copies the
+ * stack.  Numbers are never used twice in a process, so no mark is
+ * found once the procedure has returned.  Escapes copied in from
+ * another process are numbered again, see copy_in.
+ */
+#define ESCAPE_MARK 1
+
+/* Pushes the label l and a mark, and calls the procedure in proc with
+   a new escape procedure. */
+void kernel_call_ec(struct process *process, INT l)
+{
+  struct svalue label, escape;
+
+  label.type = T_LABEL;
+  label.aux = l;
+  label.u.vec = process->program.u.vec;
+  STACK_PUSH(STACK, label);
+
+  escape.type = T_ESCAPE;
+  escape.aux = ESCAPE_MARK;
+  escape.u.integer = ++process->escape_count;
+  STACK_PUSH(STACK, escape);
+
+  escape.aux = 0;
+  LIST(REG_ARGL, escape);
+}
+
+/* Returns the index of the topmost mark with the given number on the
+   stack, or zero when there is none. */
+static INT escape_find(struct process *process, INT n)
+{
+  struct svalue *s = STACK->s;
+  INT i;
+
+  for(i = STACK->used - 1; 0 < i; i--)
+    if(s[i].type == T_ESCAPE && s[i].aux == ESCAPE_MARK &&
+       s[i].u.integer == n)
+      return i;
+
+  return 0;
+}
+
+/* Cuts the stack off above the mark of the escape procedure k, and
+   gives the label pushed below it.  Returns zero when there is no
+   mark. */
+static INT escape_reinstate(struct process *process, struct svalue k,
+			    struct svalue *label)
+{
+  INT i;
+
+  if(!(i = escape_find(process, k.u.integer)))
+    return 0;
+
+  STACK->used = i + 1;
+  *label = STACK->s[i - 1];
+  return 1;
+}
+
+/*
+ * A generator is a vector of its mark, what it continues
+ * with, and the segment of the stack it left when it last yielded with
+ * the number of slots used in it.  It runs above a label and a mark
+ * pushed like those of call_ec by the procedure that resumes it.  A
+ * yield moves the slots above the mark to the segment and returns to
+ * the label, and a resume moves them back, so only the frames of the
+ * generator itself are copied, and the segment is reused from one
+ * yield to the next.  It continues with a lambda before it has
+ * started, and at a label after it has yielded.  It is true while it
+ * runs, and false once it has returned, which init.shoe sets.
+ */
+#define GENERATOR_MARK     0
+#define GENERATOR_CONTINUE 1
+#define GENERATOR_SEGMENT  2
+#define GENERATOR_USED     3
+#define GENERATOR_SIZE     4
+
+/* The smallest segment allocated. */
+#define GENERATOR_SEGMENT_SIZE 16
+
+/* Returns the slots of the generator in proc, or zero after the trap
+   has been taken for an error. */
+static struct svalue *generator_state(struct process *process, char *name,
+				      struct svalue *label)
+{
+  if(IS_VECTOR(REG_PROC) && REG_PROC.u.vec->length == GENERATOR_SIZE)
+    return REG_PROC.u.vec->v;
+
+  args_error(process, name, "Generator expected.");
+  kernel_trap(process, label);
+  return 0;
+}
+
+/* Pushes the label l and the mark of the generator in proc, and gives
+   the label the generator continues at, with the segment it left moved
+   back onto the stack. */
+void kernel_generator_resume(struct process *process, INT l,
+			     struct svalue *label)
+{
+  struct svalue *state, *segment, k, u;
+  INT used, i;
+
+  if(!(state = generator_state(process, "generator-resume", label)))
+    return;
+
+  k = state[GENERATOR_CONTINUE];
+  if(IS_NOT_LAMBDA(k) && k.type != T_LABEL)
+  {
+    args_error(process, "generator-resume",
+	       IS_FALSE(k) ? "Generator has returned." :
+	       "Generator is running, or escaped.");
+    kernel_trap(process, label);
+    return;
+  }
+
+  if(IS_NOT_ESCAPE(state[GENERATOR_MARK]))
+  {
+    state[GENERATOR_MARK].type = T_ESCAPE;
+    state[GENERATOR_MARK].aux = ESCAPE_MARK;
+    state[GENERATOR_MARK].u.integer = ++process->escape_count;
+  }
+  
+  u.type = T_LABEL;
+  u.aux = l;
+  u.u.vec = process->program.u.vec;
+  STACK_PUSH(STACK, u);
+  REG_CONT = u;
+
+  STACK_PUSH(STACK, state[GENERATOR_MARK]);
+
+  state[GENERATOR_CONTINUE].type = T_TRUE;
+  
+  /* The procedure of the generator returns to the label. */
+  if(IS_LAMBDA(k))
+  {
+    REG_PROC = k;
+    REG_ARGL.type = T_NIL;
+    *label = CAR(k.u.pair);
+    return;
+  }
+
+  used = state[GENERATOR_USED].u.integer;
+  while(STACK->size < STACK->used + used)
+    stack_grow(STACK);
+
+  /* The segment does not keep what it held alive once moved back. */
+  segment = state[GENERATOR_SEGMENT].u.vec->v;
+  for(i = 0; i < used; i++)
+  {
+    STACK->s[STACK->used++] = segment[i];
+    segment[i].type = T_UNDEFINED;
+  }
+  
+  REG_VAL.type = T_UNDEFINED;
+  *label = k;
+}
+
+/* Moves the stack above the mark of the generator in proc to its
+   segment, to continue at the label l when it is resumed, and gives the
+   label pushed below the mark, where val is returned to. */
+void kernel_generator_yield(struct process *process, INT l,
+			    struct svalue *label)
+{
+  struct svalue *state;
+  struct vec *segment;
+  INT used, size, i;
+
+  if(!(state = generator_state(process, "generator-yield", label)))
+    return;
+
+  if(IS_NOT_ESCAPE(state[GENERATOR_MARK]) ||
+     !(i = escape_find(process, state[GENERATOR_MARK].u.integer)))
+  {
+    args_error(process, "generator-yield", "Called outside its generator.");
+    kernel_trap(process, label);
+    return;
+  }
+  
+  used = STACK->used - (i + 1);
+  if(IS_NOT_VECTOR(state[GENERATOR_SEGMENT]) ||
+     state[GENERATOR_SEGMENT].u.vec->length < used)
+  {
+    size = IS_VECTOR(state[GENERATOR_SEGMENT]) ?
+      2*state[GENERATOR_SEGMENT].u.vec->length : GENERATOR_SEGMENT_SIZE;
+    segment = vec_allocate(&process->vec_heap, MAX(size, used));
+    state[GENERATOR_SEGMENT].u.vec = segment;
+    state[GENERATOR_SEGMENT].type = T_VECTOR;
+  }
+  segment = state[GENERATOR_SEGMENT].u.vec;
+  
+  mem_copy(segment->v, &STACK->s[i + 1], sizeof(struct svalue) * used);
+  state[GENERATOR_USED].u.integer = used;
+  state[GENERATOR_USED].type = T_SMALL_INTEGER;
+
+  state[GENERATOR_CONTINUE].type = T_LABEL;
+  state[GENERATOR_CONTINUE].aux = l;
+  state[GENERATOR_CONTINUE].u.vec = process->program.u.vec;
+  
+  STACK->used = i + 1;
+  *label = STACK->s[i - 1];
+}
+
+/*
+ * Multiple values are the arguments they were made of, in the vector
+ * of a values object, which is only made for other than one value.
+ * call-with-values gives the vector to the consumer as its arguments,
+ * so the values are not consed when they come from an application of
+ * values, see the values instruction.  A values object may be kept and
+ * used again, so its vector is marked as shared, and a procedure that
+ * would take it as its frame copies it instead, see kernel_lambda.
+ */
+
+/* Makes the values of the arguments in args, a vector or a list, in
+   result. */
+void kernel_values(struct process *process, struct svalue *result,
+		   struct svalue *args)
+{
+  struct svalue *t;
+  struct vec *vec;
+  INT n;
+
+  if(IS_VECTOR(*args))
+  {
+    /* A continuation may fill in a shared argument vector again. */
+    vec = args->u.vec;
+    if(vec->shared)
     {
-      struct svalue *t = &REG_ARGL;
-      INT i;
-      
-      for(i = 0; i < reg && IS_PAIR(*t); i++)
-	t = &CDR(t->u.pair);
-      
-      if(IS_NOT_NIL(*t))
-	err_fatal("Too many arguments to function.");
-      
-      if(i != reg)
-	err_fatal("Too few arguments to function.");
+      vec = vec_allocate(&process->vec_heap, args->u.vec->length);
+      mem_copy(vec->v, args->u.vec->v,
+	       sizeof(struct svalue) * args->u.vec->length);
     }
-    CONS(REG_ENV, REG_ENV, REG_ARGL);
+  }
+  else
+  {
+    for(n = 0, t = args; IS_PAIR(*t); t = &CDR(t->u.pair))
+      n++;
 
-    /* Fall through. */
-    
-  case I_env_extend:
-    reg2 = FETCH4(pc);
-    env_extend(process, reg2, &REG_ENV);
-    NEXT;
-
-  case I_get:
-    reg = FETCH1(pc);
-    reg2 = FETCH4(pc);
-    reg3 = FETCH4(pc);
-    env_get(&REG, reg2, reg3, &REG_ENV);
-    NEXT;
-
-  case I_set:
-    reg = FETCH1(pc);
-    reg2 = FETCH4(pc);
-    reg3 = FETCH4(pc);
-    env_set(&REG, reg2, reg3, &REG_ENV);
-    REG.type = T_UNDEFINED;
-    NEXT;
-
-  case I_load_env:
-    REG_ENV = process->program.u.vec->v[2];
-    NEXT;
-
-  default:
-    err_fatal("Unknown instruction: %d.", instr);
+    vec = vec_allocate(&process->vec_heap, n);
+    for(n = 0, t = args; IS_PAIR(*t); t = &CDR(t->u.pair))
+      vec->v[n++] = CAR(t->u.pair);
+  }
+
+  vec->shared = 1;
+  result->u.vec = vec;
+  result->type = T_VALUES;
+}
+
+/* Makes argl the arguments to give the consumer of the values in val,
+   which is one value unless it is a values object. */
+void kernel_argl_values(struct process *process)
+{
+  if(IS_VALUES(REG_VAL))
+  {
+    REG_ARGL.u.vec = REG_VAL.u.vec;
+    REG_ARGL.type = T_VECTOR;
+    return;
   }
+
+  REG_ARGL.u.vec = vec_allocate(&process->vec_heap, 1);
+  REG_ARGL.type = T_VECTOR;
+  REG_ARGL.u.vec->v[0] = REG_VAL;
+}
+
+/* Applies the continuation or escape procedure in proc to the values
+   in argl, and gives the label to continue at. */
+void kernel_apply_continuation(struct process *process, struct svalue *label)
+{
+  struct svalue u = REG_ARGL;
+  
+  if(IS_NOT_CONTINUATION(REG_PROC) && IS_NOT_ESCAPE(REG_PROC))
+  {
+    err_display(process, &REG_PROC);
+    err_fatal("Application not lambda.");
+  }
+  
+  if(IS_VECTOR(u) && u.u.vec->length == 1)
+    REG_VAL = u.u.vec->v[0];
+  else if(IS_PAIR(u) && IS_NIL(CDR(u.u.pair)))
+    REG_VAL = CAR(u.u.pair);
+  else
+    kernel_values(process, &REG_VAL, &u);
+  
+  if(IS_CONTINUATION(REG_PROC))
+    continuation_reinstate(process, REG_PROC, label);
+  else if(!escape_reinstate(process, REG_PROC, label))
+  {
+    args_error(process, "escape", "Called after its procedure returned.");
+    kernel_trap(process, label);
+  }
+}
+
+/* A BIF failed.  Gives the label of the error trap, which gets the
+   error in val.  A procedure is called with the error instead, where
+   the BIF failed, and is not to return. */
+void kernel_trap(struct process *process, struct svalue *label)
+{
+  struct svalue t = process->trap[TRAP_ERROR];
+
+  REG_VAL = ERROR;
+  ERROR.type = T_UNDEFINED;
+
+  if(IS_LAMBDA(t))
+  {
+    REG_PROC = t;
+    LIST(REG_ARGL, REG_VAL);
+    REG_CONT.type = T_UNDEFINED;
+    *label = CAR(t.u.pair);
+    return;
+  }
+
+  if(IS_NOT_CONTINUATION(t))
+    err_fatal("Trap vector %d is not a procedure.", TRAP_ERROR);
+  
+  continuation_reinstate(process, t, label);
+}
+
+#define INSTRUCTION3(i)                                                    \
+        INSTRUCTION(I_##i):                                                \
+          reg = REGISTER(pc, 1);                                           \
+          reg2 = REGISTER(pc, 2);                                          \
+          reg3 = REGISTER(pc, 3);                                          \
+          SKIP(pc, 1);                                                     \
+          INSTR_##i(reg, reg2, reg3);                                      \
+          NEXT
+
+#define INSTRUCTION2(i)                                                    \
+        INSTRUCTION(I_##i):                                                \
+          reg = REGISTER(pc, 1);                                           \
+          reg2 = REGISTER(pc, 2);                                          \
+          SKIP(pc, 1);                                                     \
+          INSTR_##i(reg, reg2);                                            \
+          NEXT
+
+/* Traces and profiles the instruction at pc. */
+static void instrument(struct process *process, UBYTE *pc, INT instr)
+{
+  if(process->instrument & INSTRUMENT_OPCODES)
+    profile_instruction(&process->profile, instr);
+
+  if(process->instrument & INSTRUMENT_SAMPLE)
+    profile_sample(process, pc);
+  
+  if(process->instrument & INSTRUMENT_TRACE)
+    err_debug("%ld: %s", (long)(pc - PROGRAM_PC(0)),
+	      instr < PROGRAM_INSTRUCTIONS && program_instructions[instr].name ?
+	      program_instructions[instr].name : "unknown");
+}
+
+#define KERNEL_VARIANT      kernel_checked
+#define KERNEL_CHECKED      1
+#define KERNEL_INSTRUMENTED 0
+#include "variant.h"
+#undef KERNEL_VARIANT
+#undef KERNEL_CHECKED
+#undef KERNEL_INSTRUMENTED
+
+#define KERNEL_VARIANT      kernel_verified
+#define KERNEL_CHECKED      0
+#define KERNEL_INSTRUMENTED 0
+#include "variant.h"
+#undef KERNEL_VARIANT
+#undef KERNEL_CHECKED
+#undef KERNEL_INSTRUMENTED
+
+/* Instrumentation is for debugging, so the code is checked as well. */
+#define KERNEL_VARIANT      kernel_instrumented
+#define KERNEL_CHECKED      1
+#define KERNEL_INSTRUMENTED 1
+#include "variant.h"
+#undef KERNEL_VARIANT
+#undef KERNEL_CHECKED
+#undef KERNEL_INSTRUMENTED
+
+/* Runs the process on the kernel variant for it and its program until
+   its main thread quits.  Variants are only changed at jumps, and when
+   another thread is switched to. */
+void kernel(struct process *process)
+{
+  INT more;
+
+  do
+  {
+    if(process->instrument)
+      more = kernel_instrumented(process);
+    else if(VERIFIED_PROGRAM(process))
+      more = kernel_verified(process);
+    else
+      more = kernel_checked(process);
+  } while(more || thread_quit(process));
 }
 
 int main(int argc, char **argv)
@@ -10,202 +10,616 @@
 
 #include "types.h"
 
-#define swap_in(p)                                                         \
-        argl = p->argl;                                                    \
-        cont = p->cont;                                                    \
-        env = p->env;                                                      \
-        proc = p->proc;                                                    \
-        stack = p->stack;                                                  \
-        val = p->val;                                                      \
-        label = p->label
-
-#define swap_out(p)                                                        \
-        p->argl = argl;                                                    \
-        p->cont = cont;                                                    \
-        p->env = env;                                                      \
-        p->proc = proc;                                                    \
-        p->stack = stack;                                                  \
-        p->val = val;                                                      \
-        p->label = label
-
-#define garbcheck()                                                        \
-        if(is_pair_heap_full(process))                                     \
-          do {                                                             \
-            swap_out(process);                                             \
-            garb(process);                                                 \
-            swap_in(process);                                              \
-          } while(0)
-
-#define kernel_error(msg)                                                  \
-        {                                                                  \
-          val.type = T_STRING;                                             \
-          val.u.str = str_allocate_text(&process->str_heap, msg);          \
-          trap(0, val);                                                    \
-        }
-
-#define assign(r, x)                                                       \
-        r = x
-
-#define assign_nil(r)                                                      \
-        r.type = T_NIL
-
-#define assign_integer(r, i)                                               \
-        r.type = T_INTEGER;                                                \
-        r.u.integer = i
-
-#define assign_label(r, l)                                                 \
-        r.type = T_LABEL;                                                  \
-        r.u.label = l
-#define assign_lambda(r, l, e)                                             \
-        garbcheck();                                                       \
-        assign_label(r, l);                                                \
-        r.u.lambda = pair_cons(process, &r, &e);                           \
-        r.type = T_LAMBDA;                                                 \
-
-#define assign_bif(r, b)                                                   \
-        r.type = T_BIF;                                                    \
-        r.u.bif = b
-
-#define assign_char(r, c)                                                  \
-        r.type = T_CHAR;                                                   \
-        r.u.integer = c
-
-#define assign_true(r, b)                                                  \
-        r.type = T_TRUE
-
-#define assign_false(r, b)                                                 \
-        r.type = T_FALSE
-
-#define assign_string(r, s)                                                \
-        r.type = T_STRING;                                                 \
-        r.u.str = str_allocate_text(&process->str_heap, s)
-
-#define assign_symbol(r, s)                                                \
-        r.type = T_SYMBOL;                                                 \
-        r.u.str = str_allocate_text(&process->str_heap, s)
-
-#define list(r, a)                                                         \
-        garbcheck();                                                       \
-        r.u.pair = pair_list(process, &a);                                 \
-        r.type = T_PAIR
-
-#define cons(r, a, b)                                                      \
-        garbcheck();                                                       \
-        r.u.pair = pair_cons(process, &a, &b);                             \
-        r.type = T_PAIR
-
-#define jump(r)                                                            \
-        label = r.u.label;                                                 \
-        continue
-
-#define branch(l, p)                                                       \
-        if(p)                                                              \
-          goto l
-
-#define lambda(e, p, a, n)                                                 \
-        e = CDR(p.u.lambda);                                               \
-        if(n < 0)                                                          \
-        {                                                                  \
-          INT i = n;                                                       \
-	  struct svalue *t = &a;                                           \
-          while(++i)                                                       \
-            t = &CDR(t->u.pair);                                           \
-          garbcheck();                                                     \
-          t->u.pair = pair_list(process, t);                               \
-          t->type = T_PAIR;                                                \
-	}                                                                  \
-        cons(e, e, a)
-
-#define call_cc(r, l)                                                      \
-        r.type = T_LABEL;                                                  \
-        r.u.label = l;                                                     \
-        cons(r, argl, r);                                                  \
-        cons(r, cont, r);                                                  \
-        cons(r, env, r);                                                   \
-        cons(r, proc, r);                                                  \
-        cons(r, stack, r);                                                 \
-        r.type = T_CONTINUATION
-
-#define apply_lambda(l, a)                                                 \
-        if(IS_CONTINUATION(l))                                             \
-        {                                                                  \
-	  struct svalue t = l, u = a;                                      \
-          stack = CAR(t.u.pair);                                           \
-          t = CDR(t.u.pair);                                               \
-          proc = CAR(t.u.pair);                                            \
-          t = CDR(t.u.pair);                                               \
-          env = CAR(t.u.pair);                                             \
-          t = CDR(t.u.pair);                                               \
-          cont = CAR(t.u.pair);                                            \
-          t = CDR(t.u.pair);                                               \
-          argl = CAR(t.u.pair);                                            \
-          t = CDR(t.u.pair);                                               \
-          if(IS_NOT_PAIR(u))                                               \
-            kernel_error("To few arguments to continuation.");             \
-          val = CAR(u.u.pair);                                             \
-          if(IS_NOT_NIL(CDR(u.u.pair)))                                    \
-            kernel_error("To many arguments to continuation.");            \
-          jump(t);                                                         \
-        }                                                                  \
-        else if(IS_LAMBDA(l))                                              \
-        {                                                                  \
-          jump(CAR(l.u.lambda));                                           \
-        }                                                                  \
-        else                                                               \
-          kernel_error("Application not lambda.")
-
-#define trap(n, x)                                                         \
-        trap_get(&proc, n, &env);                                          \
-        if(IS_CONTINUATION(proc))                                          \
-        {                                                                  \
-	  struct svalue t = proc;                                          \
-          val = x;                                                         \
-          stack = CAR(t.u.pair);                                           \
-          t = CDR(t.u.pair);                                               \
-          proc = CAR(t.u.pair);                                            \
-          t = CDR(t.u.pair);                                               \
-          env = CAR(t.u.pair);                                             \
-          t = CDR(t.u.pair);                                               \
-          cont = CAR(t.u.pair);                                            \
-          t = CDR(t.u.pair);                                               \
-          argl = CAR(t.u.pair);                                            \
-          t = CDR(t.u.pair);                                               \
-          jump(t);                                                         \
-        } else                                                             \
-          err_fatal("Trap vector %d is not a continuation.", n)
-
-#define apply_bif(v, f, a)                                                 \
-        if(IS_NOT_BIF(f))                                                  \
-          kernel_error("Application not BIF.");                            \
-        f.u.bif(process, &v, &a);                                          \
-        if(process->error.type != T_UNDEFINED)                             \
-        {                                                                  \
-          v = process->error;                                              \
-          process->error.type = T_UNDEFINED;                               \
-          trap(0, v);                                                      \
-        } else do { } while(0)
-
-#define copy_list(r, l)                                                    \
-        r = l
-
-#define save(r)                                                            \
-        cons(stack, r, stack)
-
-#define restore(r)                                                         \
-        r = CAR(stack.u.pair);                                             \
-        stack = CDR(stack.u.pair)
-
-#define is_bif(x)   IS_BIF(x)
-
-#define is_false(x) IS_FALSE(x)
-
-#define get(r, m, n, e)                                                    \
-        env_get(&r, m, n, &e)
-
-#define set(r, m, n, e)                                                    \
-        env_set(&r, m, n, &e)
-
-#define define(r, e)                                                       \
-        env_define(process, &r, &e)
+#include "bif.h"
+#include "err.h"
+#include "garb.h"
+#include "mat.h"
+#include "pair.h"
+#include "process.h"
+#include "program.h"
+#include "stack.h"
+#include "str.h"
+#include "svalue.h"
+#include "vec.h"
+
+#include "instructions.h"
+
+/*
+ * The instructions are defined here once, as macros, for both the
+ * kernel and for programs compiled to C (see compiler-program->native-c).
+ * The registers and operands are given as arguments.  The includer
+ * defines how control is transferred:
+ *
+ *   KERNEL_GOTO(l)   continues at code offset l of the current program,
+ *   KERNEL_JUMP(r)   continues at the label or quits if r is undefined,
+ *   KERNEL_TRAP      continues at the error trap,
+ *   KERNEL_QUIT      stops the process,
+ *   KERNEL_CHECKED   is one if the code may be unverified.
+ *
+ * Otherwise an instruction continues with the one following it.
+ */
+
+#define REG_N(r) process->reg[r]
+#define REG_ARGL process->reg[REGISTER_ARGL]
+#define REG_CONT process->reg[REGISTER_CONT]
+#define REG_ENV  process->reg[REGISTER_ENV]
+#define REG_PROC process->reg[REGISTER_PROC]
+#define REG_VAL  process->reg[REGISTER_VAL]
+#define STACK    (&process->stack)
+#define ERROR    process->error
+
+#define PROGRAM_PC(l)                                                      \
+        ((l) + (UBYTE*)process->program.u.vec->v[PROGRAM_CODE].u.str->s)
+
+/* True when the code of the current program is verified, see
+   program_verify.  Checks that are only needed for code that is not
+   verified are made when KERNEL_CHECKED is one. */
+#define VERIFIED_PROGRAM(process)                                          \
+        ((process)->program.u.vec->v[PROGRAM_CODE].aux == PROGRAM_VERIFIED)
+
+/* True when the current program has native code. */
+#define NATIVE_PROGRAM(process)                                            \
+        ((process)->native &&                                              \
+         (process)->program.u.vec->v[PROGRAM_CODE].u.str ==                \
+         (process)->native_code.u.str)
+
+#define CONS(r, a, b)                                                      \
+        (r).u.pair = pair_cons(process, &(a), &(b));                       \
+        (r).type = T_PAIR
+
+#define LIST(r, a)                                                         \
+        (r).u.pair = pair_list(process, &(a));                             \
+        (r).type = T_PAIR
+
+#define CHECK_MEMORY                                                       \
+        if(process->gc || process->pair_heap.reduce)                       \
+          garb_and_reduce(process)
+
+/*
+ * An environment is a pair of its parent environment and its frame.
+ * The frame is a vector with one slot per argument and definition, or
+ * the empty list for a frame without slots.  The vector may be longer
+ * than the number of slots in use, see kernel_env_extend.
+ */
+#define ENV_FRAME(env)   (&CDR((env).u.pair))
+#define ENV_PARENT(env)  (CAR((env).u.pair))
+#define PROGRAM_FRAME    ENV_FRAME(process->program.u.vec->v[PROGRAM_ENV])
+
+#define CONSTANTS                                                          \
+        (process->program.u.vec->v[PROGRAM_CONSTANTS])
+
+#define CONSTANT(n)                                                        \
+        (CONSTANTS.u.vec->v[n])
+
+/* Restores from an empty stack are caught in code that is not
+   verified. */
+#define CHECK_STACK(n)                                                     \
+        if(KERNEL_CHECKED && STACK->used < (n))                            \
+          err_fatal("Stack underflow.")
+
+#define FRAME_SLOT(frame, n)                                               \
+        ((frame)->u.vec->v[n])
+
+/* The environments, frames and argument vectors that instructions refer
+   to are made at run time, where the verifier does not follow them, so
+   they are checked in all code. */
+#define CHECK_ENV(env)                                                     \
+        if(IS_NOT_PAIR(env))                                               \
+          err_fatal("Environment expected.")
+
+#define CHECK_SLOT(frame, n)                                               \
+        if(IS_NOT_VECTOR(*(frame)) || (n) < 0 ||                           \
+           (frame)->u.vec->length <= (n))                                  \
+          err_fatal("Variable %d out of range.", (n))
+
+void kernel_env_get(struct svalue *result, INT m, INT n, struct svalue *env);
+void kernel_env_set(struct svalue *value, INT m, INT n, struct svalue *env);
+void kernel_env_extend(struct process *process, INT n, struct svalue *env);
+void kernel_args_to_list(struct process *process);
+void kernel_apply_bif_to(struct process *process, bif_f *bif,
+			 struct svalue *result, struct svalue *a,
+			 struct svalue *b);
+void kernel_lambda(struct process *process, INT n, INT size);
+void kernel_values(struct process *process, struct svalue *result,
+		   struct svalue *args);
+void kernel_argl_values(struct process *process);
+void kernel_apply_continuation(struct process *process,
+			       struct svalue *label);
+void kernel_trap(struct process *process, struct svalue *label);
+void kernel_call_ec(struct process *process, INT l);
+void kernel_generator_resume(struct process *process, INT l,
+			     struct svalue *label);
+void kernel_generator_yield(struct process *process, INT l,
+			    struct svalue *label);
+
+void kernel(struct process *process);
+
+#define INSTR_exit()                                                       \
+        KERNEL_QUIT
+
+#define INSTR_save(r)                                                      \
+        STACK_PUSH(STACK, REG_N(r))
+
+#define INSTR_restore(r)                                                   \
+        do {                                                               \
+          CHECK_STACK(1);                                                  \
+          STACK_POP(STACK, REG_N(r));                                      \
+        } while(0)
+
+#define INSTR_list(r, r2)                                                  \
+        do {                                                               \
+          LIST(REG_N(r), REG_N(r2));                                       \
+        } while(0)
+
+#define INSTR_cons(r, r2, r3)                                              \
+        do {                                                               \
+          CONS(REG_N(r), REG_N(r2), REG_N(r3));                            \
+        } while(0)
+
+#define INSTR_apply_bif(r)                                                 \
+        do {                                                               \
+          CHECK_MEMORY;                                                    \
+          if(KERNEL_CHECKED && IS_NOT_BIF(REG_PROC))                       \
+            err_fatal("Application not BIF.");                             \
+          if(IS_VECTOR(REG_ARGL))                                          \
+            kernel_args_to_list(process);                                  \
+          REG_PROC.u.bif(process, &REG_N(r), &REG_ARGL);                   \
+          if(ERROR.type != T_UNDEFINED)                                    \
+            KERNEL_TRAP;                                                   \
+        } while(0)
+
+#define INSTR_apply_lambda()                                               \
+        do {                                                               \
+          struct svalue label_;                                            \
+                                                                           \
+          CHECK_MEMORY;                                                    \
+          if(IS_LAMBDA(REG_PROC))                                          \
+            label_ = CAR(REG_PROC.u.pair);                                 \
+          else                                                             \
+            kernel_apply_continuation(process, &label_);                   \
+          KERNEL_JUMP(label_);                                             \
+        } while(0)
+
+#define INSTR_assign(r, r2)                                                \
+        REG_N(r) = REG_N(r2)
+
+#define INSTR_assign_nil(r)                                                \
+        REG_N(r).type = T_NIL
+
+#define INSTR_assign_true(r)                                               \
+        REG_N(r).type = T_TRUE
+
+#define INSTR_assign_false(r)                                              \
+        REG_N(r).type = T_FALSE
+
+#define INSTR_assign_undefined(r)                                          \
+        REG_N(r).type = T_UNDEFINED
+
+#define INSTR_assign_small_integer(r, n)                                   \
+        do {                                                               \
+          REG_N(r).u.integer = (n);                                        \
+          REG_N(r).type = T_SMALL_INTEGER;                                 \
+        } while(0)
+
+#define INSTR_assign_character(r, n)                                       \
+        do {                                                               \
+          REG_N(r).u.integer = (n);                                        \
+          REG_N(r).type = T_CHAR;                                          \
+        } while(0)
+
+#define INSTR_assign_bif(r, n)                                             \
+        do {                                                               \
+          REG_N(r).u.bif = bifs[n].bif;                                    \
+          REG_N(r).type = T_BIF;                                           \
+          if(KERNEL_CHECKED && !REG_N(r).u.bif)                            \
+            err_fatal("BIF %d not implemented.", (n));                     \
+        } while(0)
+
+#define INSTR_assign_lambda(r, l)                                          \
+        do {                                                               \
+          REG_N(r).type = T_LABEL;                                         \
+          REG_N(r).aux = (l);                                              \
+          REG_N(r).u.vec = process->program.u.vec;                         \
+          REG_N(r).u.pair = pair_cons(process, &REG_N(r), &REG_ENV);       \
+          REG_N(r).type = T_LAMBDA;                                        \
+        } while(0)
+
+#define INSTR_assign_label(l)                                              \
+        do {                                                               \
+          REG_CONT.aux = (l);                                              \
+          REG_CONT.u.vec = process->program.u.vec;                         \
+          REG_CONT.type = T_LABEL;                                         \
+        } while(0)
+
+#define INSTR_assign_constant(r, n)                                        \
+        do {                                                               \
+          if(KERNEL_CHECKED && (IS_NOT_VECTOR(CONSTANTS) ||                \
+                                CONSTANTS.u.vec->length <= (n)))           \
+            err_fatal("Constant %d out of range.", (n));                   \
+          REG_N(r) = CONSTANT(n);                                          \
+        } while(0)
+
+#define INSTR_call_cc(l)                                                   \
+        do {                                                               \
+          REG_ARGL.type = T_LABEL;                                         \
+          REG_ARGL.aux = (l);                                              \
+          REG_ARGL.u.vec = process->program.u.vec;                         \
+          CONS(REG_ARGL, REG_ARGL, REG_ARGL);                              \
+          CONS(REG_ARGL, REG_CONT, REG_ARGL);                              \
+          CONS(REG_ARGL, REG_ENV, REG_ARGL);                               \
+          CONS(REG_ARGL, REG_PROC, REG_ARGL);                              \
+          CONS(REG_ARGL, REG_ARGL, REG_ARGL);                              \
+          stack_capture(process, &CAR(REG_ARGL.u.pair));                   \
+          REG_ARGL.type = T_CONTINUATION;                                  \
+          LIST(REG_ARGL, REG_ARGL);                                        \
+        } while(0)
+
+#define INSTR_call_ec(l)                                                   \
+        kernel_call_ec(process, (l))
+
+#define INSTR_values(r)                                                    \
+        kernel_values(process, &REG_N(r), &REG_ARGL)
+
+#define INSTR_argl_values()                                                \
+        kernel_argl_values(process)
+
+#define INSTR_generator_resume(l)                                          \
+        do {                                                               \
+          struct svalue label_;                                            \
+                                                                           \
+          kernel_generator_resume(process, (l), &label_);                  \
+          KERNEL_JUMP(label_);                                             \
+        } while(0)
+
+#define INSTR_generator_yield(l)                                           \
+        do {                                                               \
+          struct svalue label_;                                            \
+                                                                           \
+          kernel_generator_yield(process, (l), &label_);                   \
+          KERNEL_JUMP(label_);                                             \
+        } while(0)
+
+#define INSTR_branch_bif(l)                                                \
+        do {                                                               \
+          if(IS_BIF(REG_PROC))                                             \
+            KERNEL_GOTO(l);                                                \
+        } while(0)
+
+#define INSTR_goto(l)                                                      \
+        KERNEL_GOTO(l)
+
+#define INSTR_jump()                                                       \
+        KERNEL_JUMP(REG_CONT)
+
+#define INSTR_branch(l)                                                    \
+        do {                                                               \
+          if(IS_FALSE(REG_VAL))                                            \
+            KERNEL_GOTO(l);                                                \
+        } while(0)
+
+/* The name of the procedure is the index of a symbol constant, or -1.
+   It is only read by the sampling profiler. */
+#define INSTR_lambda(n, m, name)                                           \
+        kernel_lambda(process, (n), (m))
+
+#define INSTR_get(r, m, n)                                                 \
+        kernel_env_get(&REG_N(r), (m), (n), &REG_ENV)
+
+#define INSTR_set(r, m, n)                                                 \
+        do {                                                               \
+          kernel_env_set(&REG_N(r), (m), (n), &REG_ENV);                   \
+          REG_N(r).type = T_UNDEFINED;                                     \
+        } while(0)
+
+#define INSTR_env_extend(n)                                                \
+        do {                                                               \
+          CHECK_ENV(REG_ENV);                                              \
+          kernel_env_extend(process, (n), &REG_ENV);                       \
+        } while(0)
+
+#define INSTR_load_env()                                                   \
+        REG_ENV = process->program.u.vec->v[PROGRAM_ENV]
+
+#define INSTR_save2(r, r2)                                                 \
+        do {                                                               \
+          STACK_PUSH(STACK, REG_N(r));                                     \
+          STACK_PUSH(STACK, REG_N(r2));                                    \
+        } while(0)
+
+#define INSTR_restore2(r, r2)                                              \
+        do {                                                               \
+          CHECK_STACK(2);                                                  \
+          STACK_POP(STACK, REG_N(r));                                      \
+          STACK_POP(STACK, REG_N(r2));                                     \
+        } while(0)
+
+/* get r2 m n, list r r2 */
+#define INSTR_get_list(r, r2, m, n)                                        \
+        do {                                                               \
+          kernel_env_get(&REG_N(r2), (m), (n), &REG_ENV);                  \
+          LIST(REG_N(r), REG_N(r2));                                       \
+        } while(0)
+
+/* get r2 m n, cons r r2 r3 */
+#define INSTR_get_cons(r, r2, r3, m, n)                                    \
+        do {                                                               \
+          kernel_env_get(&REG_N(r2), (m), (n), &REG_ENV);                  \
+          CONS(REG_N(r), REG_N(r2), REG_N(r3));                            \
+        } while(0)
+
+/* assign_bif proc n, goto l, where l holds an apply_bif. */
+#define INSTR_call_bif(l, n)                                               \
+        do {                                                               \
+          INSTR_assign_bif(REGISTER_PROC, n);                              \
+          KERNEL_GOTO(l);                                                  \
+        } while(0)
+
+/* assign_label l, apply_lambda */
+#define INSTR_call_lambda(l)                                               \
+        do {                                                               \
+          INSTR_assign_label(l);                                           \
+          INSTR_apply_lambda();                                            \
+        } while(0)
+
+/* Gets slot n of the frame of the environment, or of its parent. */
+#define GET_FRAME0(r, n)                                                   \
+        do {                                                               \
+          CHECK_ENV(REG_ENV);                                              \
+          CHECK_SLOT(ENV_FRAME(REG_ENV), n);                               \
+          REG_N(r) = FRAME_SLOT(ENV_FRAME(REG_ENV), n);                    \
+        } while(0)
+
+#define FRAME1(frame)                                                      \
+        do {                                                               \
+          CHECK_ENV(REG_ENV);                                              \
+          CHECK_ENV(ENV_PARENT(REG_ENV));                                  \
+          (frame) = ENV_FRAME(ENV_PARENT(REG_ENV));                        \
+        } while(0)
+
+#define FRAME_TOP(frame)                                                   \
+        do {                                                               \
+          CHECK_ENV(process->program.u.vec->v[PROGRAM_ENV]);               \
+          (frame) = PROGRAM_FRAME;                                         \
+        } while(0)
+
+#define INSTR_get0_0(r)                                                    \
+        GET_FRAME0(r, 0)
+
+#define INSTR_get0_1(r)                                                    \
+        GET_FRAME0(r, 1)
+
+#define INSTR_get0_2(r)                                                    \
+        GET_FRAME0(r, 2)
+
+#define INSTR_get0_3(r)                                                    \
+        GET_FRAME0(r, 3)
+
+#define INSTR_get0(r, n)                                                   \
+        GET_FRAME0(r, n)
+
+#define INSTR_get1(r, n)                                                   \
+        do {                                                               \
+          struct svalue *frame_;                                           \
+                                                                           \
+          FRAME1(frame_);                                                  \
+          CHECK_SLOT(frame_, n);                                           \
+          REG_N(r) = FRAME_SLOT(frame_, n);                                \
+        } while(0)
+
+#define INSTR_get_top(r, n)                                                \
+        do {                                                               \
+          struct svalue *frame_;                                           \
+                                                                           \
+          FRAME_TOP(frame_);                                               \
+          CHECK_SLOT(frame_, n);                                           \
+          REG_N(r) = FRAME_SLOT(frame_, n);                                \
+        } while(0)
+
+#define INSTR_set0(r, n)                                                   \
+        do {                                                               \
+          CHECK_ENV(REG_ENV);                                              \
+          CHECK_SLOT(ENV_FRAME(REG_ENV), n);                               \
+          FRAME_SLOT(ENV_FRAME(REG_ENV), n) = REG_N(r);                    \
+          REG_N(r).type = T_UNDEFINED;                                     \
+        } while(0)
+
+#define INSTR_set1(r, n)                                                   \
+        do {                                                               \
+          struct svalue *frame_;                                           \
+                                                                           \
+          FRAME1(frame_);                                                  \
+          CHECK_SLOT(frame_, n);                                           \
+          FRAME_SLOT(frame_, n) = REG_N(r);                                \
+          REG_N(r).type = T_UNDEFINED;                                     \
+        } while(0)
+
+#define INSTR_set_top(r, n)                                                \
+        do {                                                               \
+          struct svalue *frame_;                                           \
+                                                                           \
+          FRAME_TOP(frame_);                                               \
+          CHECK_SLOT(frame_, n);                                           \
+          FRAME_SLOT(frame_, n) = REG_N(r);                                \
+          REG_N(r).type = T_UNDEFINED;                                     \
+        } while(0)
+
+/* Allocates the argument vector and sets its last argument, which is
+   evaluated first. */
+#define INSTR_arg_first(r, r2, n)                                          \
+        do {                                                               \
+          if(KERNEL_CHECKED && (n) < 1)                                    \
+            err_fatal("Argument vector out of range.");                    \
+          REG_N(r).u.vec = vec_allocate(&process->vec_heap, (n));          \
+          REG_N(r).type = T_VECTOR;                                        \
+          REG_N(r).u.vec->v[(n)-1] = REG_N(r2);                            \
+        } while(0)
+
+#define INSTR_arg(r, r2, n)                                                \
+        do {                                                               \
+          CHECK_SLOT(&REG_N(r), n);                                        \
+          REG_N(r).u.vec->v[n] = REG_N(r2);                                \
+        } while(0)
+
+/* The arithmetic instructions compute r = r2 op r3 on small integers
+   and leave anything else, overflow included, to the BIF. */
+#define ARITHMETIC(op, bif, r, r2, r3)                                     \
+        do {                                                               \
+          INT n_, tmp_;                                                    \
+                                                                           \
+          if(IS_SMALL_INTEGER(REG_N(r2)) && IS_SMALL_INTEGER(REG_N(r3)) && \
+             op(n_, REG_N(r2).u.integer, REG_N(r3).u.integer, tmp_))       \
+          {                                                                \
+            REG_N(r).u.integer = n_;                                       \
+            REG_N(r).type = T_SMALL_INTEGER;                               \
+          }                                                                \
+          else                                                             \
+          {                                                                \
+            kernel_apply_bif_to(process, bif, &REG_N(r), &REG_N(r2),       \
+                                &REG_N(r3));                               \
+            if(ERROR.type != T_UNDEFINED)                                  \
+              KERNEL_TRAP;                                                 \
+          }                                                                \
+        } while(0)
+
+#define INSTR_plus(r, r2, r3)                                              \
+        ARITHMETIC(MAT_ADD, bif_plus, r, r2, r3)
+
+#define INSTR_minus(r, r2, r3)                                             \
+        ARITHMETIC(MAT_SUB, bif_minus, r, r2, r3)
+
+#define INSTR_times(r, r2, r3)                                             \
+        ARITHMETIC(MAT_MULTIPLY, bif_times, r, r2, r3)
+
+#define INSTR_less(r, r2, r3)                                              \
+        do {                                                               \
+          if(IS_SMALL_INTEGER(REG_N(r2)) && IS_SMALL_INTEGER(REG_N(r3)))   \
+            REG_N(r).type = REG_N(r2).u.integer < REG_N(r3).u.integer ?    \
+                            T_TRUE : T_FALSE;                              \
+          else                                                             \
+          {                                                                \
+            kernel_apply_bif_to(process, bif_less, &REG_N(r), &REG_N(r2),  \
+                                &REG_N(r3));                               \
+            if(ERROR.type != T_UNDEFINED)                                  \
+              KERNEL_TRAP;                                                 \
+          }                                                                \
+        } while(0)
+
+/* eq? cannot fail, so there is no need to go through bif_eq. */
+#define INSTR_eq(r, r2, r3)                                                \
+        do {                                                               \
+          if(IS_SMALL_INTEGER(REG_N(r2)) && IS_SMALL_INTEGER(REG_N(r3)))   \
+            REG_N(r).type = REG_N(r2).u.integer == REG_N(r3).u.integer ?   \
+                            T_TRUE : T_FALSE;                              \
+          else                                                             \
+            REG_N(r).type = svalue_eq(&REG_N(r2), &REG_N(r3)) ?            \
+                            T_TRUE : T_FALSE;                              \
+        } while(0)
+
+/* The BIF reports the error when the argument is not a pair. */
+#define INSTR_car(r, r2)                                                   \
+        do {                                                               \
+          if(IS_PAIR(REG_N(r2)))                                           \
+            REG_N(r) = CAR(REG_N(r2).u.pair);                              \
+          else                                                             \
+          {                                                                \
+            kernel_apply_bif_to(process, bif_car, &REG_N(r), &REG_N(r2),   \
+                                0);                                        \
+            KERNEL_TRAP;                                                   \
+          }                                                                \
+        } while(0)
+
+#define INSTR_cdr(r, r2)                                                   \
+        do {                                                               \
+          if(IS_PAIR(REG_N(r2)))                                           \
+            REG_N(r) = CDR(REG_N(r2).u.pair);                              \
+          else                                                             \
+          {                                                                \
+            kernel_apply_bif_to(process, bif_cdr, &REG_N(r), &REG_N(r2),   \
+                                0);                                        \
+            KERNEL_TRAP;                                                   \
+          }                                                                \
+        } while(0)
+
+#define INSTR_nullp(r, r2)                                                 \
+        REG_N(r).type = IS_NULL(REG_N(r2)) ? T_TRUE : T_FALSE
+
+#define INSTR_pairp(r, r2)                                                 \
+        REG_N(r).type = IS_PAIR(REG_N(r2)) ? T_TRUE : T_FALSE
+
+#define INSTR_not(r, r2)                                                   \
+        REG_N(r).type = IS_FALSE(REG_N(r2)) ? T_TRUE : T_FALSE
+
+#define INSTR_unknown(i)                                                   \
+        err_fatal("Unknown instruction: %d.", (i))
 
 #endif /* __KERNEL_H__ */
+
+/*
+ * Control transfers for native code, which is one C function for the
+ * whole program.  It is entered at a code offset and dispatches on it
+ * to the label of that offset.  Jumps to labels in the same program
+ * dispatch likewise, while jumps to other programs return their program
+ * counter to the kernel.  The function is written like this:
+ *
+ *   UBYTE *bootstrap_native(struct process *process, INT offset)
+ *   {
+ *    dispatch:
+ *     switch(offset)
+ *     {
+ *       case 12: goto L12;
+ *       ...
+ *     }
+ *     return PROGRAM_PC(offset);
+ *    trap:
+ *     NATIVE_TRAP;
+ *    L12:
+ *     INSTR_env_extend(40);
+ *     ...
+ *   }
+ */
+#if defined(KERNEL_NATIVE) && !defined(KERNEL_GOTO)
+
+#ifndef KERNEL_CHECKED
+#define KERNEL_CHECKED 1
+#endif /* KERNEL_CHECKED */
+
+#define KERNEL_GOTO(l)                                                     \
+        goto L##l
+
+#define KERNEL_JUMP(r)                                                     \
+        do {                                                               \
+          struct svalue tmp_ = (r);                                        \
+          if(tmp_.type == T_UNDEFINED)                                     \
+            return 0;                                                      \
+          process->program.u.vec = tmp_.u.vec;                             \
+          offset = tmp_.aux;                                               \
+          if(NATIVE_PROGRAM(process))                                      \
+            goto dispatch;                                                 \
+          return PROGRAM_PC(offset);                                       \
+        } while(0)
+
+#define KERNEL_TRAP                                                        \
+        goto trap
+
+#define KERNEL_QUIT                                                        \
+        return 0
+
+/* Uses up a reduction on entry to a procedure at offset l.  Threads are
+   only switched by the kernel, so the native code returns to it at the
+   lambda instruction when none are left. */
+#define NATIVE_ENTER(l)                                                    \
+        do {                                                               \
+          if(process->threads.reductions <= 0)                             \
+            return PROGRAM_PC(l);                                          \
+          process->threads.reductions--;                                   \
+        } while(0)
+
+#define NATIVE_TRAP                                                        \
+        do {                                                               \
+          struct svalue label_;                                            \
+                                                                           \
+          kernel_trap(process, &label_);                                   \
+          KERNEL_JUMP(label_);                                             \
+        } while(0)
+
+#endif /* KERNEL_NATIVE && !KERNEL_GOTO */
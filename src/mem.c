@@ -17,9 +17,23 @@
 #include "err.h"
 #include "exit.h"
 #include "mem.h"
+#include "process.h"
 
+/* The number of allocations, which are checked to be freed at exit.
+   Each process that runs on a thread of its own counts them in its
+   struct process instead, which is added to this when the thread has
+   quit, so that processes in parallel share no counter. */
 static INT sizeof_allocations;
 
+#ifdef PROCESS_PARALLEL
+static __thread INT *mem_counter;
+#else
+static INT *mem_counter;
+#endif /* PROCESS_PARALLEL */
+
+#define MEM_COUNT(n)                                                       \
+        (*(mem_counter ? mem_counter : &sizeof_allocations) += (n))
+
 static void mem_exit(void)
 {
   if(sizeof_allocations)
@@ -33,11 +47,29 @@ void mem_init(void)
   EXIT_REGISTER(mem_exit);
 }
 
+/* Counts the allocations of the calling thread in count from now on, or
+   in the count checked at exit when it is zero.  Returns where they
+   were counted before. */
+INT *mem_count(INT *count)
+{
+  INT *before = mem_counter;
+
+  mem_counter = count;
+  return before;
+}
+
+/* Adds a count left by a thread that has quit to that of the calling
+   thread. */
+void mem_count_add(INT n)
+{
+  MEM_COUNT(n);
+}
+
 void* mem_allocate_zeroed(INT amount)
 {
   void *ptr;
 
-  sizeof_allocations++;
+  MEM_COUNT(1);
   
   ptr = calloc(amount, 1);
   if(ptr == 0)
@@ -53,9 +85,9 @@ void* mem_allocate(INT amount)
 void *mem_reallocate(void *ptr, INT amount)
 {
   if(!ptr && amount)
-    sizeof_allocations++;
+    MEM_COUNT(1);
   if(ptr && !amount)
-    sizeof_allocations--;
+    MEM_COUNT(-1);
   
   ptr = realloc(ptr, amount);
   
@@ -76,7 +108,7 @@ void *mem_duplicate(void *ptr, INT amount)
 
 void mem_free(void *ptr)
 {
-  sizeof_allocations--;
+  MEM_COUNT(-1);
   free(ptr);
 }
 
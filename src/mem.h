@@ -8,6 +8,8 @@
 #include <string.h>
 
 void mem_init(void);
+INT *mem_count(INT *count);
+void mem_count_add(INT n);
 
 void *mem_allocate_zeroed(INT amount);
 void *mem_allocate(INT amount);
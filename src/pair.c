@@ -117,6 +117,18 @@ static struct pair *pair_void(struct process *process)
   return pair;
 }
 
+/* Makes room for n pairs, so that as many can be consed without a
+   garbage collection. */
+void pair_reserve(struct process *process, INT n)
+{
+  struct pair_heap *heap = &process->pair_heap;
+
+  if(heap->size - heap->used < n)
+    garb(process);
+  if(heap->size - heap->used < n)
+    pair_allocate_heap(heap, n - (heap->size - heap->used));
+}
+
 struct pair *pair_cons(struct process *process,
 		       struct svalue *car, struct svalue *cdr)
 {
@@ -42,6 +42,7 @@ void pair_destroy(struct pair_heap *heap);
 INT pair_debug_objects(struct pair_heap *heap);
 INT pair_debug_objects_used(struct pair_heap *heap);
 
+void pair_reserve(struct process *process, INT n);
 struct pair *pair_cons(struct process *process,
 		       struct svalue *car, struct svalue *cdr);
 struct pair *pair_list(struct process *process, struct svalue *car);
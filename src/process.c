@@ -10,18 +10,27 @@
 
 #include "types.h"
 
+#include "args.h"
+#include "copy.h"
 #include "err.h"
 #include "mem.h"
 #include "exit.h"
+#include "future.h"
+#include "jit.h"
+#include "kernel.h"
 #include "process.h"
 #include "pair.h"
+#include "program.h"
+#include "stack.h"
 #include "str.h"
 #include "vec.h"
 #include "invocation.h"
 
 #include "bootstrap.h"
 
-void process_create(struct process *process, struct invocation *invocation)
+/* Creates a process without a program. */
+static void process_setup(struct process *process,
+			  struct invocation *invocation)
 {
   INT i;
   
@@ -43,29 +52,31 @@ void process_create(struct process *process, struct invocation *invocation)
   process->reg[REGISTER_VAL].type  = T_UNDEFINED;
 
   process->program.type = T_UNDEFINED;
-  process->stack.type = T_UNDEFINED;
+  stack_create(&process->stack);
   process->error.type = T_UNDEFINED;
+  process->escape_count = 0;
+  process->allocations = 0;
 
   /* Start program at jump label zero. */
   process->label = 0;
   
-  /* No PIDs are invented, yet. */
+  /* The first process has PID zero, and numbers those it spawns. */
   process->pid = 0;
+  process->next_pid = 1;
+  process->children = 0;
+  process->root = process;
+  process->channels = 0;
+  process->pool = 0;
+  process->worker = 0;
+  process->futures_size = process->futures_used = 0;
+  process->futures = 0;
 
   /* Set invocation parameters. */
   process->invocation = invocation;
 
-  /* Reset program. */
-  process->program.u.vec = vec_allocate(&process->vec_heap, 3);
-  process->program.type = T_VECTOR;
-  process->program.u.vec->v[1].u.str = str_allocate(&process->str_heap,
-						    (char*)bootstrap_code,
-						    bootstrap_size);
-  process->program.u.vec->v[1].type = T_STRING;
-  process->program.u.vec->v[2].u.pair = pair_nil(process);
-  process->program.u.vec->v[2].type = T_PAIR;
-
-  process->pc = (UBYTE*)process->program.u.vec->v[1].u.str->s;
+  process->pc = 0;
+  process->native = 0;
+  process->native_code.type = T_UNDEFINED;
 
   /* Traps. */
   for(i = 0; i < N_TRAPS; i++)
@@ -73,20 +84,239 @@ void process_create(struct process *process, struct invocation *invocation)
   
   /* Garbage collector. */
   process->gc = 0;
+
+  /* The process starts with its main thread. */
+  thread_create(&process->threads);
+
+  /* Native code is only compiled when asked for. */
+  jit_create(&process->jit);
   
   /* Reset debug information. */
-  process->trace = 0;
+  process->instrument = 0;
+  profile_create(&process->profile);
+}
+
+void process_create(struct process *process, struct invocation *invocation)
+{
+  struct str *code;
+  char *msg;
+
+  process_setup(process, invocation);
+
+  /* Reset program. */
+  code = str_allocate(&process->str_heap, (char*)bootstrap_code,
+		      bootstrap_size);
+  if((msg = program_check(code)))
+    err_fatal("Bootstrap: %s", msg);
+  
+  process->program.u.vec = vec_allocate(&process->vec_heap, PROGRAM_SIZE);
+  process->program.type = T_VECTOR;
+  process->program.u.vec->v[PROGRAM_CODE].u.str = code;
+  process->program.u.vec->v[PROGRAM_CODE].type = T_STRING;
+  process->program.u.vec->v[PROGRAM_ENV].u.pair = pair_nil(process);
+  process->program.u.vec->v[PROGRAM_ENV].type = T_PAIR;
+  if((msg = program_constants(process, code,
+			      &process->program.u.vec->v[PROGRAM_CONSTANTS])) ||
+     (msg = program_verify(code,
+			   &process->program.u.vec->v[PROGRAM_CONSTANTS])))
+    err_fatal("Bootstrap: %s", msg);
+  process->program.u.vec->v[PROGRAM_CODE].aux = PROGRAM_VERIFIED;
+
+  process->pc = (UBYTE*)code->s + BYTECODE_HEADER_SIZE;
+
+#ifdef BOOTSTRAP_NATIVE
+  process->native = bootstrap_native;
+  process->native_code = process->program.u.vec->v[PROGRAM_CODE];
+#endif /* BOOTSTRAP_NATIVE */
+}
+
+/* Runs a spawned process until it quits, and leaves a copy of its value
+   before it is destroyed. */
+static void *process_run(void *data)
+{
+  struct child *child = data;
+  INT *count;
+
+  count = mem_count(&child->process->allocations);
+  kernel(child->process);
+  copy_out(&child->result, &child->process->reg[REGISTER_VAL], 1);
+  process_destroy(child->process);
+
+  /* The count is left with the child for the process that reaps it. */
+  child->allocations = child->process->allocations;
+  mem_count(&child->allocations);
+  mem_free(child->process);
+  child->process = 0;
+  mem_count(count);
+
+  return 0;
+}
+
+/* Waits for a spawned process to quit, and forgets it. */
+static void process_reap(struct process *process, struct child *child)
+{
+  struct child **prev;
+
+#ifdef PROCESS_PARALLEL
+  pthread_join(child->thread, 0);
+#endif /* PROCESS_PARALLEL */
+  mem_count_add(child->allocations);
+
+  for(prev = &process->children; *prev != child; prev = &(*prev)->next)
+    ;
+  *prev = child->next;
 }
 
 void process_destroy(struct process *process)
 {
+  struct child *child;
+
+  /* Processes still running are waited for. */
+  while((child = process->children))
+  {
+    process_reap(process, child);
+    copy_destroy(&child->result);
+    mem_free(child);
+  }
+  future_forget(process);
+  if(process->pool)
+    pool_destroy(process->pool);
+  channel_destroy(process->channels);
+
   /* Wipe out heaps and indices. */
 #ifdef USE_BIG_INTEGERS
   big_destroy(&process->big_heap);
 #endif /* USE_BIG_INTEGERS */
   
+  /* The opcode profile is reported when it is on at exit, and the
+     samples are written when there is a file for them. */
+  if(process->instrument & INSTRUMENT_OPCODES)
+    profile_report(&process->profile);
+  if(process->profile.samples_file)
+    profile_write_samples(&process->profile);
+  profile_destroy(&process->profile);
+  jit_destroy(&process->jit);
+  thread_destroy(&process->threads);
+  stack_destroy(&process->stack);
   map_destroy(&process->map_heap);
   str_destroy(&process->str_heap);
   vec_destroy(&process->vec_heap);
   pair_destroy(&process->pair_heap);
 }
+
+/* Sets up a process spawned by another, without a program.  It is
+   compiled and scheduled the same way as its parent. */
+void process_child(struct process *process, struct process *parent)
+{
+  process_setup(process, parent->invocation);
+  process->root = parent->root;
+  process->jit.enabled = parent->jit.enabled;
+  process->threads.budget = parent->threads.budget;
+}
+
+/* Copies out what another process needs to call the procedure: the
+   procedure, the native code it runs and the traps. */
+void process_copy_call(struct process *process, struct svalue *procedure,
+		       struct copy *copy)
+{
+  struct svalue call[N_TRAPS+2];
+  INT i;
+
+  call[0] = *procedure;
+  call[1] = process->native_code;
+  for(i = 0; i < N_TRAPS; i++)
+    call[i+2] = process->trap[i];
+
+  copy_out(copy, call, N_TRAPS+2);
+}
+
+/* Copies the call into the process, which calls the procedure without
+   arguments when it runs next, and quits when the procedure returns to
+   the undefined continuation. */
+void process_call(struct process *process, struct copy *copy)
+{
+  struct svalue call[N_TRAPS+2], label;
+  INT i;
+
+  copy_in(process, copy, call);
+
+  for(i = 0; i < N_TRAPS; i++)
+    process->trap[i] = call[i+2];
+
+#ifdef BOOTSTRAP_NATIVE
+  /* It runs the same native code as the process it came from. */
+  if(IS_STRING(call[1]))
+  {
+    process->native = bootstrap_native;
+    process->native_code = call[1];
+  }
+#endif /* BOOTSTRAP_NATIVE */
+
+  /* The procedure starts at its lambda instruction. */
+  process->reg[REGISTER_PROC] = call[0];
+  process->reg[REGISTER_ARGL].type = T_NIL;
+  process->reg[REGISTER_CONT].type = T_UNDEFINED;
+  label = CAR(call[0].u.pair);
+  process->program.u.vec = label.u.vec;
+  process->program.type = T_VECTOR;
+  process->pc = label.aux + (UBYTE *)label.u.vec->v[PROGRAM_CODE].u.str->s;
+}
+
+/* Returns the PID of a new process that calls the given procedure
+   without arguments.  The process gets a copy of the procedure and of
+   the traps, and runs in parallel with the one that spawned it. */
+BIF_DECLARE(bif_process_spawn)
+{
+  struct svalue *procedure;
+  struct process *spawned;
+  struct child *child;
+  struct copy copy;
+
+  ARGS_GET((process, "process-spawn", args, "%*", &procedure));
+
+  if(IS_NOT_LAMBDA(*procedure))
+    ARGS_ERROR((process, "process-spawn", "Procedure expected."));
+
+  child = mem_allocate_zeroed(sizeof(struct child));
+  child->id = process->next_pid++;
+  child->process = spawned = mem_allocate_zeroed(sizeof(struct process));
+  process_child(spawned, process);
+  spawned->pid = child->id;
+
+  process_copy_call(process, procedure, &copy);
+  process_call(spawned, &copy);
+  copy_destroy(&copy);
+
+  child->next = process->children;
+  process->children = child;
+
+#ifdef PROCESS_PARALLEL
+  if(pthread_create(&child->thread, 0, process_run, child))
+    err_fatal("Cannot create a thread for process %d.", child->id);
+#else
+  process_run(child);
+#endif /* PROCESS_PARALLEL */
+
+  BIF_RESULT_SMALL_INTEGER(child->id);
+}
+
+/* Waits for the given process to quit, and returns a copy of its value.
+   A process can only be joined once. */
+BIF_DECLARE(bif_process_join)
+{
+  struct child *child;
+  INT pid;
+
+  ARGS_GET((process, "process-join", args, "%i", &pid));
+
+  for(child = process->children; child; child = child->next)
+    if(child->id == pid)
+      break;
+  if(!child)
+    ARGS_ERROR((process, "process-join", "No process %d to join.", pid));
+
+  process_reap(process, child);
+  copy_in(process, &child->result, result);
+  copy_destroy(&child->result);
+  mem_free(child);
+}
@@ -13,11 +13,26 @@ struct process;
 #include "types.h"
 
 #include "big.h"
+#include "bif.h"
+#include "channel.h"
+#include "copy.h"
+#include "jit.h"
+#include "profile.h"
 #include "map.h"
 #include "pair.h"
+#include "stack.h"
 #include "str.h"
+#include "thread.h"
 #include "vec.h"
 
+/* Processes run in parallel on threads of their own when there are
+   POSIX threads, and atomic builtins to share memory with. */
+#if defined(HAVE_LIBPTHREAD) && defined(HAVE_PTHREAD_H) && \
+    defined(__GNUC__) && !defined(NO_PARALLEL_PROCESSES)
+#define PROCESS_PARALLEL
+#include <pthread.h>
+#endif /* HAVE_LIBPTHREAD && __GNUC__ && !NO_PARALLEL_PROCESSES */
+
 #define N_REGISTERS 5
 
 #define REGISTER_ARGL 0
@@ -30,23 +45,89 @@ struct process;
 
 #define TRAP_ERROR 0
 
+#define INSTRUMENT_TRACE   1
+#define INSTRUMENT_OPCODES 2
+#define INSTRUMENT_SAMPLE  4
+
+/* The registers and control stack of a thread, see thread.c.  Those of
+   the running thread are kept in the process itself. */
+struct thread
+{
+  INT id, state;
+
+  struct svalue reg[N_REGISTERS];
+  struct stack stack;
+  struct svalue program;
+  UBYTE *pc;
+  struct svalue trap[N_TRAPS];
+
+  /* The thread joined, the time to wake up at in seconds, and the
+     value a done thread returned. */
+  INT join;
+  double wake;
+  struct svalue result;
+};
+
+/* A process spawned by another, see process.c.  It shares nothing with
+   its parent, and leaves a copy of its value when it quits. */
+struct child
+{
+  INT id;
+  struct child *next;
+
+  struct process *process;
+  struct copy result;
+
+  /* The allocations counted by the process when it quit, see mem.c. */
+  INT allocations;
+
+#ifdef PROCESS_PARALLEL
+  pthread_t thread;
+#endif /* PROCESS_PARALLEL */
+};
+
+/* Programs compiled to C run from a code offset and return the program
+   counter at which the kernel is to continue, or zero to quit. */
+typedef UBYTE *(native_f)(struct process *process, INT offset);
+
 struct process
 {
-  /* Process identification. */
-  INT pid;
+  /* Process identification, and the processes spawned and not yet
+     joined. */
+  INT pid, next_pid;
+  struct child *children;
+
+  /* The first process, which the channels of all belong to. */
+  struct process *root;
+  struct channel *channels;
+
+  /* The workers that run futures, which belong to the first process,
+     the worker this process is, if any, and a hash table of the futures
+     it made and has not yet touched, see future.c. */
+  struct pool *pool;
+  struct worker *worker;
+  INT futures_size, futures_used;
+  struct future **futures;
 
   /* Invocation parameters. */
   struct invocation *invocation;
 
   /* Registers. */
   struct svalue reg[N_REGISTERS];
-  struct svalue stack;
+  struct stack stack;
 
   /* Jump label. */
   INT label;
 
   /* Error management. */
   struct svalue error;
+
+  /* The number of the last escape procedure made, see kernel.c. */
+  INT escape_count;
+
+  /* The allocations made less those freed while this process runs on
+     a thread of its own, see mem.c. */
+  INT allocations;
   
   /* Assorted heaps. */
   struct pair_heap pair_heap;
@@ -67,12 +148,32 @@ struct process
 
   /* Garbage collector.  Set this flag to start a collection. */
   INT gc;
+
+  /* Threads. */
+  struct threads threads;
+
+  /* Native code compiler. */
+  struct jit jit;
+
+  /* Program compiled to C, see kernel.h.  It is used when the current
+     program has the code string native_code. */
+  native_f *native;
+  struct svalue native_code;
   
-  /* Debug information. */
-  INT trace;
+  /* Debug information.  The kernel runs its instrumented variant
+     while any of these flags are set. */
+  INT instrument;
+  struct profile profile;
 };
 
 void process_create(struct process *process, struct invocation *invocation);
 void process_destroy(struct process *process);
+void process_child(struct process *process, struct process *parent);
+void process_copy_call(struct process *process, struct svalue *procedure,
+		       struct copy *copy);
+void process_call(struct process *process, struct copy *copy);
+
+BIF_DECLARE(bif_process_spawn);
+BIF_DECLARE(bif_process_join);
 
 #endif /* __PROCESS_H__ */
@@ -0,0 +1,587 @@
+/* profile.c
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the profiler module.  The instrumented kernel counts each
+ * instruction and each pair of adjacent instructions, and times them,
+ * while INSTRUMENT_OPCODES is set.
+ *
+ * While INSTRUMENT_SAMPLE is set, the instrumented kernel also samples
+ * the procedures running at each tick of a processor time interval
+ * timer.  The stack of a sample is made of the procedure at the program
+ * counter and the procedures of the return labels in the continuation
+ * register and on the stack.  The samples are written at exit in the
+ * collapsed stack format read by flame graph tools.
+ */
+
+#define MODULE_DEBUG 0
+#define MODULE_NAME  "profile"
+
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "types.h"
+
+#include "args.h"
+#include "bif.h"
+#include "err.h"
+#include "map.h"
+#include "mem.h"
+#include "process.h"
+#include "profile.h"
+#include "program.h"
+#include "str.h"
+
+#ifdef PROFILE_SAMPLING
+#include <sys/time.h>
+#endif /* PROFILE_SAMPLING */
+
+#define N PROGRAM_INSTRUCTIONS
+
+#ifdef PROFILE_SAMPLING
+/* The profile of the process that last turned the timer on, which the
+   timer signal counts its ticks in. */
+static struct profile *volatile profile_timed;
+
+static void profile_timer(struct profile *profile, INT on);
+#endif /* PROFILE_SAMPLING */
+
+/* Text that grows as it is appended to. */
+struct profile_text
+{
+  char *s;
+  INT used, size;
+};
+
+static unsigned long profile_clock(void)
+{
+#ifdef PROFILE_TSC
+  unsigned int lo, hi;
+
+  __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((unsigned long)hi << 32) | lo;
+#else
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long)ts.tv_sec*1000000000 + ts.tv_nsec;
+#else
+  return (unsigned long)clock() * (1000000000 / CLOCKS_PER_SEC);
+#endif /* CLOCK_MONOTONIC */
+#endif /* PROFILE_TSC */
+}
+
+void profile_create(struct profile *profile)
+{
+  profile->last = -1;
+  profile->counts = 0;
+  profile->cycles = 0;
+  profile->pairs = 0;
+
+  profile->ticks = 0;
+  profile->sampled = 0;
+  profile->stacks = 0;
+  profile->samples_file = 0;
+
+  profile->programs_size = 0;
+  profile->programs_used = 0;
+  profile->programs = 0;
+}
+
+/* Prints the instructions by count and the most frequent pairs. */
+void profile_report(struct profile *profile)
+{
+  unsigned long total = 0, *counts = profile->counts, *pairs = profile->pairs;
+  INT order[N], reported[PROFILE_REPORT_PAIRS], i, j, k, t;
+
+  for(i = 0; i < N; i++)
+  {
+    order[i] = i;
+    total += counts[i];
+  }
+  
+  for(i = 1; i < N; i++)
+    for(j = i; 0 < j && counts[order[j-1]] < counts[order[j]]; j--)
+    {
+      t = order[j];
+      order[j] = order[j-1];
+      order[j-1] = t;
+    }
+
+  err_printf("\nOpcode profile of %lu instructions:\n\n", total);
+  err_printf("  %-22s %14s %7s %16s %10s\n",
+	     "instruction", "count", "%", PROFILE_UNIT, "each");
+  for(i = 0; i < N && counts[order[i]]; i++)
+  {
+    k = order[i];
+    err_printf("  %-22s %14lu %7.2f %16lu %10.1f\n",
+	       program_instructions[k].name, counts[k],
+	       100.0*counts[k]/total, profile->cycles[k],
+	       (double)profile->cycles[k]/counts[k]);
+  }
+
+  err_printf("\n  %-45s %14s\n", "pair", "count");
+  for(i = 0; i < PROFILE_REPORT_PAIRS; i++)
+  {
+    k = -1;
+    for(j = 0; j < N*N; j++)
+      if(pairs[j] && (k < 0 || pairs[k] < pairs[j]))
+      {
+	for(t = 0; t < i && reported[t] != j; t++)
+	  ;
+	if(t == i)
+	  k = j;
+      }
+    if(k < 0)
+      break;
+    
+    err_printf("  %-22s %-22s %14lu\n", program_instructions[k/N].name,
+	       program_instructions[k%N].name, pairs[k]);
+    reported[i] = k;
+  }
+}
+
+void profile_destroy(struct profile *profile)
+{
+  struct profile_stack *stack, *next;
+  INT i;
+
+#ifdef PROFILE_SAMPLING
+  if(profile_timed == profile)
+    profile_timer(profile, 0);
+#endif /* PROFILE_SAMPLING */
+  
+  if(profile->counts)
+  {
+    mem_free(profile->counts);
+    mem_free(profile->cycles);
+    mem_free(profile->pairs);
+  }
+
+  if(profile->stacks)
+  {
+    for(i = 0; i < PROFILE_STACKS_SIZE; i++)
+      for(stack = profile->stacks[i]; stack; stack = next)
+      {
+	next = stack->next;
+	mem_free(stack->frames);
+	mem_free(stack);
+      }
+    mem_free(profile->stacks);
+  }
+
+  if(profile->samples_file)
+    mem_free(profile->samples_file);
+
+  for(i = 0; i < profile->programs_used; i++)
+    if(profile->programs[i].owners)
+      mem_free(profile->programs[i].owners);
+  if(profile->programs)
+    mem_free(profile->programs);
+}
+
+void profile_start(struct profile *profile)
+{
+  if(!profile->counts)
+  {
+    profile->counts = mem_allocate_zeroed(N*sizeof(unsigned long));
+    profile->cycles = mem_allocate_zeroed(N*sizeof(unsigned long));
+    profile->pairs = mem_allocate_zeroed(N*N*sizeof(unsigned long));
+  }
+  
+  profile->last = -1;
+}
+
+void profile_stop(struct profile *profile)
+{
+  if(0 <= profile->last)
+    profile->cycles[profile->last] += profile_clock() - profile->start;
+  
+  profile->last = -1;
+}
+
+/* Counts the instruction about to run and charges the time since the
+   one before to that. */
+void profile_instruction(struct profile *profile, INT instr)
+{
+  unsigned long now;
+
+  if(N <= instr)
+    return;
+  
+  now = profile_clock();
+  if(0 <= profile->last)
+  {
+    profile->cycles[profile->last] += now - profile->start;
+    profile->pairs[profile->last*N + instr]++;
+  }
+
+  profile->counts[instr]++;
+  profile->last = instr;
+
+  /* The time of the bookkeeping is left out. */
+  profile->start = profile_clock();
+}
+
+static void profile_append(struct profile_text *text, char *s, INT length)
+{
+  if(text->size <= text->used + length)
+  {
+    text->size = 2*(text->used + length + 1);
+    text->s = mem_reallocate(text->s, text->size);
+  }
+  
+  mem_copy(text->s + text->used, s, length);
+  text->used += length;
+  text->s[text->used] = 0;
+}
+
+/* Returns the procedures of a program, found when it is first sampled. */
+static struct profile_program *profile_program(struct profile *profile,
+					       struct vec *program)
+{
+  struct svalue *code = &program->v[PROGRAM_CODE];
+  struct profile_program *p;
+  INT i;
+
+  for(i = 0; i < profile->programs_used; i++)
+    if(profile->programs[i].program.u.vec == program &&
+       profile->programs[i].code.u.str == code->u.str)
+      return &profile->programs[i];
+
+  if(profile->programs_used == profile->programs_size)
+  {
+    profile->programs_size =
+      profile->programs_size ? 2*profile->programs_size : 8;
+    profile->programs =
+      mem_reallocate(profile->programs,
+		     sizeof(struct profile_program) * profile->programs_size);
+  }
+
+  p = &profile->programs[profile->programs_used++];
+  p->program.u.vec = program;
+  p->program.type = T_VECTOR;
+  p->code = *code;
+  p->owners = code->aux == PROGRAM_VERIFIED ? program_owners(code->u.str) : 0;
+
+  return p;
+}
+
+/* Appends the name of the procedure at offset in program.  It is the
+   name it was defined with, otherwise the name of the program followed
+   by the offset of the procedure if it is not the program itself. */
+static void profile_frame(struct profile *profile, struct vec *program,
+			  INT offset, struct profile_text *text)
+{
+  struct profile_program *p = profile_program(profile, program);
+  struct svalue *name, *constants;
+  INT owner = -1, index;
+  char buffer[32];
+
+  if(p->owners && BYTECODE_HEADER_SIZE <= offset &&
+     offset < ((INT *)p->code.u.str->s)[2])
+    owner = p->owners[offset/BYTECODE_WORD];
+
+  if(BYTECODE_HEADER_SIZE < owner)
+  {
+    index = ((INT *)(p->code.u.str->s + owner))[3];
+    constants = &program->v[PROGRAM_CONSTANTS];
+    if(0 <= index && IS_VECTOR(*constants) &&
+       index < constants->u.vec->length)
+    {
+      name = &constants->u.vec->v[index];
+      if(IS_SYMBOL(*name) && !name->u.str->shift)
+      {
+	profile_append(text, name->u.str->s, name->u.str->length);
+	return;
+      }
+    }
+  }
+
+  name = &program->v[PROGRAM_NAME];
+  if(IS_STRING(*name) && !name->u.str->shift)
+    profile_append(text, name->u.str->s, name->u.str->length);
+  else
+    profile_append(text, "program", 7);
+
+  if(BYTECODE_HEADER_SIZE < owner)
+  {
+    sprintf(buffer, ":%ld", (long)owner);
+    profile_append(text, buffer, strlen(buffer));
+  }
+}
+
+/* Samples the procedures of the process, at most once each tick. */
+void profile_sample(struct process *process, UBYTE *pc)
+{
+  struct profile *profile = &process->profile;
+  struct vec *programs[PROFILE_SAMPLE_DEPTH];
+  INT offsets[PROFILE_SAMPLE_DEPTH];
+  struct profile_stack *stack;
+  struct profile_text text;
+  struct svalue *cont;
+  unsigned long h;
+  INT i, n;
+
+  if(profile->sampled == profile->ticks)
+    return;
+  profile->sampled = profile->ticks;
+
+  programs[0] = process->program.u.vec;
+  offsets[0] = pc - (UBYTE *)programs[0]->v[PROGRAM_CODE].u.str->s;
+  n = 1;
+
+  /* The continuation register holds the label returned to until the
+     caller restores its own, so it is not a frame of its own then. */
+  cont = &process->reg[REGISTER_CONT];
+  if(cont->type == T_LABEL &&
+     (cont->u.vec != programs[0] || cont->aux != offsets[0]))
+  {
+    programs[n] = cont->u.vec;
+    offsets[n++] = cont->aux;
+  }
+
+  for(i = process->stack.used-1; 0 <= i && n < PROFILE_SAMPLE_DEPTH; i--)
+    if(process->stack.s[i].type == T_LABEL)
+    {
+      programs[n] = process->stack.s[i].u.vec;
+      offsets[n++] = process->stack.s[i].aux;
+    }
+
+  text.s = 0;
+  text.used = 0;
+  text.size = 0;
+  while(n--)
+  {
+    profile_frame(profile, programs[n], offsets[n], &text);
+    if(n)
+      profile_append(&text, ";", 1);
+  }
+
+  for(h = 0, i = 0; i < text.used; i++)
+    h = 31*h + (UBYTE)text.s[i];
+  h %= PROFILE_STACKS_SIZE;
+
+  if(!profile->stacks)
+    profile->stacks = mem_allocate_zeroed(sizeof(struct profile_stack *) *
+					  PROFILE_STACKS_SIZE);
+  
+  for(stack = profile->stacks[h]; stack; stack = stack->next)
+    if(strcmp(stack->frames, text.s) == 0)
+    {
+      stack->count++;
+      mem_free(text.s);
+      return;
+    }
+
+  stack = mem_allocate(sizeof(struct profile_stack));
+  stack->frames = text.s;
+  stack->count = 1;
+  stack->next = profile->stacks[h];
+  profile->stacks[h] = stack;
+}
+
+/* Writes the samples to the samples file, a stack and its count on
+   each line. */
+void profile_write_samples(struct profile *profile)
+{
+  struct profile_stack *stack;
+  FILE *file;
+  INT i;
+
+  if(!(file = fopen(profile->samples_file, "w")))
+  {
+    err_printf("Cannot write samples to %s.\n", profile->samples_file);
+    return;
+  }
+
+  if(profile->stacks)
+    for(i = 0; i < PROFILE_STACKS_SIZE; i++)
+      for(stack = profile->stacks[i]; stack; stack = stack->next)
+	fprintf(file, "%s %lu\n", stack->frames, stack->count);
+  
+  fclose(file);
+}
+
+#ifdef PROFILE_SAMPLING
+
+static void profile_tick(int n)
+{
+  struct profile *profile = profile_timed;
+
+  if(profile)
+    profile->ticks++;
+}
+
+/* Starts or stops the timer for the profile.  It is only stopped by the
+   profile it was last started for. */
+static void profile_timer(struct profile *profile, INT on)
+{
+  struct itimerval timer;
+  struct sigaction action;
+
+  if(!on && profile_timed != profile)
+    return;
+
+  profile_timed = on ? profile : 0;
+  if(on)
+  {
+    action.sa_handler = profile_tick;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGPROF, &action, 0);
+  }
+  
+  timer.it_interval.tv_sec = 0;
+  timer.it_interval.tv_usec = on ? PROFILE_SAMPLE_INTERVAL : 0;
+  timer.it_value = timer.it_interval;
+  setitimer(ITIMER_PROF, &timer, 0);
+}
+
+#endif /* PROFILE_SAMPLING */
+
+BIF_DECLARE(bif_profile_opcodes)
+{
+  struct svalue *on;
+
+  ARGS_GET((process, "profile-opcodes", args, "%*", &on));
+
+  if(IS_FALSE(*on))
+  {
+    profile_stop(&process->profile);
+    process->instrument &= ~INSTRUMENT_OPCODES;
+  }
+  else
+  {
+    profile_start(&process->profile);
+    process->instrument |= INSTRUMENT_OPCODES;
+  }
+  
+  BIF_RESULT_UNDEFINED();
+}
+
+static void profile_set(struct process *process, struct map *map, char *s,
+			unsigned long n)
+{
+  struct svalue key, value;
+
+  key.u.str = str_allocate_text(&process->str_heap, s);
+  key.type = T_STRING;
+  if(n <= MAXINT)
+  {
+    value.u.integer = n;
+    value.type = T_SMALL_INTEGER;
+  }
+  else
+  {
+    value.u.real = n;
+    value.type = T_REAL;
+  }
+
+  map_set(map, &key, &value);
+}
+
+/* Returns a mapping of "instructions" and "cycles" to mappings from
+   instruction names to their counts and times, and of "pairs" to a
+   mapping from the names of pairs of instructions to their counts.
+   The times are in nanoseconds where there is no cycle counter. */
+BIF_DECLARE(bif_opcode_profile)
+{
+  struct profile *profile = &process->profile;
+  struct map *map, *counts, *cycles, *pairs;
+  struct svalue key, value;
+  char buffer[64];
+  INT i;
+
+  ARGS_GET((process, "opcode-profile", args, ""));
+
+  map = map_allocate(&process->map_heap);
+  BIF_RESULT_MAPPING(map);
+  
+  counts = map_allocate(&process->map_heap);
+  cycles = map_allocate(&process->map_heap);
+  pairs = map_allocate(&process->map_heap);
+
+  if(profile->counts)
+    for(i = 0; i < N*N; i++)
+    {
+      if(i < N && profile->counts[i])
+      {
+	profile_set(process, counts, program_instructions[i].name,
+		    profile->counts[i]);
+	profile_set(process, cycles, program_instructions[i].name,
+		    profile->cycles[i]);
+      }
+      if(profile->pairs[i])
+      {
+	sprintf(buffer, "%s %s", program_instructions[i/N].name,
+		program_instructions[i%N].name);
+	profile_set(process, pairs, buffer, profile->pairs[i]);
+      }
+    }
+  
+  key.u.str = str_allocate_text(&process->str_heap, "instructions");
+  key.type = T_STRING;
+  value.u.map = counts;
+  value.type = T_MAPPING;
+  map_set(map, &key, &value);
+
+  key.u.str = str_allocate_text(&process->str_heap, "cycles");
+  value.u.map = cycles;
+  map_set(map, &key, &value);
+  
+  key.u.str = str_allocate_text(&process->str_heap, "pairs");
+  value.u.map = pairs;
+  map_set(map, &key, &value);
+}
+
+/* Starts sampling, or stops it when given false.  The samples are
+   written at exit to the file given, if any. */
+BIF_DECLARE(bif_profile_samples)
+{
+  struct svalue *on;
+
+  ARGS_GET((process, "profile-samples", args, "%*", &on));
+
+#ifdef PROFILE_SAMPLING
+  if(IS_STRING(*on))
+  {
+    if(process->profile.samples_file)
+      mem_free(process->profile.samples_file);
+    process->profile.samples_file =
+      mem_duplicate(on->u.str->s, on->u.str->length + 1);
+  }
+  
+  profile_timer(&process->profile, !IS_FALSE(*on));
+  if(IS_FALSE(*on))
+    process->instrument &= ~INSTRUMENT_SAMPLE;
+  else
+    process->instrument |= INSTRUMENT_SAMPLE;
+  
+  BIF_RESULT_UNDEFINED();
+#else
+  ARGS_ERROR((process, "profile-samples",
+	      "Not supported on this platform."));
+#endif /* PROFILE_SAMPLING */
+}
+
+/* Returns a mapping from the sampled stacks to their counts. */
+BIF_DECLARE(bif_sample_profile)
+{
+  struct profile_stack *stack;
+  struct map *map;
+  INT i;
+
+  ARGS_GET((process, "sample-profile", args, ""));
+
+  map = map_allocate(&process->map_heap);
+  BIF_RESULT_MAPPING(map);
+
+  if(process->profile.stacks)
+    for(i = 0; i < PROFILE_STACKS_SIZE; i++)
+      for(stack = process->profile.stacks[i]; stack; stack = stack->next)
+	profile_set(process, map, stack->frames, stack->count);
+}
@@ -0,0 +1,102 @@
+/* profile.h
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the profiler module.
+ */
+
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+#include <signal.h>
+
+#include "types.h"
+
+#include "bif.h"
+
+/* Instructions are timed with the time stamp counter where there is
+   one, otherwise with a clock in nanoseconds. */
+#if defined(__GNUC__) && defined(__x86_64__)
+#define PROFILE_TSC
+#define PROFILE_UNIT "cycles"
+#else
+#define PROFILE_UNIT "ns"
+#endif /* __GNUC__ && __x86_64__ */
+
+/* Lines of instruction pairs in the report. */
+#define PROFILE_REPORT_PAIRS 20
+
+/* Procedures are sampled on SIGPROF from an interval timer.  Define
+   NO_SAMPLING to leave it out. */
+#if defined(__unix__) && !defined(NO_SAMPLING)
+#define PROFILE_SAMPLING
+#endif /* __unix__ && !NO_SAMPLING */
+
+/* Microseconds of processor time between samples. */
+#define PROFILE_SAMPLE_INTERVAL 1000
+
+/* Frames kept of each sample, counted from the innermost one. */
+#define PROFILE_SAMPLE_DEPTH 256
+
+#define PROFILE_STACKS_SIZE 1024
+
+/* A sampled stack of procedure names, outermost first and separated by
+   semicolons, and the number of samples of it. */
+struct profile_stack
+{
+  char *frames;
+  unsigned long count;
+
+  struct profile_stack *next;
+};
+
+/* The procedures of a program, see program_owners.  The owners are
+   zero when the program is not verified. */
+struct profile_program
+{
+  struct svalue program, code;
+  INT *owners;
+};
+
+struct profile
+{
+  /* The instruction before, and when it started, or -1. */
+  INT last;
+  unsigned long start;
+
+  /* Allocated when the profile is first started.  The pairs are
+     indexed by the first instruction times the number of them plus
+     the second. */
+  unsigned long *counts, *cycles, *pairs;
+
+  /* The ticks counted by the timer signal while the process samples,
+     the last tick sampled, the samples by stack and the file they are
+     written to at exit, if any. */
+  volatile sig_atomic_t ticks;
+  long sampled;
+  struct profile_stack **stacks;
+  char *samples_file;
+
+  /* Programs sampled.  They are collector roots, so their code is
+     never reused while its procedures are known. */
+  INT programs_size, programs_used;
+  struct profile_program *programs;
+};
+
+void profile_create(struct profile *profile);
+void profile_destroy(struct profile *profile);
+
+void profile_start(struct profile *profile);
+void profile_stop(struct profile *profile);
+void profile_instruction(struct profile *profile, INT instr);
+void profile_report(struct profile *profile);
+
+void profile_sample(struct process *process, UBYTE *pc);
+void profile_write_samples(struct profile *profile);
+
+BIF_DECLARE(bif_profile_opcodes);
+BIF_DECLARE(bif_opcode_profile);
+BIF_DECLARE(bif_profile_samples);
+BIF_DECLARE(bif_sample_profile);
+
+#endif /* __PROFILE_H__ */
@@ -0,0 +1,653 @@
+/* program.c
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the program module.
+ */
+
+#define MODULE_DEBUG 0
+#define MODULE_NAME  "program"
+
+#include "types.h"
+
+#include "big.h"
+#include "bif.h"
+#include "err.h"
+#include "mem.h"
+#include "process.h"
+#include "program.h"
+#include "str.h"
+#include "vec.h"
+
+#define J1 PROGRAM_OPERAND(1)
+
+struct program_instruction program_instructions[PROGRAM_INSTRUCTIONS] =
+{
+  /* name                   registers operands jumps labels */
+  { "exit",                     0, 0,  0,  0 },
+  { "save",                     1, 0,  0,  0 },
+  { "restore",                  1, 0,  0,  0 },
+  { "list",                     2, 0,  0,  0 },
+  { "cons",                     3, 0,  0,  0 },
+  { "apply_bif",                1, 0,  0,  0 },
+  { "apply_lambda",             0, 0,  0,  0 },
+  { "assign",                   2, 0,  0,  0 },
+  { "assign_nil",               1, 0,  0,  0 },
+  { "assign_true",              1, 0,  0,  0 },
+  { "assign_false",             1, 0,  0,  0 },
+  { "assign_small_integer",     1, 1,  0,  0 },
+  { 0,                          0, 0,  0,  0 },
+  { 0,                          0, 0,  0,  0 },
+  { "assign_bif",               1, 1,  0,  0 },
+  { "assign_lambda",            1, 1,  0, J1 },
+  { "assign_label",             0, 1,  0, J1 },
+  { "call_cc",                  0, 1,  0, J1 },
+  { "branch_bif",               0, 1, J1,  0 },
+  { "goto",                     0, 1, J1,  0 },
+  { "jump",                     0, 0,  0,  0 },
+  { "branch",                   0, 1, J1,  0 },
+  { "lambda",                   0, 3,  0,  0 },
+  { 0,                          0, 0,  0,  0 },
+  { "get",                      1, 2,  0,  0 },
+  { "set",                      1, 2,  0,  0 },
+  { "env_extend",               0, 1,  0,  0 },
+  { "assign_undefined",         1, 0,  0,  0 },
+  { "assign_character",         1, 1,  0,  0 },
+  { 0,                          0, 0,  0,  0 },
+  { "load_env",                 0, 0,  0,  0 },
+  { 0,                          0, 0,  0,  0 },
+  { "save2",                    2, 0,  0,  0 },
+  { "restore2",                 2, 0,  0,  0 },
+  { "get_list",                 2, 2,  0,  0 },
+  { "get_cons",                 3, 2,  0,  0 },
+  { "call_bif",                 0, 2, J1,  0 },
+  { "call_lambda",              0, 1,  0, J1 },
+  { "get0_0",                   1, 0,  0,  0 },
+  { "get0_1",                   1, 0,  0,  0 },
+  { "get0_2",                   1, 0,  0,  0 },
+  { "get0_3",                   1, 0,  0,  0 },
+  { "get0",                     1, 1,  0,  0 },
+  { "get1",                     1, 1,  0,  0 },
+  { "get_top",                  1, 1,  0,  0 },
+  { "set0",                     1, 1,  0,  0 },
+  { "set1",                     1, 1,  0,  0 },
+  { "set_top",                  1, 1,  0,  0 },
+  { "arg_first",                2, 1,  0,  0 },
+  { "arg",                      2, 1,  0,  0 },
+  { "plus",                     3, 0,  0,  0 },
+  { "minus",                    3, 0,  0,  0 },
+  { "times",                    3, 0,  0,  0 },
+  { "less",                     3, 0,  0,  0 },
+  { "eq",                       3, 0,  0,  0 },
+  { "car",                      2, 0,  0,  0 },
+  { "cdr",                      2, 0,  0,  0 },
+  { "nullp",                    2, 0,  0,  0 },
+  { "pairp",                    2, 0,  0,  0 },
+  { "not",                      2, 0,  0,  0 },
+  { "assign_constant",          1, 1,  0,  0 },
+  { "call_ec",                  0, 1,  0, J1 },
+  { "generator_resume",         0, 1,  0, J1 },
+  { "generator_yield",          0, 1,  0, J1 },
+  { "values",                   1, 0,  0,  0 },
+  { "argl_values",              0, 0,  0,  0 },
+};
+
+/* Returns zero if the code can be run by the kernel, otherwise
+   a message describing why it cannot. */
+char *program_check(struct str *code)
+{
+  INT version;
+  
+  if(code->shift || code->length < BYTECODE_HEADER_SIZE ||
+     !mem_equal(code->s, BYTECODE_MAGIC, BYTECODE_MAGIC_SIZE))
+    return "Not a bytecode program (old format?).";
+
+  /* The kernel reads operands as words. */
+  if((long)code->s & (BYTECODE_WORD-1))
+    return "Bytecode is not word aligned.";
+  
+  version = ((INT *)code->s)[1];
+  
+  if(version != BYTECODE_VERSION)
+  {
+    INT swapped, i;
+
+    for(i = 0; i < BYTECODE_WORD; i++)
+      ((UBYTE *)&swapped)[i] = ((UBYTE *)&version)[BYTECODE_WORD-1-i];
+    
+    if(swapped == BYTECODE_VERSION)
+      return "Bytecode was compiled for another byte order.";
+    
+    return "Unsupported bytecode format version.";
+  }
+
+  return 0;
+}
+
+/* Makes the constants of the code into a vector, or the empty list if
+   there are none.  Returns zero on success, otherwise a message. */
+char *program_constants(struct process *process, struct str *code,
+			struct svalue *constants)
+{
+  INT offset, n, i, kind, length;
+  UBYTE *p, *end;
+  struct vec *vec;
+
+  offset = ((INT *)code->s)[2];
+  if(offset < BYTECODE_HEADER_SIZE || code->length - BYTECODE_WORD < offset ||
+     offset & (BYTECODE_WORD-1))
+    return "Bytecode constants are out of range.";
+  
+  p = (UBYTE *)code->s + offset;
+  end = (UBYTE *)code->s + code->length;
+  
+  n = ((INT *)p)[0];
+  p += BYTECODE_WORD;
+  if(n < 0 || (end - p) / (2*BYTECODE_WORD) < n)
+    return "Bytecode constants are out of range.";
+
+  constants->type = T_NIL;
+  if(!n)
+    return 0;
+  
+  vec = vec_allocate(&process->vec_heap, n);
+  
+  for(i = 0; i < n; i++)
+  {
+    if(end - p < 2*BYTECODE_WORD)
+      return "Bytecode constants are out of range.";
+    
+    kind = ((INT *)p)[0];
+    length = ((INT *)p)[1];
+    p += 2*BYTECODE_WORD;
+    
+    if(length < 0 || end - p < length || end - p < BYTECODE_ALIGN(length))
+      return "Bytecode constants are out of range.";
+    
+    switch(kind)
+    {
+    case PROGRAM_CONSTANT_STRING:
+      vec->v[i].u.str = str_allocate(&process->str_heap, (char *)p, length);
+      vec->v[i].type = T_STRING;
+      break;
+      
+    case PROGRAM_CONSTANT_SYMBOL:
+      vec->v[i].u.str = str_allocate(&process->str_heap, (char *)p, length);
+      vec->v[i].type = T_SYMBOL;
+      break;
+
+#ifdef USE_BIG_INTEGERS
+    case PROGRAM_CONSTANT_BIG_INTEGER:
+      /* Hexadecimal text ending with a zero byte. */
+      if(!length || p[length-1] ||
+	 !(vec->v[i].u.big = big_allocate_integer_text(&process->big_heap,
+						       (char *)p, 16)))
+	return "Malformed big integer constant.";
+      vec->v[i].type = T_BIG_INTEGER;
+      break;
+#endif /* USE_BIG_INTEGERS */
+
+    case PROGRAM_CONSTANT_FLOAT:
+      /* A REAL may need stricter alignment than a word. */
+      if(length != sizeof(REAL))
+	return "Malformed float constant.";
+      mem_copy(&vec->v[i].u.real, p, sizeof(REAL));
+      vec->v[i].type = T_REAL;
+      break;
+      
+    default:
+      return "Unknown kind of bytecode constant.";
+    }
+    
+    p += BYTECODE_ALIGN(length);
+  }
+
+  constants->u.vec = vec;
+  constants->type = T_VECTOR;
+  
+  return 0;
+}
+
+/* Flags of code offsets while verifying. */
+#define VERIFY_INSTRUCTION 1
+#define VERIFY_VISITED     2
+
+struct verify
+{
+  INT offset, depth, bif;
+};
+
+#define VERIFY_PUSH(o, d, b)                                               \
+        do {                                                               \
+          work[used].offset = (o);                                         \
+          work[used].depth = (d);                                          \
+          work[used].bif = (b);                                            \
+          used++;                                                          \
+        } while(0)
+
+/* Checks the registers and operands of the instruction at offset of
+   the code.  Returns zero on success, otherwise a message. */
+static char *verify_instruction(UBYTE *code, INT offset, INT end,
+				UBYTE *flags, INT n_constants, INT n_bifs)
+{
+  struct program_instruction *instruction;
+  INT *operands, i, target;
+  UBYTE *pc;
+
+  pc = code + offset;
+  operands = (INT *)pc;
+  instruction = &program_instructions[pc[0]];
+  
+  for(i = 1; i <= instruction->registers; i++)
+    if(N_REGISTERS <= pc[i])
+      return "Register out of range.";
+  
+  for(i = 1; i <= instruction->operands; i++)
+    if((instruction->jumps | instruction->labels) & PROGRAM_OPERAND(i))
+    {
+      target = operands[i];
+      if(target < BYTECODE_HEADER_SIZE || end <= target ||
+	 target & (BYTECODE_WORD-1) ||
+	 !(flags[target/BYTECODE_WORD] & VERIFY_INSTRUCTION))
+	return "Jump target out of range.";
+    }
+
+  switch(pc[0])
+  {
+  case I_assign_constant:
+    if(operands[1] < 0 || n_constants <= operands[1])
+      return "Constant out of range.";
+    break;
+    
+  case I_assign_bif:
+    if(operands[1] < 0 || n_bifs <= operands[1] || !bifs[operands[1]].bif)
+      return "BIF not implemented.";
+    break;
+    
+  case I_call_bif:
+    if(operands[2] < 0 || n_bifs <= operands[2] || !bifs[operands[2]].bif)
+      return "BIF not implemented.";
+    /* The kernel goes directly to the apply_bif at the target. */
+    if(code[operands[1]] != I_apply_bif)
+      return "BIF call to something else than apply_bif.";
+    break;
+
+  case I_lambda:
+    if(operands[2] < 0)
+      return "Frame out of range.";
+    if(operands[3] < -1 || n_constants <= operands[3])
+      return "Constant out of range.";
+    break;
+
+  case I_arg_first:
+    if(operands[1] < 1)
+      return "Argument vector out of range.";
+    break;
+
+  case I_get:
+  case I_set:
+  case I_get_list:
+  case I_get_cons:
+    if(operands[1] < 0 || operands[2] < 0)
+      return "Variable out of range.";
+    break;
+    
+  case I_get0:
+  case I_get1:
+  case I_get_top:
+  case I_set0:
+  case I_set1:
+  case I_set_top:
+  case I_env_extend:
+  case I_arg:
+    if(operands[1] < 0)
+      return "Variable out of range.";
+    break;
+  }
+  
+  return 0;
+}
+
+/*
+ * Returns zero if the code is safe to run without the checks made by
+ * the kernel for code that is not verified, otherwise a message.  The
+ * code must have passed program_check and program_constants.
+ *
+ * Instructions must be known and lie within the code, their registers
+ * and operands must be in range and jumps must land on instructions.
+ * Each procedure, and the program itself, starts with an empty stack
+ * that must be empty again when it returns with a jump.  Every path to
+ * an instruction must have the same stack depth, and restores may not
+ * go below the start.  A return label has the depth of the call that
+ * makes it.  An apply_bif may only be reached by a branch_bif or a
+ * call_bif, since the procedure is then known to be a BIF.  The
+ * environments, frames and argument vectors that operands index are
+ * made at run time, so the kernel checks those, see CHECK_SLOT.
+ */
+char *program_verify(struct str *code, struct svalue *constants)
+{
+  struct program_instruction *instruction;
+  struct verify *work;
+  INT end, offset, instr, length, n_constants, n_bifs, used, size;
+  INT depth, bif, *depths, *operands;
+  UBYTE *s, *flags;
+  char *msg = 0;
+
+  s = (UBYTE *)code->s;
+  end = ((INT *)s)[2];
+  n_constants = IS_VECTOR(*constants) ? constants->u.vec->length : 0;
+  for(n_bifs = 0; bifs[n_bifs].name; n_bifs++)
+    ;
+
+  size = end/BYTECODE_WORD + 1;
+  flags = mem_allocate_zeroed(size);
+  depths = mem_allocate(size*sizeof(INT));
+  work = mem_allocate(2*size*sizeof(struct verify));
+  
+  /* Find the instructions. */
+  for(offset = BYTECODE_HEADER_SIZE; offset < end; offset += length)
+  {
+    instr = s[offset];
+    if(PROGRAM_INSTRUCTIONS <= instr || !program_instructions[instr].name)
+    {
+      msg = "Unknown instruction.";
+      goto done;
+    }
+    
+    length = (1 + program_instructions[instr].operands)*BYTECODE_WORD;
+    if(end - offset < length)
+    {
+      msg = "Truncated instruction.";
+      goto done;
+    }
+    
+    flags[offset/BYTECODE_WORD] |= VERIFY_INSTRUCTION;
+  }
+  
+  if(end <= BYTECODE_HEADER_SIZE)
+  {
+    msg = "Empty program.";
+    goto done;
+  }
+  
+  for(offset = BYTECODE_HEADER_SIZE; offset < end; offset += length)
+  {
+    if((msg = verify_instruction(s, offset, end, flags, n_constants, n_bifs)))
+      goto done;
+    length = (1 + program_instructions[s[offset]].operands)*BYTECODE_WORD;
+  }
+
+  /* Follow the stack depth along every path. */
+  used = 0;
+  VERIFY_PUSH(BYTECODE_HEADER_SIZE, 0, 0);
+  
+  while(used)
+  {
+    used--;
+    offset = work[used].offset;
+    depth = work[used].depth;
+    bif = work[used].bif;
+
+    for(;;)
+    {
+      instr = s[offset];
+      instruction = &program_instructions[instr];
+      operands = (INT *)(s + offset);
+      
+      if(instr == I_apply_bif && !bif)
+      {
+	msg = "Application of BIF without a BIF test.";
+	goto done;
+      }
+
+      if(flags[offset/BYTECODE_WORD] & VERIFY_VISITED)
+      {
+	if(depths[offset/BYTECODE_WORD] != depth)
+	{
+	  msg = "Unbalanced stack.";
+	  goto done;
+	}
+	break;
+      }
+      flags[offset/BYTECODE_WORD] |= VERIFY_VISITED;
+      depths[offset/BYTECODE_WORD] = depth;
+      bif = 0;
+      
+      switch(instr)
+      {
+      case I_save:
+	depth++;
+	break;
+	
+      case I_save2:
+	depth += 2;
+	break;
+
+      case I_restore:
+      case I_restore2:
+	depth -= instr == I_restore ? 1 : 2;
+	if(depth < 0)
+	{
+	  msg = "Stack underflow.";
+	  goto done;
+	}
+	break;
+
+      case I_assign_lambda:
+	VERIFY_PUSH(operands[1], 0, 0);
+	break;
+	
+      case I_assign_label:
+      case I_call_cc:
+      case I_call_lambda:
+      case I_branch:
+      case I_goto:
+	VERIFY_PUSH(operands[1], depth, 0);
+	break;
+
+      case I_call_ec:
+	/* The label and the mark are popped where it continues. */
+	depth += 2;
+	VERIFY_PUSH(operands[1], depth, 0);
+	break;
+
+      case I_generator_resume:
+	VERIFY_PUSH(operands[1], depth + 2, 0);
+	break;
+
+      case I_generator_yield:
+	/* The generator continues with the stack it had. */
+	VERIFY_PUSH(operands[1], depth, 0);
+	break;
+
+      case I_branch_bif:
+      case I_call_bif:
+	VERIFY_PUSH(operands[1], depth, 1);
+	break;
+
+      case I_jump:
+	if(depth)
+	{
+	  msg = "Unbalanced stack at return.";
+	  goto done;
+	}
+	break;
+      }
+
+      /* Instructions that do not continue with the next one. */
+      if(instr == I_exit || instr == I_goto || instr == I_jump ||
+	 instr == I_apply_lambda || instr == I_call_lambda ||
+	 instr == I_call_bif || instr == I_generator_resume ||
+	 instr == I_generator_yield)
+	break;
+
+      offset += (1 + instruction->operands)*BYTECODE_WORD;
+      if(end <= offset)
+      {
+	msg = "Code runs past its end.";
+	goto done;
+      }
+    }
+  }
+
+ done:
+  mem_free(work);
+  mem_free(depths);
+  mem_free(flags);
+  
+  return msg;
+}
+
+/*
+ * Returns, for each word of verified code, the offset of the lambda
+ * instruction that starts the procedure the instruction there belongs
+ * to, or the offset of the first instruction for the program itself,
+ * and -1 for the words that are not reached.  The paths are followed
+ * like in program_verify, except into the procedures that are made.
+ */
+INT *program_owners(struct str *code)
+{
+  struct verify *work;
+  INT end, offset, owner, instr, used, size, i, *owners, *operands;
+  UBYTE *s;
+
+  s = (UBYTE *)code->s;
+  end = ((INT *)s)[2];
+  
+  size = end/BYTECODE_WORD + 1;
+  owners = mem_allocate(size*sizeof(INT));
+  for(i = 0; i < size; i++)
+    owners[i] = -1;
+  work = mem_allocate(2*size*sizeof(struct verify));
+  
+  used = 0;
+  VERIFY_PUSH(BYTECODE_HEADER_SIZE, BYTECODE_HEADER_SIZE, 0);
+
+  while(used)
+  {
+    used--;
+    offset = work[used].offset;
+    owner = work[used].depth;
+
+    while(offset < end && owners[offset/BYTECODE_WORD] < 0)
+    {
+      instr = s[offset];
+      operands = (INT *)(s + offset);
+      owners[offset/BYTECODE_WORD] = owner;
+
+      switch(instr)
+      {
+      case I_assign_lambda:
+	VERIFY_PUSH(operands[1], operands[1], 0);
+	break;
+	
+      case I_assign_label:
+      case I_call_cc:
+      case I_call_ec:
+      case I_call_lambda:
+      case I_generator_resume:
+      case I_generator_yield:
+      case I_branch:
+      case I_goto:
+      case I_branch_bif:
+      case I_call_bif:
+	VERIFY_PUSH(operands[1], owner, 0);
+	break;
+      }
+
+      if(instr == I_exit || instr == I_goto || instr == I_jump ||
+	 instr == I_apply_lambda || instr == I_call_lambda ||
+	 instr == I_call_bif || instr == I_generator_resume ||
+	 instr == I_generator_yield)
+	break;
+
+      offset += (1 + program_instructions[instr].operands)*BYTECODE_WORD;
+    }
+  }
+
+  mem_free(work);
+  
+  return owners;
+}
+
+/*
+ * Follows the paths from the instruction at offset of verified code
+ * like program_owners, also into the procedures that are made, and
+ * marks each word it comes to in reached.  Paths end at words already
+ * marked.  Returns the number of top-level variables read or set on
+ * the way, whose slots are stored in *slots, which is reallocated to
+ * hold *size of them when needed.
+ */
+INT program_top_slots(struct str *code, INT offset, UBYTE *reached,
+		      INT **slots, INT *size)
+{
+  struct verify *work;
+  INT end, instr, used, work_size, n, *operands;
+  UBYTE *s;
+
+  s = (UBYTE *)code->s;
+  end = ((INT *)s)[2];
+
+  n = 0;
+  used = 0;
+  work_size = 16;
+  work = mem_allocate(work_size*sizeof(struct verify));
+  VERIFY_PUSH(offset, 0, 0);
+
+  while(used)
+  {
+    offset = work[--used].offset;
+
+    while(offset < end && !reached[offset/BYTECODE_WORD])
+    {
+      instr = s[offset];
+      operands = (INT *)(s + offset);
+      reached[offset/BYTECODE_WORD] = 1;
+
+      if(used == work_size)
+      {
+	work_size *= 2;
+	work = mem_reallocate(work, work_size*sizeof(struct verify));
+      }
+
+      switch(instr)
+      {
+      case I_get_top:
+      case I_set_top:
+	if(n == *size)
+	{
+	  *size = MAX(2 * *size, 16);
+	  *slots = mem_reallocate(*slots, *size*sizeof(INT));
+	}
+	(*slots)[n++] = operands[1];
+	break;
+
+      case I_assign_lambda:
+      case I_assign_label:
+      case I_call_cc:
+      case I_call_ec:
+      case I_call_lambda:
+      case I_generator_resume:
+      case I_generator_yield:
+      case I_branch:
+      case I_goto:
+      case I_branch_bif:
+      case I_call_bif:
+	VERIFY_PUSH(operands[1], 0, 0);
+	break;
+      }
+
+      if(instr == I_exit || instr == I_goto || instr == I_jump ||
+	 instr == I_apply_lambda || instr == I_call_lambda ||
+	 instr == I_call_bif || instr == I_generator_resume ||
+	 instr == I_generator_yield)
+	break;
+
+      offset += (1 + program_instructions[instr].operands)*BYTECODE_WORD;
+    }
+  }
+
+  mem_free(work);
+
+  return n;
+}
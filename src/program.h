@@ -0,0 +1,84 @@
+/* program.h
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the program module.
+ */
+
+#ifndef __PROGRAM_H__
+#define __PROGRAM_H__
+
+#include "types.h"
+
+#include "str.h"
+
+#include "instructions.h"
+
+/* A program is a vector of its name, code, environment and constants.
+   The constants are made from the code by load-program. */
+#define PROGRAM_NAME      0
+#define PROGRAM_CODE      1
+#define PROGRAM_ENV       2
+#define PROGRAM_CONSTANTS 3
+
+#define PROGRAM_SIZE      4
+
+/*
+ * The code starts with a header of the magic bytes, the format version
+ * and the offset of the constants.  Each instruction is word aligned and
+ * begins with a word holding the opcode and up to three register bytes.
+ * Any further operands follow as words in the native byte order, and
+ * strings are zero padded up to the next word boundary.
+ *
+ * The constants follow the instructions.  They start with a word
+ * holding their number, and each constant is a word with its kind, a
+ * word with its length and then its zero padded bytes.  Instructions
+ * refer to a constant by its index.
+ */
+#define BYTECODE_MAGIC       "Shoe"
+#define BYTECODE_MAGIC_SIZE  4
+#define BYTECODE_VERSION     8
+#define BYTECODE_HEADER_SIZE (3*(INT)sizeof(INT))
+
+#define BYTECODE_WORD        ((INT)sizeof(INT))
+#define BYTECODE_ALIGN(n)    (((n) + BYTECODE_WORD-1) & ~(BYTECODE_WORD-1))
+
+/* The aux field of the code of a program once it has been verified,
+   see program_verify. */
+#define PROGRAM_VERIFIED 1
+
+#define PROGRAM_CONSTANT_STRING      0
+#define PROGRAM_CONSTANT_SYMBOL      1
+#define PROGRAM_CONSTANT_BIG_INTEGER 2
+#define PROGRAM_CONSTANT_FLOAT       3
+
+/*
+ * The format of each instruction, for those that read code other than
+ * the kernel.  Retired opcodes have no name.  The register bytes follow
+ * the opcode and the operand words follow that.  Some operands are code
+ * offsets: those in jumps are jumped to within the program, and those
+ * in labels are made into labels that may be jumped to from anywhere.
+ */
+struct program_instruction
+{
+  char *name;
+  INT registers, operands;
+  INT jumps, labels;
+};
+
+#define PROGRAM_INSTRUCTIONS (I_argl_values+1)
+
+/* The bit of operand i, counted from one, in jumps and labels. */
+#define PROGRAM_OPERAND(i) (1 << ((i)-1))
+
+extern struct program_instruction program_instructions[];
+
+char *program_check(struct str *code);
+char *program_constants(struct process *process, struct str *code,
+			struct svalue *constants);
+char *program_verify(struct str *code, struct svalue *constants);
+INT *program_owners(struct str *code);
+INT program_top_slots(struct str *code, INT offset, UBYTE *reached,
+		      INT **slots, INT *size);
+
+#endif /* __PROGRAM_H__ */
@@ -0,0 +1,87 @@
+/* stack.c
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the control stack module.
+ */
+
+#define MODULE_DEBUG 0
+#define MODULE_NAME  "stack"
+
+#include "types.h"
+
+#include "err.h"
+#include "mem.h"
+#include "process.h"
+#include "stack.h"
+#include "vec.h"
+
+#define STACK_INITIAL_SIZE 256
+
+void stack_create(struct stack *stack)
+{
+  stack->size = STACK_INITIAL_SIZE;
+  stack->used = 0;
+  stack->s = mem_allocate(sizeof(struct svalue) * stack->size);
+}
+
+void stack_destroy(struct stack *stack)
+{
+  mem_free(stack->s);
+}
+
+void stack_grow(struct stack *stack)
+{
+  stack->size *= 2;
+  stack->s = mem_reallocate(stack->s, sizeof(struct svalue) * stack->size);
+}
+
+/*
+ * Continuations copy the stack when they are captured, and copy it
+ * back when they are invoked, so captured stacks are never changed by
+ * later saves and restores.  An empty stack is captured as the empty
+ * list.  The caller must make the result reachable before allocating
+ * anything else.
+ *
+ * The vectors on the stack may be argument vectors being filled in,
+ * which a continuation invoked later fills in again.  They are marked
+ * as shared, so that no procedure takes one as its frame, see
+ * kernel_lambda.
+ */
+void stack_capture(struct process *process, struct svalue *result)
+{
+  struct stack *stack = &process->stack;
+  INT i;
+
+  if(stack->used == 0)
+  {
+    result->type = T_NIL;
+    return;
+  }
+  
+  for(i = 0; i < stack->used; i++)
+    if(IS_VECTOR(stack->s[i]))
+      stack->s[i].u.vec->shared = 1;
+  
+  result->u.vec = vec_allocate(&process->vec_heap, stack->used);
+  result->type = T_VECTOR;
+  mem_copy(result->u.vec->v, stack->s, sizeof(struct svalue) * stack->used);
+}
+
+void stack_reinstate(struct stack *stack, struct svalue *captured)
+{
+  struct vec *vec;
+  
+  if(IS_NIL(*captured))
+  {
+    stack->used = 0;
+    return;
+  }
+
+  vec = captured->u.vec;
+  while(stack->size < vec->length)
+    stack_grow(stack);
+
+  mem_copy(stack->s, vec->v, sizeof(struct svalue) * vec->length);
+  stack->used = vec->length;
+}
@@ -0,0 +1,42 @@
+/* stack.h
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the control stack module.
+ */
+
+#ifndef __STACK_H__
+#define __STACK_H__
+
+#include "types.h"
+
+/* Registers saved by the kernel live in a contiguous array that grows
+   on demand, so saves and restores do not allocate heap pairs. */
+struct stack
+{
+  INT size;
+  INT used;
+
+  struct svalue *s;
+};
+
+#define STACK_PUSH(stack, x)                                               \
+        do {                                                               \
+          if((stack)->used == (stack)->size)                               \
+            stack_grow(stack);                                             \
+          (stack)->s[(stack)->used++] = (x);                               \
+        } while(0)
+
+#define STACK_POP(stack, x)                                                \
+        ((x) = (stack)->s[--(stack)->used])
+
+struct process;
+
+void stack_create(struct stack *stack);
+void stack_destroy(struct stack *stack);
+void stack_grow(struct stack *stack);
+
+void stack_capture(struct process *process, struct svalue *result);
+void stack_reinstate(struct stack *stack, struct svalue *captured);
+
+#endif /* __STACK_H__ */
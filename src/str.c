@@ -188,10 +188,19 @@ static INT str_hash_raw(char *s, INT length, INT shift)
 
 struct str *str_allocate_wide(struct str_heap *heap, char *s, INT length,
 			      INT shift)
+{
+  return str_allocate_hashed(heap, s, length, shift,
+			     str_hash_raw(s, length, shift));
+}
+
+/* As str_allocate_wide, for a string whose hash is already known, such
+   as one copied from another process. */
+struct str *str_allocate_hashed(struct str_heap *heap, char *s, INT length,
+				INT shift, INT rhash)
 {
   struct str_entry *entry, **prev;
   struct str_table *table;
-  INT hash, rhash, size;
+  INT hash, size;
   struct str *str;
 
 #if MODULE_DEBUG  
@@ -200,7 +209,6 @@ struct str *str_allocate_wide(struct str_heap *heap, char *s, INT length,
 #endif
   
   /* Check if the string already exists. */
-  rhash = str_hash_raw(s, length, shift);
   hash = rhash % heap->hash_size;
 
   table = heap->table;
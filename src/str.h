@@ -67,6 +67,8 @@ void str_destroy(struct str_heap *heap);
 
 struct str *str_allocate_wide(struct str_heap *heap, char *s, INT length,
 			      INT shift);
+struct str *str_allocate_hashed(struct str_heap *heap, char *s, INT length,
+				INT shift, INT hash);
 struct str *str_allocate(struct str_heap *heap, char *s, INT length);
 struct str *str_allocate_escaped(struct str_heap *heap, char *s, INT length);
 struct str *str_allocate_text(struct str_heap *heap, char *s);
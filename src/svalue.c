@@ -32,6 +32,10 @@ char *svalue_describe(INT type)
   case T_PORT:          return "port";
   case T_VECTOR:        return "vector";
   case T_MAPPING:       return "mapping";
+  case T_CHANNEL:       return "channel";
+  case T_FUTURE:        return "future";
+  case T_ESCAPE:        return "escape";
+  case T_VALUES:        return "values";
   case T_PAIR:          return "pair";
   case T_SYMBOL:        return "symbol";
   case T_STRING:        return "string";
@@ -59,6 +63,15 @@ INT svalue_hash(struct svalue *value)
 
   case T_PAIR:
     return 0;   /* FIXME: Bad, but... */
+
+  case T_CHANNEL:
+    return (INT)(((unsigned long)value->u.channel >> 3) & 0x7fffffff);
+
+  case T_FUTURE:
+    return (INT)(((unsigned long)value->u.future >> 3) & 0x7fffffff);
+
+  case T_ESCAPE:
+    return value->u.integer & 0x7fffffff;
     
   case T_TRUE:
   case T_FALSE:
@@ -86,11 +99,15 @@ INT svalue_eq(struct svalue *a, struct svalue *b)
       EQ(T_CHAR,    u.integer);
       EQ(T_LAMBDA,  u.pair);
       EQ(T_MAPPING, u.map);
+      EQ(T_CHANNEL, u.channel);
+      EQ(T_FUTURE,  u.future);
+      EQ(T_ESCAPE,  u.integer);
       EQ(T_PAIR,    u.pair);
       EQ(T_REAL,    u.real);
       EQ(T_SYMBOL,  u.str);
       EQ(T_STRING,  u.str);
       EQ(T_VECTOR,  u.vec);
+      EQ(T_VALUES,  u.vec);
       
 #ifdef USE_BIG_INTEGERS
     case T_BIG_INTEGER:
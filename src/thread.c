@@ -0,0 +1,371 @@
+/* thread.c
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the thread module.  Light-weight threads are multiplexed on
+ * a process.  They share its heaps, but each has its own registers,
+ * control stack, program counter and traps.  The running thread keeps
+ * them in the process, and the others in their struct thread.
+ *
+ * A thread is preempted when it enters a procedure with its reductions
+ * used up.  The BIFs that block use up the reductions, so the thread
+ * is switched at the next procedure it enters, see thread-switch in
+ * init.shoe.  The process quits when the main thread does.
+ */
+
+#define MODULE_DEBUG 0
+#define MODULE_NAME  "thread"
+
+#include <time.h>
+
+#include "types.h"
+
+#include "args.h"
+#include "bif.h"
+#include "err.h"
+#include "mem.h"
+#include "pair.h"
+#include "process.h"
+#include "program.h"
+#include "stack.h"
+#include "thread.h"
+
+#define THREAD_INITIAL_SIZE 4
+
+/* Seconds since some time in the past. */
+static double thread_clock(void)
+{
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec/1e9;
+#else
+  return (double)time(0);
+#endif /* CLOCK_MONOTONIC */
+}
+
+/* Blocks the whole process, and all its threads, for the given number
+   of seconds. */
+void thread_wait(double seconds)
+{
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+
+  ts.tv_sec = (time_t)seconds;
+  ts.tv_nsec = (long)((seconds - ts.tv_sec)*1e9);
+  nanosleep(&ts, 0);
+#endif /* CLOCK_MONOTONIC */
+}
+
+void thread_create(struct threads *threads)
+{
+  threads->budget = THREAD_BUDGET;
+  threads->reductions = THREAD_BUDGET;
+
+  threads->current = 0;
+  threads->next_id = THREAD_MAIN+1;
+  threads->size = THREAD_INITIAL_SIZE;
+  threads->used = 1;
+  threads->threads = mem_allocate_zeroed(sizeof(struct thread) *
+					 threads->size);
+
+  threads->threads[0].id = THREAD_MAIN;
+  threads->threads[0].state = THREAD_RUNNABLE;
+}
+
+void thread_destroy(struct threads *threads)
+{
+  struct thread *thread;
+  INT i;
+
+  /* The stack of the running thread is that of the process. */
+  for(i = 0; i < threads->used; i++)
+  {
+    thread = &threads->threads[i];
+    if(i != threads->current &&
+       thread->state != THREAD_FREE && thread->state != THREAD_DONE)
+      stack_destroy(&thread->stack);
+  }
+
+  mem_free(threads->threads);
+}
+
+static struct thread *thread_find(struct threads *threads, INT id)
+{
+  INT i;
+
+  for(i = 0; i < threads->used; i++)
+    if(threads->threads[i].id == id &&
+       threads->threads[i].state != THREAD_FREE)
+      return &threads->threads[i];
+
+  return 0;
+}
+
+/* Returns the index of the thread to run next, after the running one
+   if it can run.  Waits for the first sleeping thread when no thread
+   can run, and returns -1 when none ever will. */
+static INT thread_next(struct threads *threads)
+{
+  struct thread *thread, *joined;
+  double now, wake;
+  INT i, k;
+
+  for(;;)
+  {
+    now = thread_clock();
+    wake = -1;
+
+    for(k = 1; k <= threads->used; k++)
+    {
+      i = (threads->current + k) % threads->used;
+      thread = &threads->threads[i];
+
+      switch(thread->state)
+      {
+      case THREAD_JOINING:
+	joined = thread_find(threads, thread->join);
+	if(joined && joined->state != THREAD_DONE)
+	  break;
+	thread->state = THREAD_RUNNABLE;
+	return i;
+
+      case THREAD_SLEEPING:
+	if(now < thread->wake)
+	{
+	  if(wake < 0 || thread->wake < wake)
+	    wake = thread->wake;
+	  break;
+	}
+	thread->state = THREAD_RUNNABLE;
+	return i;
+
+      case THREAD_RUNNABLE:
+	return i;
+      }
+    }
+
+    if(wake < 0)
+      return -1;
+    thread_wait(wake - now);
+  }
+}
+
+/* Makes thread i the running thread. */
+static void thread_switch(struct process *process, INT i)
+{
+  struct threads *threads = &process->threads;
+  struct thread *from, *to;
+  struct stack stack;
+  INT j;
+
+  from = &threads->threads[threads->current];
+  to = &threads->threads[i];
+
+  for(j = 0; j < N_REGISTERS; j++)
+  {
+    from->reg[j] = process->reg[j];
+    process->reg[j] = to->reg[j];
+  }
+
+  for(j = 0; j < N_TRAPS; j++)
+  {
+    from->trap[j] = process->trap[j];
+    process->trap[j] = to->trap[j];
+  }
+
+  stack = process->stack;
+  process->stack = to->stack;
+  from->stack = stack;
+
+  from->program = process->program;
+  process->program = to->program;
+
+  from->pc = process->pc;
+  process->pc = to->pc;
+
+  threads->current = i;
+  threads->reductions = threads->budget;
+}
+
+/* The running thread has used up its reductions.  Returns one if the
+   process now runs another thread, from the program counter in the
+   process. */
+INT thread_preempt(struct process *process)
+{
+  struct threads *threads = &process->threads;
+  INT i;
+
+  threads->reductions = threads->budget;
+
+  if((i = thread_next(threads)) < 0)
+    err_fatal("All threads are joining threads that never finish.");
+  if(i == threads->current)
+    return 0;
+
+  thread_switch(process, i);
+  return 1;
+}
+
+/* The running thread quit with its value in val.  Returns zero when
+   it is the main thread, otherwise one when another thread runs. */
+INT thread_quit(struct process *process)
+{
+  struct threads *threads = &process->threads;
+  struct thread *thread;
+  INT i;
+
+  thread = &threads->threads[threads->current];
+  if(thread->id == THREAD_MAIN)
+    return 0;
+
+  thread->state = THREAD_DONE;
+  thread->result = process->reg[REGISTER_VAL];
+
+  if((i = thread_next(threads)) < 0)
+    err_fatal("All threads are joining threads that never finish.");
+
+  thread_switch(process, i);
+  stack_destroy(&thread->stack);
+  return 1;
+}
+
+/* Returns the id of a new thread that calls the given procedure without
+   arguments. */
+BIF_DECLARE(bif_thread_spawn)
+{
+  struct threads *threads = &process->threads;
+  struct svalue *procedure, label;
+  struct thread *thread;
+  INT i;
+
+  ARGS_GET((process, "thread-spawn", args, "%*", &procedure));
+
+  if(IS_NOT_LAMBDA(*procedure))
+    ARGS_ERROR((process, "thread-spawn", "Procedure expected."));
+
+  for(i = 0; i < threads->used; i++)
+    if(threads->threads[i].state == THREAD_FREE)
+      break;
+
+  if(i == threads->size)
+  {
+    threads->size *= 2;
+    threads->threads = mem_reallocate(threads->threads,
+				      sizeof(struct thread) * threads->size);
+  }
+  if(i == threads->used)
+    threads->used++;
+
+  thread = &threads->threads[i];
+  thread->id = threads->next_id++;
+  thread->state = THREAD_RUNNABLE;
+
+  for(i = 0; i < N_REGISTERS; i++)
+    thread->reg[i].type = T_UNDEFINED;
+  thread->reg[REGISTER_PROC] = *procedure;
+  thread->reg[REGISTER_ARGL].type = T_NIL;
+
+  for(i = 0; i < N_TRAPS; i++)
+    thread->trap[i] = process->trap[i];
+
+  /* The thread starts at the lambda instruction of the procedure, and
+     quits when the procedure returns to the undefined continuation. */
+  stack_create(&thread->stack);
+  label = CAR(procedure->u.pair);
+  thread->program.u.vec = label.u.vec;
+  thread->program.type = T_VECTOR;
+  thread->pc = label.aux + (UBYTE *)label.u.vec->v[PROGRAM_CODE].u.str->s;
+
+  BIF_RESULT_SMALL_INTEGER(thread->id);
+}
+
+/* Uses up the reductions of the running thread. */
+BIF_DECLARE(bif_thread_yield)
+{
+  ARGS_GET((process, "thread-yield", args, ""));
+
+  process->threads.reductions = 0;
+
+  BIF_RESULT_UNDEFINED();
+}
+
+/* Returns a list of the value of the given thread when it is done, and
+   frees it, otherwise false after the running thread starts to wait for
+   it.  A thread can only be joined once. */
+BIF_DECLARE(bif_thread_join)
+{
+  struct threads *threads = &process->threads;
+  struct thread *thread, *running;
+  struct svalue nil;
+  INT id;
+
+  ARGS_GET((process, "thread-join", args, "%i", &id));
+
+  running = &threads->threads[threads->current];
+  if(!(thread = thread_find(threads, id)) || id == THREAD_MAIN)
+    ARGS_ERROR((process, "thread-join", "No thread %d to join.", id));
+  if(thread == running)
+    ARGS_ERROR((process, "thread-join", "A thread cannot join itself."));
+
+  if(thread->state == THREAD_DONE)
+  {
+    nil.type = T_NIL;
+    result->u.pair = pair_cons(process, &thread->result, &nil);
+    result->type = T_PAIR;
+
+    thread->state = THREAD_FREE;
+    while(threads->used > 1 &&
+	  threads->threads[threads->used-1].state == THREAD_FREE)
+      threads->used--;
+    return;
+  }
+
+  running->state = THREAD_JOINING;
+  running->join = id;
+  threads->reductions = 0;
+
+  BIF_RESULT_FALSE();
+}
+
+/* Puts the running thread to sleep for the given number of seconds.
+   It is switched at the next procedure it enters. */
+void thread_sleep(struct process *process, double seconds)
+{
+  struct threads *threads = &process->threads;
+  struct thread *running;
+
+  running = &threads->threads[threads->current];
+  running->state = THREAD_SLEEPING;
+  running->wake = thread_clock() + seconds;
+  threads->reductions = 0;
+}
+
+BIF_DECLARE(bif_thread_sleep)
+{
+  struct svalue *seconds;
+
+  ARGS_GET((process, "thread-sleep", args, "%r", &seconds));
+
+  thread_sleep(process, IS_FLOAT(*seconds) ? seconds->u.real :
+	       IS_SMALL_INTEGER(*seconds) ? seconds->u.integer : 0);
+
+  BIF_RESULT_UNDEFINED();
+}
+
+/* Sets the number of procedures a thread may enter before it is
+   preempted. */
+BIF_DECLARE(bif_thread_budget)
+{
+  INT budget;
+
+  ARGS_GET((process, "thread-budget", args, "%i", &budget));
+
+  if(budget < 1)
+    ARGS_ERROR((process, "thread-budget", "Budget out of range."));
+
+  process->threads.budget = budget;
+
+  BIF_RESULT_UNDEFINED();
+}
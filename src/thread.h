@@ -0,0 +1,53 @@
+/* thread.h
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the thread module.
+ */
+
+#ifndef __THREAD_H__
+#define __THREAD_H__
+
+#include "types.h"
+
+#include "bif.h"
+
+/* Procedures a thread may enter before it is preempted. */
+#define THREAD_BUDGET 2000
+
+#define THREAD_FREE     0
+#define THREAD_RUNNABLE 1
+#define THREAD_JOINING  2
+#define THREAD_SLEEPING 3
+#define THREAD_DONE     4
+
+#define THREAD_MAIN 0
+
+struct thread;
+
+struct threads
+{
+  /* Procedure entries left before the running thread is preempted, and
+     the number it gets each time it is run. */
+  INT reductions, budget;
+
+  INT current, next_id;
+  INT size, used;
+  struct thread *threads;
+};
+
+void thread_create(struct threads *threads);
+void thread_destroy(struct threads *threads);
+
+INT thread_preempt(struct process *process);
+INT thread_quit(struct process *process);
+void thread_wait(double seconds);
+void thread_sleep(struct process *process, double seconds);
+
+BIF_DECLARE(bif_thread_spawn);
+BIF_DECLARE(bif_thread_yield);
+BIF_DECLARE(bif_thread_join);
+BIF_DECLARE(bif_thread_sleep);
+BIF_DECLARE(bif_thread_budget);
+
+#endif /* __THREAD_H__ */
@@ -45,6 +45,10 @@
 #define T_VECTOR       11
 #define T_MAPPING      12
 #define T_BIG_INTEGER  13
+#define T_CHANNEL      14
+#define T_FUTURE       15
+#define T_ESCAPE       16
+#define T_VALUES       17
 /* Referencing. */
 #define REFERENCING    20
 #define T_PAIR         20
@@ -65,6 +69,8 @@ union anything
   struct map *map;
   struct str *str;
   struct vec *vec;
+  struct channel *channel;
+  struct future *future;
   INT integer;
   REAL real;
   bif *bif;
@@ -135,6 +141,9 @@ struct pair
 #define IS_CONTINUATION(x)      ((x).type == T_CONTINUATION)
 #define IS_NOT_CONTINUATION(x)  ((x).type != T_CONTINUATION)
 
+#define IS_ESCAPE(x)            ((x).type == T_ESCAPE)
+#define IS_NOT_ESCAPE(x)        ((x).type != T_ESCAPE)
+
 #define IS_SYMBOL(x)            ((x).type == T_SYMBOL)
 #define IS_NOT_SYMBOL(x)        ((x).type != T_SYMBOL)
 
@@ -156,12 +165,23 @@ struct pair
 #define IS_MAPPING(x)           ((x).type == T_MAPPING)
 #define IS_NOT_MAPPING(x)       ((x).type != T_MAPPING)
 
+#define IS_CHANNEL(x)           ((x).type == T_CHANNEL)
+#define IS_NOT_CHANNEL(x)       ((x).type != T_CHANNEL)
+
+#define IS_FUTURE(x)            ((x).type == T_FUTURE)
+#define IS_NOT_FUTURE(x)        ((x).type != T_FUTURE)
+
+#define IS_VALUES(x)            ((x).type == T_VALUES)
+#define IS_NOT_VALUES(x)        ((x).type != T_VALUES)
+
 #define IS_PROCEDURE(x)         ((x).type == T_BIF ||                      \
 			 	 (x).type == T_LAMBDA ||                   \
-				 (x).type == T_CONTINUATION)
+				 (x).type == T_CONTINUATION ||             \
+				 (x).type == T_ESCAPE)
 #define IS_NOT_PROCEDURE(x)     ((x).type != T_BIF &&                      \
 				 (x).type != T_LAMBDA &&                   \
-				 (x).type != T_CONTINUATION)
+				 (x).type != T_CONTINUATION &&             \
+				 (x).type != T_ESCAPE)
 
 #define IS_BOOLEAN(x)           ((x).type == T_TRUE || (x).type == T_FALSE)
 #define IS_NOT_BOOLEAN(x)       ((x).type != T_TRUE && (x).type != T_FALSE)
@@ -0,0 +1,517 @@
+/* variant.h
+ *
+ * COPYRIGHT (c) 1999 by Fredrik Noring.
+ *
+ * This is the kernel loop.  It is included by kernel.c once for each
+ * kernel variant, with KERNEL_VARIANT defined to the name of the
+ * function, KERNEL_CHECKED to one if the program may be unverified and
+ * KERNEL_INSTRUMENTED to one for the hook before each instruction.
+ * The function returns zero when the process quits, or one when the
+ * program jumped to must be run by another variant.  The program
+ * counter is then left in the process.
+ */
+
+static INT KERNEL_VARIANT(struct process *process)
+{
+  UBYTE *pc;
+  INT instr, reg, reg2, reg3, m, n;
+
+#ifdef USE_THREADED_DISPATCH
+  /* The table is filled on the first entry only, as the variant is
+     entered again at every thread switch, trap and change of variant.
+     Processes running in parallel may fill it at the same time, so it
+     is made in a table of their own and each slot of the shared one is
+     only ever written with its final address. */
+  static void *dispatch[N_INSTRUCTIONS];
+  static volatile INT dispatch_filled;
+  void *labels[N_INSTRUCTIONS];
+  INT i;
+
+  if(!dispatch_filled)
+  {
+    for(i = 0; i < N_INSTRUCTIONS; i++)
+      labels[i] = &&unknown_instruction;
+
+    DISPATCH_LABEL(labels, I_exit);
+    DISPATCH_LABEL(labels, I_save);
+    DISPATCH_LABEL(labels, I_restore);
+    DISPATCH_LABEL(labels, I_list);
+    DISPATCH_LABEL(labels, I_cons);
+    DISPATCH_LABEL(labels, I_apply_bif);
+    DISPATCH_LABEL(labels, I_apply_lambda);
+    DISPATCH_LABEL(labels, I_assign);
+    DISPATCH_LABEL(labels, I_assign_nil);
+    DISPATCH_LABEL(labels, I_assign_true);
+    DISPATCH_LABEL(labels, I_assign_false);
+    DISPATCH_LABEL(labels, I_assign_small_integer);
+    DISPATCH_LABEL(labels, I_assign_bif);
+    DISPATCH_LABEL(labels, I_assign_lambda);
+    DISPATCH_LABEL(labels, I_assign_label);
+    DISPATCH_LABEL(labels, I_call_cc);
+    DISPATCH_LABEL(labels, I_branch_bif);
+    DISPATCH_LABEL(labels, I_goto);
+    DISPATCH_LABEL(labels, I_jump);
+    DISPATCH_LABEL(labels, I_branch);
+    DISPATCH_LABEL(labels, I_lambda);
+    DISPATCH_LABEL(labels, I_get);
+    DISPATCH_LABEL(labels, I_set);
+    DISPATCH_LABEL(labels, I_env_extend);
+    DISPATCH_LABEL(labels, I_assign_undefined);
+    DISPATCH_LABEL(labels, I_assign_character);
+    DISPATCH_LABEL(labels, I_load_env);
+    DISPATCH_LABEL(labels, I_save2);
+    DISPATCH_LABEL(labels, I_restore2);
+    DISPATCH_LABEL(labels, I_get_list);
+    DISPATCH_LABEL(labels, I_get_cons);
+    DISPATCH_LABEL(labels, I_call_bif);
+    DISPATCH_LABEL(labels, I_call_lambda);
+    DISPATCH_LABEL(labels, I_get0_0);
+    DISPATCH_LABEL(labels, I_get0_1);
+    DISPATCH_LABEL(labels, I_get0_2);
+    DISPATCH_LABEL(labels, I_get0_3);
+    DISPATCH_LABEL(labels, I_get0);
+    DISPATCH_LABEL(labels, I_get1);
+    DISPATCH_LABEL(labels, I_get_top);
+    DISPATCH_LABEL(labels, I_set0);
+    DISPATCH_LABEL(labels, I_set1);
+    DISPATCH_LABEL(labels, I_set_top);
+    DISPATCH_LABEL(labels, I_arg_first);
+    DISPATCH_LABEL(labels, I_arg);
+    DISPATCH_LABEL(labels, I_plus);
+    DISPATCH_LABEL(labels, I_minus);
+    DISPATCH_LABEL(labels, I_times);
+    DISPATCH_LABEL(labels, I_less);
+    DISPATCH_LABEL(labels, I_eq);
+    DISPATCH_LABEL(labels, I_car);
+    DISPATCH_LABEL(labels, I_cdr);
+    DISPATCH_LABEL(labels, I_nullp);
+    DISPATCH_LABEL(labels, I_pairp);
+    DISPATCH_LABEL(labels, I_not);
+    DISPATCH_LABEL(labels, I_assign_constant);
+    DISPATCH_LABEL(labels, I_call_ec);
+    DISPATCH_LABEL(labels, I_generator_resume);
+    DISPATCH_LABEL(labels, I_generator_yield);
+    DISPATCH_LABEL(labels, I_values);
+    DISPATCH_LABEL(labels, I_argl_values);
+
+    for(i = 0; i < N_INSTRUCTIONS; i++)
+      dispatch[i] = labels[i];
+    __sync_synchronize();
+    dispatch_filled = 1;
+  }
+#endif /* USE_THREADED_DISPATCH */
+  
+  pc = process->pc;
+
+  /* swap_in(process); */
+
+  if(NATIVE_PROGRAM(process))
+  {
+    NATIVE(pc - PROGRAM_PC(0));
+    if(VARIANT_CHANGED)
+      VARIANT;
+  }
+  
+#ifdef USE_THREADED_DISPATCH
+  NEXT;
+#else
+  next:
+  
+  instr = OPCODE(pc);
+  
+  INSTRUMENT;
+  
+  switch(instr)
+#endif /* USE_THREADED_DISPATCH */
+  {
+  INSTRUCTION(I_exit):
+  quit:
+    /* err_display(&REG_VAL);
+       err_printf("\n"); */
+    
+    /* swap_out(process); */
+    return 0;
+    
+  INSTRUCTION(I_save):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_save(reg);
+    NEXT;
+    
+  INSTRUCTION(I_restore):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_restore(reg);
+    NEXT;
+    
+  INSTRUCTION(I_cons):
+    reg = REGISTER(pc, 1);
+    reg2 = REGISTER(pc, 2);
+    reg3 = REGISTER(pc, 3);
+    SKIP(pc, 1);
+    INSTR_cons(reg, reg2, reg3);
+    NEXT;
+    
+  INSTRUCTION(I_list):
+    reg = REGISTER(pc, 1);
+    reg2 = REGISTER(pc, 2);
+    SKIP(pc, 1);
+    INSTR_list(reg, reg2);
+    NEXT;
+    
+  INSTRUCTION(I_apply_bif):
+  apply_bif:
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_apply_bif(reg);
+    NEXT;
+
+  trap:
+    /* A BIF failed, continue at the error trap. */
+  {
+    struct svalue t;
+
+    kernel_trap(process, &t);
+    JUMP(t);
+    NEXT;
+  }
+    
+  INSTRUCTION(I_apply_lambda):
+  apply_lambda:
+    INSTR_apply_lambda();
+    NEXT;
+
+  INSTRUCTION(I_assign):
+    reg = REGISTER(pc, 1);
+    reg2 = REGISTER(pc, 2);
+    SKIP(pc, 1);
+    INSTR_assign(reg, reg2);
+    NEXT;
+    
+  INSTRUCTION(I_assign_nil):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_assign_nil(reg);
+    NEXT;
+    
+  INSTRUCTION(I_assign_true):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_assign_true(reg);
+    NEXT;
+    
+  INSTRUCTION(I_assign_false):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_assign_false(reg);
+    NEXT;
+    
+  INSTRUCTION(I_assign_small_integer):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_assign_small_integer(reg, n);
+    NEXT;
+    
+  INSTRUCTION(I_assign_character):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_assign_character(reg, n);
+    NEXT;
+    
+  INSTRUCTION(I_assign_bif):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_assign_bif(reg, n);
+    NEXT;
+    
+  INSTRUCTION(I_assign_lambda):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_assign_lambda(reg, n);
+    NEXT;
+    
+  INSTRUCTION(I_assign_label):
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_assign_label(n);
+    NEXT;
+    
+  INSTRUCTION(I_assign_undefined):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_assign_undefined(reg);
+    NEXT;
+    
+  INSTRUCTION(I_call_cc):
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_call_cc(n);
+    NEXT;
+    
+  INSTRUCTION(I_branch_bif):
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_branch_bif(n);
+    NEXT;
+    
+  INSTRUCTION(I_goto):
+    INSTR_goto(OPERAND(pc, 1));
+    NEXT;
+    
+  INSTRUCTION(I_jump):
+    INSTR_jump();
+    NEXT;
+    
+  INSTRUCTION(I_branch):
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_branch(n);
+    NEXT;
+
+  INSTRUCTION(I_lambda):
+    m = OPERAND(pc, 1);
+    n = OPERAND(pc, 2);
+    SKIP(pc, 4);
+    INSTR_lambda(m, n, 0);
+
+    /* Threads are switched when one enters a procedure with its
+       reductions used up. */
+    if(--process->threads.reductions < 0)
+    {
+      process->pc = pc;
+      if(thread_preempt(process))
+	return 1;
+    }
+
+    /* Lambda bodies entered often are run as native code as far as
+       it goes, except when each instruction is to be seen. */
+    if(!KERNEL_INSTRUMENTED && process->jit.enabled)
+    {
+      jit_f *native = jit_enter(process, pc);
+
+      if(native)
+	pc = native(process);
+    }
+    NEXT;
+    
+  INSTRUCTION(I_env_extend):
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_env_extend(n);
+    NEXT;
+
+  INSTRUCTION(I_get):
+    reg = REGISTER(pc, 1);
+    m = OPERAND(pc, 1);
+    n = OPERAND(pc, 2);
+    SKIP(pc, 3);
+    INSTR_get(reg, m, n);
+    NEXT;
+
+  INSTRUCTION(I_set):
+    reg = REGISTER(pc, 1);
+    m = OPERAND(pc, 1);
+    n = OPERAND(pc, 2);
+    SKIP(pc, 3);
+    INSTR_set(reg, m, n);
+    NEXT;
+
+  INSTRUCTION(I_load_env):
+    SKIP(pc, 1);
+    INSTR_load_env();
+    NEXT;
+
+  INSTRUCTION(I_save2):
+    reg = REGISTER(pc, 1);
+    reg2 = REGISTER(pc, 2);
+    SKIP(pc, 1);
+    INSTR_save2(reg, reg2);
+    NEXT;
+    
+  INSTRUCTION(I_restore2):
+    reg = REGISTER(pc, 1);
+    reg2 = REGISTER(pc, 2);
+    SKIP(pc, 1);
+    INSTR_restore2(reg, reg2);
+    NEXT;
+
+  INSTRUCTION(I_get_list):
+    reg = REGISTER(pc, 1);
+    reg2 = REGISTER(pc, 2);
+    m = OPERAND(pc, 1);
+    n = OPERAND(pc, 2);
+    SKIP(pc, 3);
+    INSTR_get_list(reg, reg2, m, n);
+    NEXT;
+
+  INSTRUCTION(I_get_cons):
+    reg = REGISTER(pc, 1);
+    reg2 = REGISTER(pc, 2);
+    reg3 = REGISTER(pc, 3);
+    m = OPERAND(pc, 1);
+    n = OPERAND(pc, 2);
+    SKIP(pc, 3);
+    INSTR_get_cons(reg, reg2, reg3, m, n);
+    NEXT;
+
+  INSTRUCTION(I_call_bif):
+    n = OPERAND(pc, 2);
+    INSTR_assign_bif(REGISTER_PROC, n);
+    GOTO(OPERAND(pc, 1));
+#if KERNEL_CHECKED
+    NEXT;
+#else
+    /* The label is verified to hold an apply_bif, which is then
+       executed without a dispatch. */
+    goto apply_bif;
+#endif /* KERNEL_CHECKED */
+
+  INSTRUCTION(I_call_lambda):
+    n = OPERAND(pc, 1);
+    INSTR_assign_label(n);
+    goto apply_lambda;
+
+  INSTRUCTION(I_get0_0):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_get0_0(reg);
+    NEXT;
+
+  INSTRUCTION(I_get0_1):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_get0_1(reg);
+    NEXT;
+
+  INSTRUCTION(I_get0_2):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_get0_2(reg);
+    NEXT;
+
+  INSTRUCTION(I_get0_3):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_get0_3(reg);
+    NEXT;
+
+  INSTRUCTION(I_get0):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_get0(reg, n);
+    NEXT;
+
+  INSTRUCTION(I_get1):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_get1(reg, n);
+    NEXT;
+
+  INSTRUCTION(I_get_top):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_get_top(reg, n);
+    NEXT;
+
+  INSTRUCTION(I_set0):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_set0(reg, n);
+    NEXT;
+
+  INSTRUCTION(I_set1):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_set1(reg, n);
+    NEXT;
+
+  INSTRUCTION(I_set_top):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_set_top(reg, n);
+    NEXT;
+
+  INSTRUCTION(I_arg_first):
+    reg = REGISTER(pc, 1);
+    reg2 = REGISTER(pc, 2);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_arg_first(reg, reg2, n);
+    NEXT;
+
+  INSTRUCTION(I_arg):
+    reg = REGISTER(pc, 1);
+    reg2 = REGISTER(pc, 2);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_arg(reg, reg2, n);
+    NEXT;
+
+  INSTRUCTION3(plus);
+  INSTRUCTION3(minus);
+  INSTRUCTION3(times);
+  INSTRUCTION3(less);
+  INSTRUCTION3(eq);
+
+  INSTRUCTION2(car);
+  INSTRUCTION2(cdr);
+  INSTRUCTION2(nullp);
+  INSTRUCTION2(pairp);
+  INSTRUCTION2(not);
+
+  INSTRUCTION(I_assign_constant):
+    reg = REGISTER(pc, 1);
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_assign_constant(reg, n);
+    NEXT;
+
+  INSTRUCTION(I_call_ec):
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_call_ec(n);
+    NEXT;
+
+  INSTRUCTION(I_generator_resume):
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_generator_resume(n);
+    NEXT;
+
+  INSTRUCTION(I_generator_yield):
+    n = OPERAND(pc, 1);
+    SKIP(pc, 2);
+    INSTR_generator_yield(n);
+    NEXT;
+
+  INSTRUCTION(I_values):
+    reg = REGISTER(pc, 1);
+    SKIP(pc, 1);
+    INSTR_values(reg);
+    NEXT;
+
+  INSTRUCTION(I_argl_values):
+    SKIP(pc, 1);
+    INSTR_argl_values();
+    NEXT;
+
+#ifdef USE_THREADED_DISPATCH
+  unknown_instruction:
+#else
+  default:
+#endif /* USE_THREADED_DISPATCH */
+    INSTR_unknown(instr);
+  }
+
+  return 0;
+}
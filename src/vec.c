@@ -84,6 +84,7 @@ struct vec *vec_allocate(struct vec_heap *heap, INT length)
   
   vec = mem_allocate(sizeof(struct vec) + sizeof(struct svalue) * (length-1));
   vec->length = length;
+  vec->shared = 0;
 
   svalue = vec->v;
   for(i = 0; i < length; i++)
@@ -104,6 +105,7 @@ struct vec *vec_copy(struct vec_heap *heap, struct vec *vec)
   size = sizeof(struct vec) + sizeof(struct svalue) * (vec->length-1);
   new_vec = mem_allocate(size);
   mem_copy(new_vec, vec, size);
+  new_vec->shared = 0;
 
   heap->entries += vec->length;
   
@@ -123,6 +125,7 @@ struct vec *vec_append(struct vec_heap *heap, struct vec *a, struct vec *b)
   length = a->length + b->length;
   vec = mem_allocate(sizeof(struct vec) + sizeof(struct svalue) * (length-1));
   vec->length = length;
+  vec->shared = 0;
   
   heap->entries += length;
       
@@ -138,6 +141,7 @@ struct vec *vec_append(struct vec_heap *heap, struct vec *a, struct vec *b)
 
 void vec_sweep(struct vec_heap *heap)
 {
+  struct pair_heap *pairs;
   struct vec *vec, *next, **prev;
   INT i;
 
@@ -166,5 +170,10 @@ void vec_sweep(struct vec_heap *heap)
   
   *prev = 0;
   
-  heap->gc_entries = VEC_GC_RATIO * MAX(heap->entries, VEC_MINIMUM_GC_SIZE);
+  /* Frames and argument vectors are allocated about as fast as pairs,
+     so do not collect more often than the pair heap would. */
+  pairs = &heap->process->pair_heap;
+  heap->gc_entries = MAX(VEC_GC_RATIO * MAX(heap->entries,
+					    VEC_MINIMUM_GC_SIZE),
+			 heap->entries + pairs->size - pairs->used);
 }
@@ -26,6 +26,12 @@ struct vec
 {
   INT length;
   struct vec *next;
+
+  /* Set when the stack captured by a continuation refers to the vector,
+     which then may be filled in again as an argument vector, see
+     stack_capture, or when it holds multiple values, see
+     kernel_values. */
+  INT shared;
   
   struct svalue v[1];
 };